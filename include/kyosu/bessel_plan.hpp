@@ -0,0 +1,244 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/bessel.hpp>
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/parallel.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <span>
+
+namespace kyosu::_
+{
+  inline constexpr std::size_t bessel_plan_task_chunks = 64;
+
+  // out[i] = f(in[i]) with the work split in tasks of bessel_plan_task_chunks SIMD chunks
+  template<typename Z, std::size_t S1, typename R, std::size_t S2, typename F>
+  void bessel_plan_apply(std::span<Z, S1> zs, std::span<R, S2> rs, std::size_t threads, F const& f)
+  {
+    constexpr std::size_t card = eve::wide<std::remove_cv_t<Z>>::size();
+    std::size_t const n = std::min(zs.size(), rs.size());
+    std::size_t const per_task = bessel_plan_task_chunks * card;
+    std::size_t const tasks = (n + per_task - 1) / per_task;
+    parallel_for(tasks, threads, [&](std::size_t t) {
+      std::size_t const p = t * per_task;
+      std::size_t const m = std::min(per_task, n - p);
+      bulk_apply(bulk_subrange(zs, p, m), bulk_subrange(rs, p, m), f);
+    });
+  }
+}
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @class bessel_plan
+  //! @brief Cylindrical Bessel functions \f$J_v\f$, \f$Y_v\f$, \f$H^{(1)}_v\f$, \f$H^{(2)}_v\f$, \f$I_v\f$ and
+  //! \f$K_v\f$ of a fixed real order v
+  //!
+  //! Everything that only depends on the order is computed once: the gamma normalizations and trigonometric factors
+  //! of the series of \f$J_{v_0}\f$ and \f$Y_{v_0}\f$, \f$v_0\f$ being the fractional part of \f$|v|\f$, the
+  //! coefficients of the Hankel expansion for large arguments, the reflection factors of the negative orders and the
+  //! factors linking \f$I_v\f$ and \f$K_v\f$ to \f$J_v\f$ and \f$Y_v\f$. \f$K_v\f$ is computed with one evaluation
+  //! of \f$J_v\f$ and \f$Y_v\f$ per lane.
+  //!
+  //! The results are those of kyosu::bessel_j, kyosu::bessel_y, kyosu::bessel_h, kyosu::bessel_i and
+  //! kyosu::bessel_k, up to rounding. A plan can be used by several threads at once.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/bessel_plan.cpp}
+  //====================================================================================================================
+  template<eve::floating_scalar_value T> class bessel_plan
+  {
+  public:
+    using order_type = T;
+
+    explicit bessel_plan(T v) noexcept
+      : v_(v)
+      , n_(int(eve::abs(v)))
+      , integral_(eve::is_flint(v))
+      , o_(eve::frac(eve::abs(v)))
+      , st_(eve::abs(v))
+      , kf_(eve::two_o_pi(eve::as<T>()) * eve::sinpi(eve::abs(v)))
+      , fi_(exp_ipi(-eve::abs(v) / 2))
+    {
+      auto sgn = eve::sign_alternate(T(n_));
+      auto [s, c] = eve::sinpicospi(eve::frac(eve::abs(v)));
+      rs_ = sgn * s;
+      rc_ = sgn * c;
+      auto f = muli(exp_ipi(eve::abs(v) / 2));
+      cpi_ = eve::pio_2(eve::as<T>()) * f;
+      cmi_ = eve::pio_2(eve::as<T>()) * rec(f);
+    }
+
+    /// Order of the plan
+    T order() const noexcept { return v_; }
+
+    /// \f$J_v(z)\f$, z scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> j(Z z) const noexcept
+    {
+      return kumi::get<0>(jy(complexify_t<Z>(z)));
+    }
+
+    /// \f$Y_v(z)\f$, z scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> y(Z z) const noexcept
+    {
+      return kumi::get<1>(jy(complexify_t<Z>(z)));
+    }
+
+    /// \f$H^{(1)}_v(z)\f$, z scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> h1(Z z) const noexcept
+    {
+      auto [jv, yv] = jy(complexify_t<Z>(z));
+      return jv + muli(yv);
+    }
+
+    /// \f$H^{(2)}_v(z)\f$, z scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> h2(Z z) const noexcept
+    {
+      auto [jv, yv] = jy(complexify_t<Z>(z));
+      return jv - muli(yv);
+    }
+
+    /// \f$I_v(z)\f$, z scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> i(Z z) const noexcept
+    {
+      using c_t = complexify_t<Z>;
+      c_t cz(z);
+      //DLMF 10.27.6 with conjugation for arg(z) > 0
+      auto argzpos = eve::is_gtz(kyosu::arg(cz));
+      auto w = if_else(argzpos, conj(cz), cz);
+      auto r = c_t(fi_) * kumi::get<0>(jy_abs(muli(w)));
+      r = if_else(argzpos, conj(r), r);
+      // I_{-v} = I_v + 2/pi sin(v pi) K_v, DLMF 10.27.2
+      if (v_ < 0 && !integral_) r += kf_ * k(cz);
+      return r;
+    }
+
+    /// \f$K_v(z)\f$, z scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> k(Z z) const noexcept
+    {
+      using c_t = complexify_t<Z>;
+      c_t cz(z);
+      // H1(v, iz) on the lanes where arg(z) < 0, H2(v, -iz) on the others, with a single evaluation of J and Y
+      auto argzlt0 = eve::is_ltz(kyosu::arg(cz));
+      auto [jv, yv] = jy_abs(if_else(argzlt0, muli(cz), mulmi(cz)));
+      auto r = if_else(argzlt0, c_t(cpi_) * (jv + muli(yv)), c_t(cmi_) * (jv - muli(yv)));
+      return if_else(is_eqz(cz), complex(eve::inf(eve::as<T>())), r);
+    }
+
+    /// \f$J_v\f$ at the elements of zs, stored in rs, on at most `threads` threads
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void j(std::span<Z, S1> zs, std::span<R, S2> rs, std::size_t threads = 1) const
+    {
+      _::bessel_plan_apply(zs, rs, threads, [this](auto z) { return j(z); });
+    }
+
+    /// \f$Y_v\f$ at the elements of zs, stored in rs, on at most `threads` threads
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void y(std::span<Z, S1> zs, std::span<R, S2> rs, std::size_t threads = 1) const
+    {
+      _::bessel_plan_apply(zs, rs, threads, [this](auto z) { return y(z); });
+    }
+
+    /// \f$H^{(1)}_v\f$ at the elements of zs, stored in rs, on at most `threads` threads
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void h1(std::span<Z, S1> zs, std::span<R, S2> rs, std::size_t threads = 1) const
+    {
+      _::bessel_plan_apply(zs, rs, threads, [this](auto z) { return h1(z); });
+    }
+
+    /// \f$H^{(2)}_v\f$ at the elements of zs, stored in rs, on at most `threads` threads
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void h2(std::span<Z, S1> zs, std::span<R, S2> rs, std::size_t threads = 1) const
+    {
+      _::bessel_plan_apply(zs, rs, threads, [this](auto z) { return h2(z); });
+    }
+
+    /// \f$I_v\f$ at the elements of zs, stored in rs, on at most `threads` threads
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void i(std::span<Z, S1> zs, std::span<R, S2> rs, std::size_t threads = 1) const
+    {
+      _::bessel_plan_apply(zs, rs, threads, [this](auto z) { return i(z); });
+    }
+
+    /// \f$K_v\f$ at the elements of zs, stored in rs, on at most `threads` threads
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void k(std::span<Z, S1> zs, std::span<R, S2> rs, std::size_t threads = 1) const
+    {
+      _::bessel_plan_apply(zs, rs, threads, [this](auto z) { return k(z); });
+    }
+
+  private:
+    // J and Y of order |v|: Hankel expansion on the lanes where it applies, recurrences elsewhere,
+    // these lanes being set to 1
+    template<typename Z> kumi::tuple<Z, Z> jy_abs(Z z) const noexcept
+    {
+      auto regime = _::hankel_regime(st_, z);
+      if (!integral_) regime = regime && eve::is_gez(real(z));
+      auto hankel = [this](Z z) -> kumi::tuple<Z, Z> {
+        if (integral_) return _::cb_jyn_hankel(n_, st_, z);
+        else return _::cb_jy_hankel(st_, z);
+      };
+      if (eve::all(regime)) return hankel(z);
+
+      auto zr = if_else(regime, Z(1), z);
+      auto r = _::with_alloca<Z>(n_ + 1, [&](auto js, auto ys) -> kumi::tuple<Z, Z> {
+        if (integral_) return _::cb_jyn(n_, zr, js, ys);
+        else return _::cb_jyr_pos(o_, n_, zr, js, ys);
+      });
+      if (eve::any(regime)) r = kumi::map([&](auto h, auto o) { return if_else(regime, h, o); }, hankel(z), r);
+      return r;
+    }
+
+    // J and Y of order v, DLMF 10.4.7 and 10.4.8 for the negative orders
+    template<typename Z> kumi::tuple<Z, Z> jy(Z z) const noexcept
+    {
+      auto [jv, yv] = jy_abs(z);
+      if (v_ >= 0) return {jv, yv};
+      if (integral_) return {rc_ * jv, rc_ * yv};
+      return {jv * rc_ - yv * rs_, jv * rs_ + yv * rc_};
+    }
+
+    T v_;
+    int n_;
+    bool integral_;
+    _::jyr01_order<T> o_;
+    _::stokes_coefficients<T> st_;
+    T rs_, rc_; // (-1)^n sinpicospi(v0), reflection of the negative orders
+    T kf_;      // 2/pi sin(|v| pi)
+    complex_t<T> fi_, cpi_, cmi_;
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+}
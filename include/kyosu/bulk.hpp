@@ -0,0 +1,14 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/bulk/transform.hpp>
+#include <kyosu/bulk/reduce.hpp>
+#include <kyosu/bulk/roots.hpp>
+#include <kyosu/bulk/tgamma.hpp>
+#include <kyosu/bulk/pipeline.hpp>
@@ -0,0 +1,320 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/parallel.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kyosu::_
+{
+  inline constexpr std::size_t pipeline_chunk_bytes = 16 * 1024;
+  inline constexpr std::size_t pipeline_task_chunks = 16;
+
+  // ranges read together by a pipeline, built by kyosu::bulk::zip
+  template<typename... R> struct bulk_zip
+  {
+    kumi::tuple<R...> ranges;
+  };
+
+  // stage of a pipeline processing a whole chunk, built by kyosu::bulk::ranged
+  template<typename F> struct ranged_stage
+  {
+    F f;
+  };
+
+  template<typename T> struct is_ranged_stage : std::false_type
+  {
+  };
+
+  template<typename F> struct is_ranged_stage<ranged_stage<F>> : std::true_type
+  {
+  };
+
+  template<typename T> struct is_kumi_tuple : std::false_type
+  {
+  };
+
+  template<typename... Ts> struct is_kumi_tuple<kumi::tuple<Ts...>> : std::true_type
+  {
+  };
+
+  template<typename T> struct is_bulk_zip : std::false_type
+  {
+  };
+
+  template<typename... R> struct is_bulk_zip<bulk_zip<R...>> : std::true_type
+  {
+  };
+
+  // the ranges read by a pipeline, as a tuple
+  template<typename In> auto pipeline_sources(In&& in) noexcept
+  {
+    if constexpr (is_bulk_zip<std::remove_cvref_t<In>>::value) return in.ranges;
+    else return kumi::make_tuple(bulk_range(in));
+  }
+}
+
+namespace kyosu::bulk
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @class pipeline
+  //! @brief Chain of callables applied to ranges in a single pass, by chunks fitting in the L1 cache
+  //!
+  //! `pipeline p{f1, f2, ..., fn}` computes \f$f_n(\dots f_2(f_1(x_1, \dots, x_k)))\f$: the first stage receives the
+  //! elements of the k inputs, each of the others the result of the previous one, a kumi::tuple result being
+  //! passed as that many arguments. The value of the last stage is a single value.
+  //!
+  //! Called with values, scalar or SIMD, the pipeline is the composed callable. Called with ranges,
+  //! `p(in, out, threads)`, it reads the inputs and writes the outputs once: the stages are applied in registers to
+  //! each SIMD chunk of the inputs before it is stored, so that no intermediate array is materialized. `in` is a
+  //! bulk range or several of them grouped by kyosu::bulk::zip, `out` a bulk range.
+  //!
+  //! A stage wrapped by kyosu::bulk::ranged is called instead on spans, as `f(in, out)` (kyosu::bulk::tgamma for
+  //! instance), and must write values of the type it reads. Its input and output are then scratch buffers of a few
+  //! thousand values which remain in the L1 cache, or spans of the lanes when the pipeline is called with values.
+  //! The work is split in tasks of consecutive chunks executed on at most `threads` threads.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/pipeline.cpp}
+  //====================================================================================================================
+  template<typename... Fs> class pipeline
+  {
+  public:
+    static constexpr std::size_t stages = sizeof...(Fs);
+
+    constexpr pipeline(Fs... fs) : stages_{fs...} {}
+
+    /// Composed value of the stages at x, scalar or SIMD
+    template<typename... Xs>
+    requires(sizeof...(Xs) > 0 && (!concepts::bulk_range<Xs> && ...))
+    auto operator()(Xs const&... xs) const
+    {
+      return kumi::get<0>(values<0, stages>(kumi::make_tuple(xs...)));
+    }
+
+    /// out[i] = p(in[i]) on at most `threads` threads, in being a bulk range or a kyosu::bulk::zip of several
+    template<typename In, concepts::bulk_range Out>
+    requires(concepts::bulk_range<In> || _::is_bulk_zip<std::remove_cvref_t<In>>::value)
+    void operator()(In&& in, Out&& out, std::size_t threads = 1) const
+    {
+      auto srcs = _::pipeline_sources(in);
+      auto dst = _::bulk_range(out);
+      using args_t = decltype(kumi::map([](auto r) { return _::bulk_get(r, 0); }, srcs));
+      using v_t = _::bulk_value_t<kumi::element_t<0, decltype(srcs)>>;
+      constexpr std::size_t card = eve::wide<v_t>::size();
+
+      std::size_t n = dst.size();
+      kumi::for_each([&](auto r) { n = std::min(n, r.size()); }, srcs);
+
+      // chunks: the scratch buffers, or the inputs if there are none, fit in the L1 cache
+      constexpr std::size_t scratch = scratch_size<args_t>();
+      constexpr std::size_t bytes = scratch ? 2 * scratch : sizeof(v_t);
+      constexpr std::size_t chunk = std::max(card, _::pipeline_chunk_bytes / bytes / card * card);
+      std::size_t const per_task = _::pipeline_task_chunks * chunk;
+      std::size_t const tasks = (n + per_task - 1) / per_task;
+
+      _::parallel_for(tasks, threads, [&](std::size_t t) {
+        std::vector<std::byte> buffer(2 * chunk * scratch + 64);
+        auto base = reinterpret_cast<std::uintptr_t>(buffer.data());
+        std::byte* pool = buffer.data() + (64 - base % 64) % 64;
+
+        std::size_t const e = std::min(n, (t + 1) * per_task);
+        for (std::size_t b = t * per_task; b < e; b += chunk)
+        {
+          std::size_t const m = std::min(chunk, e - b);
+          auto sub = kumi::map([&](auto r) { return _::bulk_subrange(r, b, m); }, srcs);
+          run<0>(sub, _::bulk_subrange(dst, b, m), m, pool, pool + chunk * scratch);
+        }
+      });
+    }
+
+  private:
+    template<std::size_t I>
+    static constexpr bool is_ranged = _::is_ranged_stage<kumi::element_t<I, kumi::tuple<Fs...>>>::value;
+
+    // index of the first ranged stage at or after I, or the number of stages
+    template<std::size_t I> static constexpr std::size_t next_ranged() noexcept
+    {
+      if constexpr (I == stages) return I;
+      else if constexpr (is_ranged<I>) return I;
+      else return next_ranged<I + 1>();
+    }
+
+    // a ranged stage applied to a value, scalar or SIMD, through a span of its lanes
+    template<typename F, typename V> static V ranged_value(F const& f, V const& v)
+    {
+      if constexpr (eve::scalar_value<V>)
+      {
+        std::array<V, 1> in{v}, out{};
+        f(std::span(in), std::span(out));
+        return out[0];
+      }
+      else
+      {
+        using e_t = std::remove_cvref_t<decltype(v.get(0))>;
+        std::array<e_t, eve::cardinal_v<V>> in, out;
+        _::store_chunk(v, in.data());
+        f(std::span(in), std::span(out));
+        return _::load_chunk<V>(out.data());
+      }
+    }
+
+    // arguments of the stage J from those of the stage I
+    template<std::size_t I, std::size_t J, typename Args> auto values(Args const& args) const
+    {
+      if constexpr (I == J) return args;
+      else if constexpr (is_ranged<I>)
+      {
+        static_assert(kumi::size_v<Args> == 1, "a ranged stage reads a single range");
+        return values<I + 1, J>(kumi::make_tuple(ranged_value(kumi::get<I>(stages_).f, kumi::get<0>(args))));
+      }
+      else
+      {
+        auto r = kumi::apply(kumi::get<I>(stages_), args);
+        if constexpr (_::is_kumi_tuple<decltype(r)>::value) return values<I + 1, J>(r);
+        else return values<I + 1, J>(kumi::make_tuple(r));
+      }
+    }
+
+    template<std::size_t J, typename Args>
+    using value_at = std::remove_cvref_t<decltype(kumi::get<0>(
+      std::declval<pipeline const&>().template values<0, J>(std::declval<Args const&>())))>;
+
+    // size of the largest value read by a ranged stage
+    template<typename Args> static constexpr std::size_t scratch_size() noexcept
+    {
+      return []<std::size_t... K>(std::index_sequence<K...>) {
+        std::size_t s = 0;
+        ((s = is_ranged<K> ? std::max(s, sizeof(value_at<K, Args>)) : s), ...);
+        return s;
+      }(std::make_index_sequence<stages>{});
+    }
+
+    // dst[i] = stages [I, J) applied to srcs[i]
+    template<std::size_t I, std::size_t J, typename Srcs, typename Dst>
+    void segment(Srcs const& srcs, Dst dst, std::size_t m) const noexcept
+    {
+      using v_t = _::bulk_value_t<kumi::element_t<0, Srcs>>;
+      using c_t = eve::fixed<eve::wide<v_t>::size()>;
+      constexpr std::size_t card = c_t::value;
+      std::size_t i = 0;
+      for (; i + card <= m; i += card)
+      {
+        auto load = [&](auto r) { return _::bulk_load<eve::wide<_::bulk_value_t<decltype(r)>, c_t>>(r, i); };
+        _::bulk_store(dst, i, kumi::get<0>(values<I, J>(kumi::map(load, srcs))));
+      }
+      for (; i < m; ++i)
+        _::bulk_set(dst, i, kumi::get<0>(values<I, J>(kumi::map([&](auto r) { return _::bulk_get(r, i); }, srcs))));
+    }
+
+    // stages [I, stages) on a chunk of m elements, srcs being the arguments of the stage I. They are ranges of the
+    // caller or live in the scratch buffer `spare`, `free` being unused: the ranged stages never work in place.
+    template<std::size_t I, typename Srcs, typename Dst>
+    void run(Srcs const& srcs, Dst dst, std::size_t m, std::byte* free, std::byte* spare) const
+    {
+      constexpr std::size_t J = next_ranged<I>();
+      static_assert(I != J || kumi::size_v<Srcs> == 1, "a ranged stage reads a single range");
+      if constexpr (J == stages) segment<I, J>(srcs, dst, m);
+      else
+      {
+        using args_t = decltype(kumi::map([](auto r) { return _::bulk_get(r, 0); }, srcs));
+        using v_t = std::remove_cvref_t<decltype(kumi::get<0>(values<I, J>(std::declval<args_t const&>())))>;
+        std::span<v_t> x(reinterpret_cast<v_t*>(free), m), y(reinterpret_cast<v_t*>(spare), m);
+        auto f = kumi::get<J>(stages_).f;
+
+        // the ranged stage reads its source directly when it can, and writes the destination when it is the last
+        if constexpr (I == J)
+        {
+          if constexpr (J + 1 == stages) f(kumi::get<0>(srcs), dst);
+          else
+          {
+            f(kumi::get<0>(srcs), x);
+            run<J + 1>(kumi::make_tuple(x), dst, m, spare, free);
+          }
+        }
+        else
+        {
+          segment<I, J>(srcs, x, m);
+          if constexpr (J + 1 == stages) f(x, dst);
+          else
+          {
+            f(x, y);
+            run<J + 1>(kumi::make_tuple(y), dst, m, free, spare);
+          }
+        }
+      }
+    }
+
+    kumi::tuple<Fs...> stages_;
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var zip
+  //!   @brief Groups ranges read together by a kyosu::bulk::pipeline
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/bulk.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu::bulk
+  //!   {
+  //!      auto zip(auto&&... in) noexcept;  // 1
+  //!      auto ranged(auto f) noexcept;     // 2
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `in`: bulk ranges, which are referenced and not copied.
+  //!     * `f`: callable processing spans as `f(in, out)`, kyosu::bulk::tgamma for instance.
+  //!
+  //!   **Return value**
+  //!
+  //!     1. the inputs of a pipeline whose first stage receives one element of each of them,
+  //!     2. a stage of a pipeline applying f to whole chunks.
+  //!
+  //!   @groupheader{Example}
+  //!   @godbolt{doc/pipeline.cpp}
+  //! @}
+  //====================================================================================================================
+  template<concepts::bulk_range... R>
+  requires(sizeof...(R) > 0)
+  auto zip(R&&... in) noexcept
+  {
+    return _::bulk_zip<_::bulk_range_t<R>...>{kumi::make_tuple(_::bulk_range(in)...)};
+  }
+
+  template<typename F> auto ranged(F f) noexcept
+  {
+    return _::ranged_stage<F>{f};
+  }
+}
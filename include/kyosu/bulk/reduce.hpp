@@ -0,0 +1,233 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/callable.hpp>
+#include <kyosu/details/reduce.hpp>
+#include <kyosu/functions/abs.hpp>
+#include <kyosu/functions/conj.hpp>
+#include <kyosu/functions/linfnorm.hpp>
+#include <kyosu/functions/sqr_abs.hpp>
+
+namespace kyosu::bulk
+{
+  template<typename Options> struct sum_t : eve::callable<sum_t, Options, reproducible_option>
+  {
+    template<concepts::bulk_range R>
+    KYOSU_FORCEINLINE auto operator()(R const& r, std::size_t threads = 1) const
+      -> _::bulk_value_t<_::bulk_range_t<R const>>
+    {
+      return KYOSU_CALL(r, threads);
+    }
+
+    KYOSU_CALLABLE_OBJECT(sum_t, bulk_sum_);
+  };
+
+  template<typename Options> struct dot_t : eve::callable<dot_t, Options, reproducible_option>
+  {
+    template<concepts::bulk_range R1, concepts::bulk_range R2>
+    KYOSU_FORCEINLINE auto operator()(R1 const& r1, R2 const& r2, std::size_t threads = 1) const
+      -> decltype(std::declval<_::bulk_value_t<_::bulk_range_t<R1 const>>>() *
+                  kyosu::conj(std::declval<_::bulk_value_t<_::bulk_range_t<R2 const>>>()))
+    {
+      return KYOSU_CALL(r1, r2, threads);
+    }
+
+    KYOSU_CALLABLE_OBJECT(dot_t, bulk_dot_);
+  };
+
+  template<typename Options> struct sum_sqr_abs_t : eve::callable<sum_sqr_abs_t, Options, reproducible_option>
+  {
+    template<concepts::bulk_range R>
+    KYOSU_FORCEINLINE auto operator()(R const& r, std::size_t threads = 1) const
+      -> as_real_type_t<_::bulk_value_t<_::bulk_range_t<R const>>>
+    {
+      return KYOSU_CALL(r, threads);
+    }
+
+    KYOSU_CALLABLE_OBJECT(sum_sqr_abs_t, bulk_sum_sqr_abs_);
+  };
+
+  template<typename Options> struct lpnorm_t : eve::callable<lpnorm_t, Options, reproducible_option>
+  {
+    template<concepts::scalar_real P, concepts::bulk_range R>
+    KYOSU_FORCEINLINE auto operator()(P p, R const& r, std::size_t threads = 1) const
+      -> as_real_type_t<_::bulk_value_t<_::bulk_range_t<R const>>>
+    {
+      return KYOSU_CALL(p, r, threads);
+    }
+
+    KYOSU_CALLABLE_OBJECT(lpnorm_t, bulk_lpnorm_);
+  };
+
+  template<typename Options> struct linfnorm_t : eve::callable<linfnorm_t, Options, reproducible_option, flat_option>
+  {
+    template<concepts::bulk_range R>
+    KYOSU_FORCEINLINE auto operator()(R const& r, std::size_t threads = 1) const
+      -> as_real_type_t<_::bulk_value_t<_::bulk_range_t<R const>>>
+    {
+      return KYOSU_CALL(r, threads);
+    }
+
+    KYOSU_CALLABLE_OBJECT(linfnorm_t, bulk_linfnorm_);
+  };
+
+  template<typename Options> struct maxabs_t : eve::callable<maxabs_t, Options, reproducible_option, flat_option>
+  {
+    template<concepts::bulk_range R>
+    KYOSU_FORCEINLINE auto operator()(R const& r, std::size_t threads = 1) const
+      -> as_real_type_t<_::bulk_value_t<_::bulk_range_t<R const>>>
+    {
+      return KYOSU_CALL(r, threads);
+    }
+
+    KYOSU_CALLABLE_OBJECT(maxabs_t, bulk_linfnorm_);
+  };
+
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var sum
+  //!   @brief Reductions of ranges of reals or Cayley-Dickson values: kyosu::bulk::sum, kyosu::bulk::dot,
+  //!   kyosu::bulk::sum_sqr_abs, kyosu::bulk::lpnorm, kyosu::bulk::linfnorm and kyosu::bulk::maxabs.
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/bulk.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu::bulk
+  //!   {
+  //!      auto sum(auto const& xs, std::size_t threads = 1);                         // 1
+  //!      auto dot(auto const& xs, auto const& ys, std::size_t threads = 1);         // 2
+  //!      auto sum_sqr_abs(auto const& xs, std::size_t threads = 1);                 // 3
+  //!      auto lpnorm(kyosu::concepts::scalar_real auto p, auto const& xs, std::size_t threads = 1);  // 4
+  //!      auto linfnorm(auto const& xs, std::size_t threads = 1);                    // 5
+  //!      auto maxabs(auto const& xs, std::size_t threads = 1);                      // 5
+  //!
+  //!      // Semantic options
+  //!      auto sum[reproducible](/* same arguments */);                              // 6
+  //!      /* and likewise dot, sum_sqr_abs, lpnorm, linfnorm, maxabs */
+  //!      auto linfnorm[flat](auto const& xs, std::size_t threads = 1);              // 7
+  //!      auto maxabs[flat](auto const& xs, std::size_t threads = 1);                // 7
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `xs`, `ys`: contiguous ranges of reals or Cayley-Dickson values (spans, vectors, arrays), or
+  //!       kyosu::soa_view, kyosu::soa_buffer.
+  //!     * `p`: order of the norm.
+  //!     * `threads`: maximal number of threads used. Small ranges are always processed by the calling thread.
+  //!
+  //!   **Return value**
+  //!
+  //!     1. \f$\sum_i x_i\f$.
+  //!     2. \f$\sum_i x_i\bar{y}_i\f$, as kyosu::dot, over the common size of the ranges.
+  //!     3. \f$\sum_i |x_i|^2\f$.
+  //!     4. \f$\left(\sum_i |x_i|^p\right)^{1/p}\f$. `p` equal to 2 is computed as the square root of 3. and
+  //!        `p` infinite as 5.
+  //!     5. \f$\max_i |x_i|\f$.
+  //!     6. By default the elements are accumulated by four independent SIMD accumulators and their lanes summed
+  //!        by a pairwise tree, so that the result depends on the native cardinal and on the number of threads.
+  //!        The `reproducible` option fixes the order of the operations as a function of the size of the range
+  //!        only: 16 virtual accumulators are used by blocks of 4096 elements, then the lanes and the blocks are
+  //!        combined by fixed pairwise trees. The result is then the same, bit for bit, for any number of threads
+  //!        and any cardinal up to 16 on a given instruction set.
+  //!     7. the `flat` option computes the maximum of the absolute values of all the components.
+  //!
+  //!   @groupheader{Example}
+  //!   @godbolt{doc/bulk_reduce.cpp}
+  //! @}
+  //====================================================================================================================
+  inline constexpr auto sum = eve::functor<sum_t>;
+  inline constexpr auto dot = eve::functor<dot_t>;
+  inline constexpr auto sum_sqr_abs = eve::functor<sum_sqr_abs_t>;
+  inline constexpr auto lpnorm = eve::functor<lpnorm_t>;
+  inline constexpr auto linfnorm = eve::functor<linfnorm_t>;
+  inline constexpr auto maxabs = eve::functor<maxabs_t>;
+}
+
+namespace kyosu::_
+{
+  struct sum_reducer
+  {
+    template<typename A> KYOSU_FORCEINLINE A identity(eve::as<A>) const noexcept { return A(0); }
+    template<typename X> KYOSU_FORCEINLINE X map(X const& x) const noexcept { return x; }
+    template<typename A> KYOSU_FORCEINLINE A combine(A const& a, A const& b) const noexcept { return a + b; }
+    template<typename A> KYOSU_FORCEINLINE A finish(A const& a) const noexcept { return a; }
+  };
+
+  struct dot_reducer : sum_reducer
+  {
+    template<typename X, typename Y> KYOSU_FORCEINLINE auto map(X const& x, Y const& y) const noexcept
+    {
+      return x * kyosu::conj(y);
+    }
+  };
+
+  struct sqr_abs_reducer : sum_reducer
+  {
+    template<typename X> KYOSU_FORCEINLINE auto map(X const& x) const noexcept { return kyosu::sqr_abs(x); }
+  };
+
+  template<typename U> struct lpnorm_reducer : sum_reducer
+  {
+    U p;
+    template<typename X> KYOSU_FORCEINLINE auto map(X const& x) const noexcept { return eve::pow(kyosu::abs(x), p); }
+    template<typename A> KYOSU_FORCEINLINE A finish(A const& a) const noexcept { return eve::pow(a, eve::rec(p)); }
+  };
+
+  template<bool Flat> struct maxabs_reducer : sum_reducer
+  {
+    template<typename X> KYOSU_FORCEINLINE auto map(X const& x) const noexcept
+    {
+      if constexpr (Flat) return kyosu::linfnorm[flat](x);
+      else return kyosu::abs(x);
+    }
+    template<typename A> KYOSU_FORCEINLINE A combine(A const& a, A const& b) const noexcept { return eve::max(a, b); }
+  };
+
+  template<typename R, eve::callable_options O>
+  auto bulk_sum_(KYOSU_DELAY(), O const&, R const& r, std::size_t threads)
+  {
+    return bulk_reduce<O::contains(reproducible)>(sum_reducer{}, threads, bulk_range(r));
+  }
+
+  template<typename R1, typename R2, eve::callable_options O>
+  auto bulk_dot_(KYOSU_DELAY(), O const&, R1 const& r1, R2 const& r2, std::size_t threads)
+  {
+    return bulk_reduce<O::contains(reproducible)>(dot_reducer{}, threads, bulk_range(r1), bulk_range(r2));
+  }
+
+  template<typename R, eve::callable_options O>
+  auto bulk_sum_sqr_abs_(KYOSU_DELAY(), O const&, R const& r, std::size_t threads)
+  {
+    return bulk_reduce<O::contains(reproducible)>(sqr_abs_reducer{}, threads, bulk_range(r));
+  }
+
+  template<typename R, eve::callable_options O>
+  auto bulk_linfnorm_(KYOSU_DELAY(), O const&, R const& r, std::size_t threads)
+  {
+    return bulk_reduce<O::contains(reproducible)>(maxabs_reducer<O::contains(flat)>{}, threads, bulk_range(r));
+  }
+
+  template<typename P, typename R, eve::callable_options O>
+  auto bulk_lpnorm_(KYOSU_DELAY(), O const& o, P p, R const& r, std::size_t threads)
+  {
+    using u_t = eve::underlying_type_t<bulk_value_t<bulk_range_t<R const>>>;
+    constexpr bool rep = O::contains(reproducible);
+    if (p == P(2)) return eve::sqrt(bulk_reduce<rep>(sqr_abs_reducer{}, threads, bulk_range(r)));
+    else if (eve::is_infinite(p)) return kyosu::bulk::linfnorm[o](r, threads);
+    else return bulk_reduce<rep>(lpnorm_reducer<u_t>{{}, u_t(p)}, threads, bulk_range(r));
+  }
+}
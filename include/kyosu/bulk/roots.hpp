@@ -0,0 +1,123 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/callable.hpp>
+#include <kyosu/details/parallel.hpp>
+#include <kyosu/functions/roots.hpp>
+#include <numeric>
+#include <vector>
+
+namespace kyosu::bulk
+{
+  template<typename Options> struct roots_t : eve::callable<roots_t, Options>
+  {
+    template<concepts::bulk_range C, concepts::bulk_range R>
+    KYOSU_FORCEINLINE std::size_t operator()(std::size_t degree, C const& coefs, R&& zs, std::size_t threads = 1) const
+    {
+      return KYOSU_CALL(degree, coefs, zs, threads);
+    }
+
+    KYOSU_CALLABLE_OBJECT(roots_t, bulk_roots_);
+  };
+
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var roots
+  //!   @brief Roots of a batch of polynomials of the same degree, by the Aberth-Ehrlich method of kyosu::roots
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/bulk.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu::bulk
+  //!   {
+  //!      std::size_t roots(std::size_t n, auto const& coefs, auto&& zs, std::size_t threads = 1);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `n`: degree of the polynomials.
+  //!     * `coefs`: (n+1) x count matrix of real or complex coefficients, as a kyosu::soa_view, a kyosu::soa_buffer
+  //!        or a contiguous range. Column p holds the coefficients of the p-th polynomial by decreasing power order:
+  //!        the coefficient of \f$x^{n-i}\f$ of the polynomial p is the element `i * count + p`, so that the
+  //!        coefficients of consecutive polynomials are loaded in SIMD registers from contiguous memory.
+  //!     * `zs`: n x count matrix of complex values receiving the roots with the same layout: the k-th root of the
+  //!       polynomial p is the element `k * count + p`.
+  //!     * `threads`: maximal number of threads used.
+  //!
+  //!   **Return value**
+  //!
+  //!     The number of polynomials whose roots did not converge.
+  //!
+  //!     count is the size of `coefs` divided by n+1. Polynomials are solved by groups of the native SIMD cardinal,
+  //!     one per lane, the remaining ones one by one with the approximations of their roots spread over the lanes.
+  //!
+  //!   @groupheader{Example}
+  //!   @godbolt{doc/roots.cpp}
+  //! @}
+  //====================================================================================================================
+  inline constexpr auto roots = eve::functor<roots_t>;
+}
+
+namespace kyosu::_
+{
+  inline constexpr std::size_t roots_task_chunks = 16;
+
+  template<typename C, typename R, eve::callable_options O>
+  std::size_t bulk_roots_(KYOSU_DELAY(), O const&, std::size_t n, C const& coefs, R&& zs, std::size_t threads)
+  {
+    auto a = bulk_range(coefs);
+    auto z = bulk_range(zs);
+    using v_t = bulk_value_t<decltype(a)>;
+    using e_t = as_real_type_t<v_t>;
+    using r_t = eve::wide<e_t>;
+    using w_t = complex_t<r_t>;
+    using l_t = eve::as_logical_t<r_t>;
+    constexpr std::size_t card = r_t::size();
+
+    std::size_t const count = a.size() / (n + 1);
+    if (n == 0 || count == 0) return 0;
+
+    std::size_t const per_task = roots_task_chunks * card;
+    std::size_t const tasks = (count + per_task - 1) / per_task;
+    std::vector<std::size_t> failed(tasks);
+    parallel_for(tasks, threads, [&](std::size_t t) {
+      std::vector<w_t> wa(n + 1), wz(n);
+      std::vector<l_t> done(n);
+      std::size_t p = t * per_task;
+      std::size_t const e = std::min(count, p + per_task);
+
+      for (; p + card <= e; p += card)
+      {
+        for (std::size_t i = 0; i <= n; ++i) wa[i] = w_t(bulk_load<eve::wide<v_t>>(a, i * count + p));
+        auto ok = aberth_lanes(wa.data(), n, wz.data(), done.data());
+        failed[t] += card - std::size_t(eve::count_true(ok));
+        for (std::size_t k = 0; k < n; ++k) bulk_store(z, k * count + p, wz[k]);
+      }
+
+      for (; p < e; ++p)
+      {
+        for (std::size_t i = 0; i <= n; ++i) wa[i] = w_t(complex_t<e_t>(bulk_get(a, i * count + p)));
+        if (!eve::all(aberth_blocks(wa.data(), n, wz.data(), done.data()))) ++failed[t];
+        for (std::size_t k = 0; k < n; ++k)
+          bulk_set(z, k * count + p,
+                   complex_t<e_t>(kyosu::real(wz[k / card]).get(k % card), kyosu::imag(wz[k / card]).get(k % card)));
+      }
+    });
+    return std::accumulate(failed.begin(), failed.end(), std::size_t(0));
+  }
+}
@@ -0,0 +1,138 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/callable.hpp>
+#include <kyosu/details/parallel.hpp>
+#include <kyosu/functions/tgamma.hpp>
+#include <vector>
+
+namespace kyosu::bulk
+{
+  template<typename Options> struct tgamma_t : eve::callable<tgamma_t, Options>
+  {
+    template<concepts::bulk_range In, concepts::bulk_range Out>
+    KYOSU_FORCEINLINE void operator()(In const& in, Out&& out, std::size_t threads = 1) const
+    {
+      return KYOSU_CALL(in, out, threads);
+    }
+
+    KYOSU_CALLABLE_OBJECT(tgamma_t, bulk_tgamma_);
+  };
+
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var tgamma
+  //!   @brief Computes kyosu::tgamma on all the elements of a range, splitting the reflected and direct lanes.
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/bulk.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu::bulk
+  //!   {
+  //!      void tgamma(auto const& in, auto&& out, std::size_t threads = 1);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `in`, `out`: contiguous ranges of reals or Cayley-Dickson values, or kyosu::soa_view, kyosu::soa_buffer.
+  //!     * `threads`: maximal number of threads used.
+  //!
+  //!   **Return value**
+  //!
+  //!     `out[i] = kyosu::tgamma(in[i])` for i less than the smallest of the sizes.
+  //!
+  //!     Complex values with a negative real part go through the reflection formula, whose sine and extra
+  //!     division are wasted on the other lanes of a SIMD chunk. The chunks whose lanes are all on the same side of
+  //!     the imaginary axis are computed in place with the corresponding kernel, the lanes of the other chunks are
+  //!     gathered by side and computed afterwards by full SIMD chunks.
+  //!
+  //!   @groupheader{Example}
+  //!   @godbolt{doc/tgamma.cpp}
+  //! @}
+  //====================================================================================================================
+  inline constexpr auto tgamma = eve::functor<tgamma_t>;
+}
+
+namespace kyosu::_
+{
+  inline constexpr std::size_t tgamma_task_size = 4096;
+
+  // out[idx[k]] = Γ(in[idx[k]]), all the in[idx[k]] being on the side given by Lanes
+  template<tgamma_lanes Lanes, typename In, typename Out>
+  void tgamma_gathered(In in, Out out, std::vector<std::size_t> const& idx) noexcept
+  {
+    using e_t = as_real_type_t<bulk_value_t<In>>;
+    using c_t = complex_t<e_t>;
+    using r_t = eve::wide<e_t>;
+    using w_t = complex_t<r_t>;
+    constexpr std::size_t card = r_t::size();
+
+    std::size_t k = 0;
+    for (; k + card <= idx.size(); k += card)
+    {
+      auto at = [&](auto part) { return r_t([&](auto l, auto) { return part(c_t(bulk_get(in, idx[k + l]))); }); };
+      auto f = tgamma_kernel<Lanes>(w_t(kumi::tuple{at(kyosu::real), at(kyosu::imag)}));
+      for (std::size_t l = 0; l < card; ++l)
+        bulk_set(out, idx[k + l], c_t(kyosu::real(f).get(l), kyosu::imag(f).get(l)));
+    }
+    for (; k < idx.size(); ++k) bulk_set(out, idx[k], tgamma_kernel<Lanes>(c_t(bulk_get(in, idx[k]))));
+  }
+
+  template<typename In, typename Out, eve::callable_options O>
+  void bulk_tgamma_(KYOSU_DELAY(), O const&, In const& in, Out&& out, std::size_t threads)
+  {
+    auto x = bulk_range(in);
+    auto y = bulk_range(out);
+    using v_t = bulk_value_t<decltype(x)>;
+    std::size_t const n = std::min(x.size(), y.size());
+    std::size_t const tasks = (n + tgamma_task_size - 1) / tgamma_task_size;
+
+    parallel_for(tasks, threads, [&](std::size_t t) {
+      std::size_t const b = t * tgamma_task_size;
+      std::size_t const m = std::min(n - b, tgamma_task_size);
+      auto xs = bulk_subrange(x, b, m);
+      auto ys = bulk_subrange(y, b, m);
+
+      if constexpr (!concepts::complex<v_t>) bulk_apply(xs, ys, kyosu::tgamma);
+      else
+      {
+        using e_t = as_real_type_t<v_t>;
+        using r_t = eve::wide<e_t>;
+        using w_t = complex_t<r_t>;
+        constexpr std::size_t card = r_t::size();
+
+        // lanes of the mixed chunks: direct ones in sides[0], reflected ones in sides[1]
+        std::vector<std::size_t> sides[2];
+        std::size_t i = 0;
+        for (; i + card <= m; i += card)
+        {
+          auto z = w_t(bulk_load<eve::wide<v_t>>(xs, i));
+          auto neg = eve::is_negative(kyosu::real(z));
+          if (eve::none(neg)) bulk_store(ys, i, tgamma_kernel<tgamma_lanes::direct>(z));
+          else if (eve::all(neg)) bulk_store(ys, i, tgamma_kernel<tgamma_lanes::reflected>(z));
+          else
+            for (std::size_t l = 0; l < card; ++l) sides[neg.get(l) ? 1 : 0].push_back(i + l);
+        }
+        for (; i < m; ++i) sides[eve::is_negative(kyosu::real(bulk_get(xs, i))) ? 1 : 0].push_back(i);
+
+        tgamma_gathered<tgamma_lanes::direct>(xs, ys, sides[0]);
+        tgamma_gathered<tgamma_lanes::reflected>(xs, ys, sides[1]);
+      }
+    });
+  }
+}
@@ -0,0 +1,65 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/bulk.hpp>
+
+namespace kyosu::bulk
+{
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var transform
+  //!   @brief Applies a kyosu callable to all the elements of a range.
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/bulk.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu::bulk
+  //!   {
+  //!      void transform(auto&& in, auto&& out, auto f) noexcept; // 1
+  //!      void copy(auto&& in, auto&& out)              noexcept; // 2
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `in`, `out`: contiguous ranges of reals or Cayley-Dickson values (spans, vectors, arrays), or
+  //!       kyosu::soa_view, kyosu::soa_buffer.
+  //!     * `f`: callable accepting both the scalar and the wide values of `in`.
+  //!
+  //!   **Return value**
+  //!
+  //!     1. `out[i] = f(in[i])` for i less than the smallest of the sizes. `f` is called on SIMD chunks of the native
+  //!        cardinal of the element type of `in`, then on the remaining elements one by one.
+  //!        kyosu::float16 and kyosu::bfloat16 planes are widened to `float` on load and the results narrowed on store,
+  //!        so that the `float` kernels run on half the memory traffic.
+  //!     2. `out[i] = in[i]`, converting between array of structures and structure of arrays layouts
+  //!        and between storage types.
+  //!
+  //!   @groupheader{Example}
+  //!   @godbolt{doc/bulk.cpp}
+  //! @}
+  //====================================================================================================================
+  template<concepts::bulk_range In, concepts::bulk_range Out, typename F>
+  KYOSU_FORCEINLINE void transform(In&& in, Out&& out, F f) noexcept
+  {
+    _::bulk_apply(_::bulk_range(in), _::bulk_range(out), f);
+  }
+
+  template<concepts::bulk_range In, concepts::bulk_range Out> KYOSU_FORCEINLINE void copy(In&& in, Out&& out) noexcept
+  {
+    transform(in, out, [](auto x) { return x; });
+  }
+}
@@ -0,0 +1,117 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/types.hpp>
+
+// functions instantiated in kyosu_compiled
+#define KYOSU_COMPILED_FUNCTIONS(X)                                                                                    \
+  X(exp)                                                                                                               \
+  X(log)                                                                                                               \
+  X(sqrt)                                                                                                              \
+  X(sin)                                                                                                               \
+  X(cos)                                                                                                               \
+  X(tan)                                                                                                               \
+  X(sinh)                                                                                                              \
+  X(cosh)                                                                                                              \
+  X(tanh)                                                                                                              \
+  X(asin)                                                                                                              \
+  X(acos)                                                                                                              \
+  X(atan)                                                                                                              \
+  X(erf)                                                                                                               \
+  X(tgamma)                                                                                                            \
+  X(digamma)
+
+// types for which they are instantiated, T being float or double
+#define KYOSU_COMPILED_TYPES(X, F, T)                                                                                  \
+  X(F, kyosu::complex_t<T>)                                                                                            \
+  X(F, eve::wide<kyosu::complex_t<T>>)                                                                                 \
+  X(F, kyosu::quaternion_t<T>)                                                                                         \
+  X(F, eve::wide<kyosu::quaternion_t<T>>)
+
+namespace kyosu::compiled
+{
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var compiled
+  //!   @brief Declarations of precompiled instantiations of the main functions
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/compiled.hpp>
+  //!   @endcode
+  //!
+  //!   This header only includes the kyosu types: the functions are declared here and instantiated once in the
+  //!   `kyosu_compiled` library, built when the project is configured with `KYOSU_BUILD_COMPILED=ON`. Translation
+  //!   units that only need these instantiations include it instead of `kyosu/kyosu.hpp` and link with
+  //!   `kyosu_compiled`, which carries the `KYOSU_COMPILED_FLAGS` it was built with, so that the native SIMD types
+  //!   agree on both sides.
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu::compiled
+  //!   {
+  //!      template<typename Z> Z exp(Z const& z) noexcept;                                     // 1
+  //!      // ... and likewise log, sqrt, sin, cos, tan, sinh, cosh, tanh, asin, acos, atan, erf, tgamma, digamma
+  //!
+  //!      template<concepts::complex Z>
+  //!      Z hypergeometric(Z const& z, kumi::tuple<C, C> const& ab, kumi::tuple<C> const& c) noexcept; // 2
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `z`: `complex_t<T>`, `quaternion_t<T>` or their native `eve::wide`, T being `float` or `double`.
+  //!       The hypergeometric function only accepts the complex types.
+  //!     * `ab`, `c`: parameters of type `C = complex_t<T>`.
+  //!
+  //!   **Return value**
+  //!
+  //!     1. the value of the kyosu function of the same name,
+  //!     2. the value of kyosu::hypergeometric(z, ab, c).
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @code
+  //!   #include <kyosu/compiled.hpp>
+  //!   auto r = kyosu::compiled::tgamma(kyosu::complex_t<double>(1.5, 2.0));
+  //!   @endcode
+  //! @}
+  //====================================================================================================================
+#define KYOSU_COMPILED_DECLARE(F) template<concepts::cayley_dickson Z> Z F(Z const& z) noexcept;
+  KYOSU_COMPILED_FUNCTIONS(KYOSU_COMPILED_DECLARE)
+#undef KYOSU_COMPILED_DECLARE
+
+  template<concepts::complex Z>
+  Z hypergeometric(Z const& z,
+                   kumi::tuple<complex_t<eve::underlying_type_t<Z>>, complex_t<eve::underlying_type_t<Z>>> const& ab,
+                   kumi::tuple<complex_t<eve::underlying_type_t<Z>>> const& c) noexcept;
+
+#define KYOSU_COMPILED_EXTERN(F, Z) extern template Z F<Z>(Z const&) noexcept;
+#define KYOSU_COMPILED_EXTERN_ALL(F) KYOSU_COMPILED_TYPES(KYOSU_COMPILED_EXTERN, F, float)                             \
+  KYOSU_COMPILED_TYPES(KYOSU_COMPILED_EXTERN, F, double)
+  KYOSU_COMPILED_FUNCTIONS(KYOSU_COMPILED_EXTERN_ALL)
+#undef KYOSU_COMPILED_EXTERN_ALL
+#undef KYOSU_COMPILED_EXTERN
+
+  extern template complex_t<float> hypergeometric(complex_t<float> const&,
+                                                  kumi::tuple<complex_t<float>, complex_t<float>> const&,
+                                                  kumi::tuple<complex_t<float>> const&) noexcept;
+  extern template complex_t<double> hypergeometric(complex_t<double> const&,
+                                                   kumi::tuple<complex_t<double>, complex_t<double>> const&,
+                                                   kumi::tuple<complex_t<double>> const&) noexcept;
+  extern template eve::wide<complex_t<float>> hypergeometric(eve::wide<complex_t<float>> const&,
+                                                             kumi::tuple<complex_t<float>, complex_t<float>> const&,
+                                                             kumi::tuple<complex_t<float>> const&) noexcept;
+  extern template eve::wide<complex_t<double>> hypergeometric(eve::wide<complex_t<double>> const&,
+                                                              kumi::tuple<complex_t<double>, complex_t<double>> const&,
+                                                              kumi::tuple<complex_t<double>> const&) noexcept;
+}
@@ -24,6 +24,8 @@
 //!  * \f$H_n^{(1)}\f$ is \f$J_n+ i Y_n\f$
 //!  * \f$H_n^{(2)}\f$ is \f$J_n- i Y_n\f$
 //!  * \f$K_n\f$ is computed from \f$H_n^{(1)}\f$ and \f$H_n^{(2)}\f$ with DLMF 10.27.8 simplified for the integral case
+//!  * For \f$|z|\f$ above a threshold (at least 20) depending on the order and the precision, \f$J_n\f$ and \f$Y_n\f$
+//!    use the Hankel expansions (DLMF 10.17.3 and 10.17.4), lane by lane, instead of the recurrences.
 //!
 //! spherical functions
 //!
@@ -50,6 +52,8 @@
 //!    \f$Y_{\vu_0}\f$, \f$J_{\vu_0+1}\f$ and \f$Y_{\vu_0+1}\f$ (where \f$\vu_0\f$ is the  fractionnal part
 //!    of \f$\vu\f$). Forward or backward recursion is used for f$J_\vu\f$ and using wronskian relation for
 //!    \f$Y_\vu\f$ as proposed  in  "Computation of special functions" by S. Zhang and J. Jin, (5.5.11 and 5.5.12)
+//!  * The Hankel expansions are also used for \f$J_\vu\f$ and \f$Y_\vu\f$ on the lanes where \f$|z|\f$ is above the
+//!    threshold and \f$\Re(z) \ge 0\f$.
 //!  * \f$H_\vu^{(1)}\f$ is \f$J_\vu+ i Y_\vu\f$
 //!  * \f$H_\vu^{(2)}\f$ is \f$J_\vu- i Y_\vu\f$
 //!  * \f$I_\vu\f$ are obtained from \f$J_\vu\f$ by  DLMF 10.27.6 using conjugation if phase is positive.
@@ -6,6 +6,7 @@
 */
 //======================================================================================================================
 #pragma once
+#include <kyosu/details/instrument.hpp>
 #include <type_traits>
 
 namespace kyosu::_
@@ -80,6 +81,7 @@ namespace kyosu::_
       delta = C * D;
       f = f * delta;
     } while (eve::any((kyosu::abs(kyosu::dec(delta)) > terminator)) && --counter);
+    KYOSU_INSTRUMENT_ITERATIONS("lentz_b", "continued fraction", counter ? max_terms - counter + 1 : max_terms);
     g.reset();
     return f;
   }
@@ -7,6 +7,7 @@
 //======================================================================================================================
 #pragma once
 #include <kyosu/details/bessel/bessel_utils2.hpp>
+#include <kyosu/details/bessel/stokes_gen.hpp>
 #include <kyosu/details/with_alloca.hpp>
 
 namespace kyosu::_
@@ -267,19 +268,22 @@ namespace kyosu::_
     using u_t = eve::underlying_type_t<Z>;
     auto twoopi = eve::two_o_pi(eve::as<u_t>());
     auto egamma = eve::egamma(eve::as<u_t>());
-    auto eps = eve::eps(eve::as<u_t>());
-    auto bd = bound(z);
-    Z s{};
-    mkjs jj(2 * bd - 2, z);
-    auto sgn = eve::sign_alternate(u_t(bd + 1));
-    for (int k = bd - 1; k >= 1; --k)
-    {
-      auto sk = sgn * jj() / k;
-      jj();
-      sgn = -sgn;
-      s += sk;
-    }
-    auto r = if_else(is_eqz(z), complex(eve::minf(eve::as<u_t>())), twoopi * ((log(z / 2) + egamma) * jj() - 2 * s));
+    auto series = [twoopi, egamma](auto z) {
+      auto bd = bound(z);
+      Z s{};
+      mkjs jj(2 * bd - 2, z);
+      auto sgn = eve::sign_alternate(u_t(bd + 1));
+      for (int k = bd - 1; k >= 1; --k)
+      {
+        auto sk = sgn * jj() / k;
+        jj();
+        sgn = -sgn;
+        s += sk;
+      }
+      return if_else(is_eqz(z), complex(eve::minf(eve::as<u_t>())), twoopi * ((log(z / 2) + egamma) * jj() - 2 * s));
+    };
+    auto hankel = [](auto z) { return kumi::get<1>(cb_jy_hankel(stokes_0<u_t>, z)); };
+    auto r = with_hankel(z, hankel_regime(stokes_0<u_t>, z), hankel, series);
     if (eve::any(rzlt0))
     {
       auto sgn1 = eve::if_else(izgt0, u_t(1), u_t(-1));
@@ -294,11 +298,15 @@ namespace kyosu::_
   template<typename Z> auto cb_y1(Z z) noexcept
   {
     using u_t = eve::underlying_type_t<Z>;
-    auto twoopi = eve::two_o_pi(eve::as<u_t>());
-    auto r1 = R(1, z);
-    auto y0 = kyosu::_::cb_y0(z);
-    auto recs1 = rec(r1) - twoopi / (z * kyosu::_::cb_j0(z) * y0);
-    return if_else(is_eqz(z), complex(eve::minf(eve::as<u_t>())), y0 * recs1);
+    auto wronskian = [](auto z) {
+      auto twoopi = eve::two_o_pi(eve::as<u_t>());
+      auto r1 = R(1, z);
+      auto y0 = kyosu::_::cb_y0(z);
+      auto recs1 = rec(r1) - twoopi / (z * kyosu::_::cb_j0(z) * y0);
+      return if_else(is_eqz(z), complex(eve::minf(eve::as<u_t>())), y0 * recs1);
+    };
+    auto hankel = [](auto z) { return kumi::get<1>(cb_jyn_hankel(1, stokes_1<u_t>, z)); };
+    return with_hankel(z, hankel_regime(stokes_1<u_t>, z), hankel, wronskian);
   }
 
   //===-------------------------------------------------------------------------------------------
@@ -314,6 +322,11 @@ namespace kyosu::_
       using e_t = as_real_type_t<Z>;
       using u_t = eve::underlying_type_t<e_t>;
       auto n = u_t(eve::abs(nn));
+      auto const st = stokes_coefficients<u_t>(n);
+      auto zh = z;
+      auto hankel = hankel_regime(st, z);
+      if (eve::all(hankel)) return kumi::get<0>(cb_jyn_hankel(nn, st, z));
+      z = if_else(hankel, Z(1), z); // keeps the recurrences of the other lanes short
       auto az = kyosu::abs(z);
 
       auto srz = eve::signnz(real(z));
@@ -369,7 +382,9 @@ namespace kyosu::_
       }
       auto sgnaltern = [n](auto x) { return eve::if_else(eve::is_ltz(x), eve::one, eve::sign_alternate(n)); };
       r = sgnaltern(srz) * sgnaltern(n) * r;
-      return nn < 0 ? r * eve::sign_alternate(u_t(nn)) : r;
+      if (nn < 0) r *= eve::sign_alternate(u_t(nn));
+      if (eve::any(hankel)) r = if_else(hankel, kumi::get<0>(cb_jyn_hankel(nn, st, zh)), r);
+      return r;
     }
   }
 
@@ -560,8 +575,14 @@ namespace kyosu::_
   //===-------------------------------------------------------------------------------------------
   template<eve::integral_scalar_value N, typename Z> auto cb_yn(N n, Z z) noexcept
   {
-    auto dummy = std::span<Z, 0>();
-    return _::cb_yn(n, z, dummy);
+    using u_t = eve::underlying_type_t<Z>;
+    auto const st = stokes_coefficients<u_t>(u_t(eve::abs(n)));
+    auto hankel = [n, &st](auto z) { return kumi::get<1>(cb_jyn_hankel(n, st, z)); };
+    auto recurrence = [n](auto z) {
+      auto dummy = std::span<Z, 0>();
+      return _::cb_yn(n, z, dummy);
+    };
+    return with_hankel(z, hankel_regime(st, z), hankel, recurrence);
   }
 
   //===-------------------------------------------------------------------------------------------
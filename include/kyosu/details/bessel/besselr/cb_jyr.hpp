@@ -9,11 +9,94 @@
 #include <kyosu/details/bessel/bessel_utils2.hpp>
 #include <kyosu/details/bessel/besseln/cb_jyn.hpp>
 #include <kyosu/details/bessel/besselr/cb_jyr01.hpp>
+#include <kyosu/details/bessel/stokes_gen.hpp>
 #include <kyosu/details/with_alloca.hpp>
 #include <vector>
 
 namespace kyosu::_
 {
+  //===-------------------------------------------------------------------------------------------
+  //  cb_jyr_pos
+  //  j and y of orders o.v0+k, k = 0..n, o.v0 in ]0, 1[
+  //===-------------------------------------------------------------------------------------------
+  template<typename T, kyosu::concepts::complex Z, typename R1, typename R2>
+  auto cb_jyr_pos(jyr01_order<T> const& o, int n, Z z, R1& cjv, R2& cyv) noexcept
+  {
+    auto v0 = o.v0;
+    // compute cjv0, cjv1, cyv0, cyv1;
+    auto [cjv0, cyv0, cjv1, cyv1] = kyosu::_::cb_jyr01(o, z);
+    cjv[0] = cjv0;
+    cyv[0] = cyv0;
+    if (n == 0) { return kumi::tuple{cjv[0], cyv[0]}; }
+    cjv[1] = cjv1;
+    cyv[1] = cyv1;
+    if (n == 1) { return kumi::tuple{cjv[1], cyv[1]}; }
+    // now jv0 jv1 yv0 and yv1 had been computed
+    // we make forward or backward recurrence to compute the others
+    using u_t = eve::underlying_type_t<Z>;
+    auto twoopi = eve::two_o_pi(as<u_t>());
+    auto az = kyosu::abs(z);
+    auto rz = rec(z);
+
+    auto czero = Z{0};
+
+    auto forward = [n, v0, rz, cjv0 = cjv0, cjv1 = cjv1, &cjv]() {
+      // az large compared to n : 4*n <  az
+      auto cf0 = cjv0;
+      auto cf1 = cjv1;
+      auto cf = cf1;
+      for (int k = 2; k <= n; ++k)
+      {
+        cf = 2 * dec(k + v0) * cf1 * rz - cf0;
+        cjv[k] = cf;
+        cf0 = cf1;
+        cf1 = cf;
+      }
+      return cf;
+    };
+
+    auto backward = [czero, v0, az, n, rz, cjv0 = cjv0, cjv1 = cjv1, &cjv]() {
+      auto m1 = eve::maximum(ini_for_br_1(az, u_t(200)));
+      auto m2 = eve::maximum(ini_for_br_2(u_t(n), az, u_t(15)));
+      auto m = eve::if_else(m1 >= n && eve::is_not_nan(m2), m2, m1);
+      auto cf2 = czero;
+      auto cf1 = kyosu::sqrtsmallestposval(eve::as<Z>());
+      auto cf = cf1;
+      auto bn(cf2);
+      for (int kk = m; kk >= 0; --kk)
+      {
+        cf = u_t(2) * inc(v0 + u_t(kk)) * cf1 * rz - cf2;
+        if (kk <= n) cjv[kk] = cf;
+        cf2 = cf1;
+        cf1 = cf;
+      }
+      auto cs = if_else(abs(cjv0) > abs(cjv1), cjv0 / cf, cjv1 / cf2);
+      for (int kk = 0; kk <= n; ++kk)
+      {
+        cjv[kk] *= cs;
+        ;
+      }
+      return cjv[n];
+    };
+
+    // compute j_{v+i} i =  2...n
+    Z r;
+    auto notdone = kyosu::true_(as<Z>());
+    notdone = next_interval(forward, notdone, 4 * n <= az, r);
+    if (eve::any(notdone)) { last_interval(backward, notdone, r); }
+
+    // compute y_{v+i} i =  2...n
+    auto twoopiz = twoopi * rz;
+    auto fouropisqz = 2 * twoopiz * rz;
+    for (int kk = 2; kk <= n; ++kk)
+    {
+      cyv[kk] =
+        if_else(kyosu::abs(cjv[kk - 1]) > kyosu::abs(cjv[kk - 2]), (cjv[kk] * cyv[kk - 1] - twoopiz) / cjv[kk - 1],
+                (cjv[kk] * cyv[kk - 2] - dec(v0 + kk) * fouropisqz) / cjv[kk - 2]);
+    }
+    return kumi::tuple{cjv[n], cyv[n]};
+  }
+
   //===-------------------------------------------------------------------------------------------
   //  cb_jyr
   //===-------------------------------------------------------------------------------------------
@@ -27,87 +110,9 @@ namespace kyosu::_
     if (eve::is_flint(v)) { return cb_jyn(int(v), z, cjv, cyv); }
     else if (eve::is_gtz(v))
     {
-      auto v0 = eve::frac(v); // v = n+v0 0 < v0 < 1 as v is not a flint
-      // compute cjv0, cjv1, cyv0, cyv1;
-      auto [cjv0, cyv0, cjv1, cyv1] = kyosu::_::cb_jyr01(v0, z);
-      cjv[0] = cjv0;
-      cyv[0] = cyv0;
-      if (n == 0) { return kumi::tuple{cjv[0], cyv[0]}; }
-      cjv[1] = cjv1;
-      cyv[1] = cyv1;
-      if (n == 1) { return kumi::tuple{cjv[1], cyv[1]}; }
-      else if (n >= 2)
-      {
-        // now jv0 jv1 yv0 and yv1 had been computed
-        // we make forward or backward recurrence to compute the others
-        using u_t = eve::underlying_type_t<Z>;
-        auto twoopi = eve::two_o_pi(as<u_t>());
-        auto az = kyosu::abs(z);
-        auto z1 = z;
-        auto z2 = sqr(z);
-        auto v1 = inc(v0); // 1 < v1 < 2
-        auto rz = rec(z);
-
-        auto czero = Z{0};
-        auto cone = Z{1};
-        auto cii = i(as<Z>());
-
-        auto forward = [n, v0, rz, cjv0 = cjv0, cjv1 = cjv1, &cjv]() {
-          // az large compared to n : 4*n <  az
-          auto cf0 = cjv0;
-          auto cf1 = cjv1;
-          auto cf = cf1;
-          for (int k = 2; k <= n; ++k)
-          {
-            cf = 2 * dec(k + v0) * cf1 * rz - cf0;
-            cjv[k] = cf;
-            cf0 = cf1;
-            cf1 = cf;
-          }
-          return cf;
-        };
-
-        auto backward = [czero, v0, az, n, rz, cjv0 = cjv0, cjv1 = cjv1, &cjv]() {
-          auto m1 = eve::maximum(ini_for_br_1(az, u_t(200)));
-          auto m2 = eve::maximum(ini_for_br_2(u_t(n), az, u_t(15)));
-          auto m = eve::if_else(m1 >= n && eve::is_not_nan(m2), m2, m1);
-          auto cf2 = czero;
-          auto cf1 = kyosu::sqrtsmallestposval(eve::as<Z>());
-          auto cf = cf1;
-          auto bn(cf2);
-          for (int kk = m; kk >= 0; --kk)
-          {
-            cf = u_t(2) * inc(v0 + u_t(kk)) * cf1 * rz - cf2;
-            if (kk <= n) cjv[kk] = cf;
-            cf2 = cf1;
-            cf1 = cf;
-          }
-          auto cs = if_else(abs(cjv0) > abs(cjv1), cjv0 / cf, cjv1 / cf2);
-          for (int kk = 0; kk <= n; ++kk)
-          {
-            cjv[kk] *= cs;
-            ;
-          }
-          return cjv[n];
-        };
-
-        // compute j_{v+i} i =  2...n
-        Z r;
-        auto notdone = kyosu::true_(as<Z>());
-        notdone = next_interval(forward, notdone, 4 * n <= az, r);
-        if (eve::any(notdone)) { last_interval(backward, notdone, r); }
-
-        // compute y_{v+i} i =  2...n
-        auto twoopiz = twoopi * rz;
-        auto fouropisqz = 2 * twoopiz * rz;
-        for (int kk = 2; kk <= n; ++kk)
-        {
-          cyv[kk] =
-            if_else(kyosu::abs(cjv[kk - 1]) > kyosu::abs(cjv[kk - 2]), (cjv[kk] * cyv[kk - 1] - twoopiz) / cjv[kk - 1],
-                    (cjv[kk] * cyv[kk - 2] - dec(v0 + kk) * fouropisqz) / cjv[kk - 2]);
-        }
-        return kumi::tuple{cjv[n], cyv[n]};
-      }
+      // v = n+v0 0 < v0 < 1 as v is not a flint
+      using u_t = eve::underlying_type_t<Z>;
+      return cb_jyr_pos(jyr01_order<u_t>(u_t(eve::frac(v))), n, z, cjv, cyv);
     }
     else
     {
@@ -154,8 +159,14 @@ namespace kyosu::_
   //===-------------------------------------------------------------------------------------------
   template<eve::floating_scalar_value N, typename Z> KYOSU_FORCEINLINE auto cb_yr(N v, Z z) noexcept
   {
-    auto dummy = std::span<Z, 0>();
-    return cb_yr(v, z, dummy);
+    using u_t = eve::underlying_type_t<Z>;
+    auto const st = stokes_coefficients<u_t>(u_t(v));
+    auto hankel = [&st](auto z) { return kumi::get<1>(cb_jy_hankel(st, z)); };
+    auto recurrence = [v](auto z) {
+      auto dummy = std::span<Z, 0>();
+      return cb_yr(v, z, dummy);
+    };
+    return with_hankel(z, hankel_regime(st, z) && eve::is_gez(real(z)), hankel, recurrence);
   }
 
   //===-------------------------------------------------------------------------------------------
@@ -180,8 +191,14 @@ namespace kyosu::_
   //===-------------------------------------------------------------------------------------------
   template<eve::floating_scalar_value N, typename Z> KYOSU_FORCEINLINE auto cb_jr(N v, Z z) noexcept
   {
-    auto dummy = std::span<Z, 0>();
-    return cb_jr(v, z, dummy);
+    using u_t = eve::underlying_type_t<Z>;
+    auto const st = stokes_coefficients<u_t>(u_t(v));
+    auto hankel = [&st](auto z) { return kumi::get<0>(cb_jy_hankel(st, z)); };
+    auto recurrence = [v](auto z) {
+      auto dummy = std::span<Z, 0>();
+      return cb_jr(v, z, dummy);
+    };
+    return with_hankel(z, hankel_regime(st, z) && eve::is_gez(real(z)), hankel, recurrence);
   }
 
 }
@@ -7,6 +7,7 @@
 //======================================================================================================================
 #pragma once
 #include <kyosu/details/bessel/bessel_utils2.hpp>
+#include <kyosu/details/instrument.hpp>
 #include <kyosu/details/with_alloca.hpp>
 #include <kyosu/functions/if_else.hpp>
 
@@ -55,16 +56,42 @@ namespace kyosu::_
     }
   }
 
+  //===-------------------------------------------------------------------------------------------
+  //  jyr01_order
+  //  the quantities of cb_jyr01 that only depend on v0: the gamma normalizations of the series and
+  //  the trigonometric factors of Y and of the reflection real(z) < 0
+  //===-------------------------------------------------------------------------------------------
+  template<typename T> struct jyr01_order
+  {
+    T v0, v1;
+    T ga0, ga1;                // gamma(v0+1), gamma(v1+1)
+    T gb0, gb1;                // gamma(1-v0), gamma(1-v1)
+    T s0, c0, s1, c1;          // sinpicospi(v0), sinpicospi(v1)
+    complex_t<T> eipiv0;       // exp(i pi v0)
+
+    explicit jyr01_order(T v) noexcept
+      : v0(v)
+      , v1(eve::inc(v))
+      , ga0(eve::tgamma(eve::inc(v0)))
+      , ga1(eve::tgamma(eve::inc(v1)))
+      , gb0(eve::tgamma(eve::oneminus(v0)))
+      , gb1(eve::tgamma(eve::oneminus(v1)))
+      , eipiv0(exp_ipi(v0))
+    {
+      kumi::tie(s0, c0) = eve::sinpicospi(v0);
+      kumi::tie(s1, c1) = eve::sinpicospi(v1);
+    }
+  };
+
   //===-------------------------------------------------------------------------------------------
   //  cb_jyr01
   //  this internal routine computes jv0 jv1 yv0 and yv1 with v0 in ]0, 1[ and v1 = v0+1
   //===-------------------------------------------------------------------------------------------
   // here nu is always > 0 and z is at most complex
-  template<eve::floating_scalar_value N, typename Z> auto cb_jyr01(N v, Z z) noexcept
+  template<typename T, typename Z> auto cb_jyr01(jyr01_order<T> const& o, Z z) noexcept
   {
-    using u_t = eve::underlying_type_t<Z>;
-    auto v0 = u_t(v);
-    auto v1 = inc(v0); // 1 < v1 < 2
+    auto v0 = o.v0;
+    auto v1 = o.v1; // 1 < v1 < 2
 
     using u_t = eve::underlying_type_t<Z>;
     auto const eps = 16 * eve::eps(as<u_t>());
@@ -92,7 +119,7 @@ namespace kyosu::_
     Z cyv1(cnan);
 
     auto br_lt12 = [&]() {
-      auto cjv01 = [quarter, hlf, cone, eps, z, z2](auto vl) {
+      auto cjv01 = [quarter, hlf, cone, eps, z, z2](auto vl, auto ga) {
         auto cjvl = cone;
         auto cr = cone;
         for (int k = 1; k <= 40; ++k)
@@ -101,15 +128,13 @@ namespace kyosu::_
           cjvl += cr;
           if (eve::all(kyosu::abs(cr) < kyosu::abs(cjvl) * eps)) break;
         }
-        auto vg = inc(vl);
-        auto ga = eve::tgamma(vg);
         auto ca = pow(hlf * z, vl) / ga;
         return ca * cjvl;
       };
-      cjv0 = cjv01(v0);
-      cjv1 = cjv01(v1);
+      cjv0 = cjv01(v0, o.ga0);
+      cjv1 = cjv01(v1, o.ga1);
 
-      auto cju01 = [&](auto vl) {
+      auto cju01 = [&](auto vl, auto gb) {
         auto cjvl = cone;
         auto cr = cone;
         for (int k = 1; k <= 40; ++k)
@@ -118,18 +143,14 @@ namespace kyosu::_
           cjvl += cr;
           if (eve::all(kyosu::abs(cr) < kyosu::abs(cjvl) * eps)) break;
         }
-        auto vg = eve::oneminus(vl);
-        auto gb = eve::tgamma(vg);
         auto cb = pow(two / z, vl) / gb;
         return cjvl * cb;
       };
-      auto cju0 = cju01(v0);
-      auto cju1 = cju01(v1);
+      auto cju0 = cju01(v0, o.gb0);
+      auto cju1 = cju01(v1, o.gb1);
 
-      auto [s0, c0] = sinpicospi(v0);
-      auto [s1, c1] = sinpicospi(v1);
-      cyv0 = fms(cjv0, c0, cju0) / s0;
-      cyv1 = fms(cjv1, c1, cju1) / s1;
+      cyv0 = fms(cjv0, o.c0, cju0) / o.s0;
+      cyv1 = fms(cjv1, o.c1, cju1) / o.s1;
       return kumi::tuple{cjv0, cyv0, cjv1, cyv1};
     };
 
@@ -176,14 +197,19 @@ namespace kyosu::_
     auto notdone = kyosu::true_(as<Z>());
     if (eve::any(notdone))
     {
+      KYOSU_INSTRUMENT_BRANCH("bessel_jyr01", "series", az <= u_t(12));
       notdone = lnext_interval(br_lt12, notdone, az <= u_t(12), r);
-      if (eve::any(notdone)) { llast_interval(br_gt12, notdone, r); }
+      if (eve::any(notdone))
+      {
+        KYOSU_INSTRUMENT_BRANCH("bessel_jyr01", "asymptotic", notdone);
+        llast_interval(br_gt12, notdone, r);
+      }
     }
     kumi::tie(cjv0, cyv0, cjv1, cyv1) = r;
 
     if (eve::any(isltzrz)) //treating real(z) < 0
     {
-      auto eipiv0 = exp_ipi(v0);
+      auto eipiv0 = o.eipiv0;
       auto eipimv0 = rec(eipiv0);
       auto eipiv1 = -eipiv0;
       auto eipimv1 = -eipimv0;
@@ -201,4 +227,10 @@ namespace kyosu::_
     }
     return kumi::tuple{cjv0, cyv0, cjv1, cyv1};
   }
+
+  template<eve::floating_scalar_value N, typename Z> auto cb_jyr01(N v, Z z) noexcept
+  {
+    using u_t = eve::underlying_type_t<Z>;
+    return cb_jyr01(jyr01_order<u_t>(u_t(v)), z);
+  }
 }
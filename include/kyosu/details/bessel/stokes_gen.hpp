@@ -6,59 +6,108 @@
 */
 //======================================================================================================================
 #pragma once
+#include <array>
+#include <cstddef>
 
 namespace kyosu::_
 {
+  //===-------------------------------------------------------------------------------------------
+  //  Hankel expansions for large arguments (DLMF 10.17.3 and 10.17.4)
+  //  With w = z - (nu/2 + 1/4) pi and |ph z| <= pi/2
+  //    J_nu(z) ~ sqrt(2/(pi z)) (cos(w) P(z) - sin(w) Q(z))
+  //    Y_nu(z) ~ sqrt(2/(pi z)) (sin(w) P(z) + cos(w) Q(z))
+  //  where P(z) = sum p_k / z^(2k), Q(z) = sum q_k / z^(2k+1), p_k = (-1)^k a_(2k)(nu) and
+  //  q_k = (-1)^k a_(2k+1)(nu), a_k(nu) = (4nu^2 - 1)(4nu^2 - 9)...(4nu^2 - (2k-1)^2) / (k! 8^k).
+  //  These are the Stokes semiconvergent series from A. Gray, G. B. Mathews 'A treatise on Bessel
+  //  functions and their applications to physics', 1895.
+  //
+  //  The coefficients are generated by a constexpr recurrence: the tables of the orders 0 and 1
+  //  are built at compile time, those of the other orders once per call, the order being the same
+  //  for all the lanes. The expansion is used on the lanes where |z| is above a threshold such that
+  //  the first neglected term is below eps and the terms do not grow.
+  //===-------------------------------------------------------------------------------------------
+  template<typename T> struct stokes_coefficients
+  {
+    static constexpr std::size_t size = sizeof(T) == 4 ? 8 : 16;
+    std::array<T, size> p{}, q{};
+    T nu{}, next{};
+
+    constexpr explicit stokes_coefficients(T v) noexcept : nu(v)
+    {
+      T mu = 4 * v * v;
+      T a(1);
+      for (std::size_t k = 0; k < 2 * size; ++k)
+      {
+        T s = (k / 2) % 2 ? T(-1) : T(1);
+        if (k % 2) q[k / 2] = s * a;
+        else p[k / 2] = s * a;
+        T o(2 * k + 1);
+        a *= (mu - o * o) / T(8 * (k + 1));
+      }
+      next = a;
+    }
+
+    T threshold() const noexcept
+    {
+      auto last = eve::pow(eve::abs(next) / eve::eps(eve::as<T>()), T(1) / T(2 * size));
+      return eve::max(T(20), last, eve::half(eve::as<T>()) * nu * nu);
+    }
+  };
 
-  // These routines are not used
-  // They have served to generate the p and q polynomials of
-  // Stokes Semiconvergent Series from A. Gray, G. B. Mathews 'A
-  //  treatise on Bessel functions and their applications to
-  //  physics, 1895.
-  // They can serve if we implement bessel for more accurate type in the future
+  template<typename T> inline constexpr stokes_coefficients<T> stokes_0{T(0)};
+  template<typename T> inline constexpr stokes_coefficients<T> stokes_1{T(1)};
 
+  template<typename T, typename Z>
+  KYOSU_FORCEINLINE auto hankel_regime(stokes_coefficients<T> const& c, Z const& z) noexcept
+  {
+    return eve::is_greater_equal(kyosu::abs(z), c.threshold());
+  }
 
-  template < size_t N, typename T>
-  auto stokes_gen0() noexcept
+  // J_nu(z) and Y_nu(z) for real(z) >= 0
+  template<typename T, typename Z> KYOSU_FORCEINLINE auto cb_jy_hankel(stokes_coefficients<T> const& c, Z z) noexcept
   {
-    // once p and tabulated and given  the adapted value of n. considering p and q as
-    // the coefficients of two polynomial in ascending power order. For large z (abs(z) > 12, real(z) > 0)
-    // P(z) = p(rec(z*z)) and Q(z) = q(rec(z*z))/z
-    // J0(z) = (c*(P-Q) + s*(P+Q))/(kyosu::sqrt(z*pi));
-    // s = sin(z) and c = cos(z)
-    std::array<T, N> p, q;
-    auto p[0] = complex(eve::one((eve::as<T>())));
-    auto q[0] = p[0]/8;
-    for ( size_t m=1; m<N; ++m )
+    auto rz = kyosu::rec(z);
+    auto rz2 = kyosu::sqr(rz);
+    Z pz(c.p[c.size - 1]), qz(c.q[c.size - 1]);
+    for (std::size_t k = c.size - 1; k-- > 0;)
     {
-      T pim = T(4*m-3)*T(4*m-3)*T(4*m-1)*T(4*m-1) / ( T(2*m-1)*T(128*m) );
-      p[m] = -p[m-1]*pim;
-      T xim = T(4*m-1)*T(4*m-1)*T(4*m+1)*T(4*m+1) / ( T(2*m+1)*T(128*m) );
-      q[m] = -q[m-1]*xim;
+      pz = pz * rz2 + c.p[k];
+      qz = qz * rz2 + c.q[k];
     }
-    return std::pair{p, q};
+    qz *= rz;
+    // cos(w) and sin(w) from cos(z) and sin(z), whose argument reduction is exact
+    auto [s, co] = kyosu::sincos(z);
+    auto [sp, cp] = eve::sinpicospi(eve::half(eve::as<T>()) * c.nu + T(0.25));
+    auto cw = co * cp + s * sp;
+    auto sw = s * cp - co * sp;
+    auto f = kyosu::sqrt(eve::two_o_pi(eve::as<T>()) * rz);
+    return kumi::tuple{f * (cw * pz - sw * qz), f * (sw * pz + cw * qz)};
   }
 
-  template < size_t N, typename T>
-  auto stokes_gen1() noexcept
+  // J_n(z) and Y_n(z) for integral n and any z, by reflection from real(z) >= 0
+  template<eve::integral_scalar_value N, typename T, typename Z>
+  KYOSU_FORCEINLINE auto cb_jyn_hankel(N n, stokes_coefficients<T> const& c, Z z) noexcept
   {
-    // once p and tabulated and  given the adapted value of n. considering p and q as
-    // the coefficients of two polynomial in ascending power order. For large z (abs(z) > 12, real(z) > 0)
-    // P(z) = p(rec(z*z)) and Q(z) = q(rec(z*z))/z
-    // J1(z) = (s*(P-Q) - c*(P+Q))/(kyosu::sqrt(z*pi));
-    // s = sin(z) and c = cos(z)
-    std::array<T, N> p, q;
-    auto p[0] = complex(eve::one((eve::as<T>())));
-    auto q[0] = -3*p[0]/8;
-    for ( size_t m=1; m<N; ++m )
+    auto rzlt0 = eve::is_ltz(real(z));
+    auto sgn1 = eve::if_else(eve::is_gtz(imag(z)), T(1), T(-1));
+    auto [j, y] = cb_jy_hankel(c, kyosu::if_else(rzlt0, -z, z));
+    if (eve::any(rzlt0))
     {
-      auto twom = m+m;
-      auto fourm = twom+twom;
-      T pim = (4-sqr(fourm-3))*(4-sqr(fourm-1))/((twom-1)*128*m);
-      p[m] = -p[m-1]*pim;
-      T xim =  (sqr(fourm-1)-4)*(sqr(fourm+1)-4)/((twom+1)*128*m);
-      q[m] = -q[m-1]*xim;
+      auto sgn = eve::sign_alternate(T(n));
+      y = kyosu::if_else(rzlt0, sgn * (y + 2 * muli(sgn1 * j)), y);
+      j = kyosu::if_else(rzlt0, sgn * j, j);
     }
-    return std::pair{p, q};
+    if (n < 0) return kumi::tuple{eve::sign_alternate(T(n)) * j, eve::sign_alternate(T(n)) * y};
+    return kumi::tuple{j, y};
+  }
+
+  // h(z) on the lanes in the Hankel regime, f elsewhere, f being called with these lanes set to 1
+  template<typename Z, typename L, typename H, typename F>
+  KYOSU_FORCEINLINE Z with_hankel(Z const& z, L const& regime, H h, F f) noexcept
+  {
+    if (eve::all(regime)) return h(z);
+    Z r = f(kyosu::if_else(regime, Z(1), z));
+    if (eve::any(regime)) r = kyosu::if_else(regime, h(z), r);
+    return r;
   }
 }
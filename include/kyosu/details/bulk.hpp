@@ -0,0 +1,203 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/abi.hpp>
+#include <kyosu/types/concepts.hpp>
+#include <kyosu/types/soa.hpp>
+#include <eve/module/core.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace kyosu::concepts
+{
+  /// Ranges accepted by the bulk functions: contiguous ranges, kyosu::soa_view and kyosu::soa_buffer
+  template<typename R>
+  concept bulk_range = requires(std::remove_cvref_t<R>& r) { r.planes; } || requires(R& r) { r.view(); } ||
+                       std::ranges::contiguous_range<std::remove_cvref_t<R>>;
+}
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Bulk helpers
+  //  Contiguous ranges of reals or Cayley-Dickson values are processed by chunks of the native
+  //  cardinal, the remaining elements being processed one by one with the scalar code path.
+  //  The ranges are spans of values or soa_views whose 16 bits planes are widened to float on load
+  //  and narrowed back on store.
+  //===-------------------------------------------------------------------------------------------
+  template<typename T> using bulk_wide_t = eve::wide<std::remove_cvref_t<T>>;
+
+  template<typename W, typename T> KYOSU_FORCEINLINE W load_chunk(T const* p) noexcept
+  {
+    if constexpr (concepts::real<T>) return eve::load(p, eve::cardinal_t<W>{});
+    else return W{[p](auto i, auto) { return p[i]; }};
+  }
+
+  template<typename W, typename T> KYOSU_FORCEINLINE void store_chunk(W const& w, T* p) noexcept
+  {
+    if constexpr (concepts::real<T>) eve::store(w, p);
+    else
+    {
+      for (std::ptrdiff_t i = 0; i < W::size(); ++i) p[i] = w.get(i);
+    }
+  }
+
+  // one plane of a soa_view as a wide of its compute type
+  template<typename P, typename S> KYOSU_FORCEINLINE P load_plane(S const* p) noexcept
+  {
+    if constexpr (!concepts::storage_16<S>) return eve::load(p, eve::cardinal_t<P>{});
+    else
+    {
+      auto h = eve::load(reinterpret_cast<std::uint16_t const*>(p), eve::cardinal_t<P>{});
+      auto u = eve::convert(h, eve::as<std::uint32_t>());
+      if constexpr (std::same_as<S, float16>) return eve::bit_cast(half_to_float_bits(u), eve::as<P>());
+      else return eve::bit_cast(bfloat_to_float_bits(u), eve::as<P>());
+    }
+  }
+
+  template<typename P, typename S> KYOSU_FORCEINLINE void store_plane(P const& w, S* p) noexcept
+  {
+    auto v = eve::convert(w, eve::as<compute_type_t<S>>());
+    if constexpr (!concepts::storage_16<S>) eve::store(v, p);
+    else
+    {
+      using u_t = eve::wide<std::uint32_t, eve::cardinal_t<P>>;
+      auto u = eve::bit_cast(v, eve::as<u_t>());
+      if constexpr (std::same_as<S, float16>) u = float_to_half_bits(u);
+      else u = float_to_bfloat_bits(u);
+      eve::store(eve::convert(u, eve::as<std::uint16_t>()), reinterpret_cast<std::uint16_t*>(p));
+    }
+  }
+
+  // uniform access to the spans and soa_views processed by the bulk functions
+  template<typename R> struct bulk_value;
+
+  template<typename T, std::size_t S> struct bulk_value<std::span<T, S>>
+  {
+    using type = std::remove_cv_t<T>;
+  };
+
+  template<typename S, unsigned int N> struct bulk_value<soa_view<S, N>>
+  {
+    using type = typename soa_view<S, N>::value_type;
+  };
+
+  template<typename R> using bulk_value_t = typename bulk_value<R>::type;
+
+  template<typename T, std::size_t S> KYOSU_FORCEINLINE auto bulk_get(std::span<T, S> r, std::size_t i) noexcept
+  {
+    return r[i];
+  }
+
+  template<typename S, unsigned int N> KYOSU_FORCEINLINE auto bulk_get(soa_view<S, N> r, std::size_t i) noexcept
+  {
+    return r[i];
+  }
+
+  template<typename T, std::size_t S, typename V>
+  KYOSU_FORCEINLINE void bulk_set(std::span<T, S> r, std::size_t i, V const& v) noexcept
+  {
+    r[i] = v;
+  }
+
+  template<typename S, unsigned int N, typename V>
+  KYOSU_FORCEINLINE void bulk_set(soa_view<S, N> r, std::size_t i, V const& v) noexcept
+  {
+    r.set(i, v);
+  }
+
+  // the n elements of r starting at i
+  template<typename T, std::size_t S>
+  KYOSU_FORCEINLINE auto bulk_subrange(std::span<T, S> r, std::size_t i, std::size_t n) noexcept
+  {
+    return r.subspan(i, n);
+  }
+
+  template<typename S, unsigned int N>
+  KYOSU_FORCEINLINE auto bulk_subrange(soa_view<S, N> r, std::size_t i, std::size_t n) noexcept
+  {
+    return r.subview(i, n);
+  }
+
+  template<typename W, typename T, std::size_t S>
+  KYOSU_FORCEINLINE W bulk_load(std::span<T, S> r, std::size_t i) noexcept
+  {
+    return load_chunk<W>(r.data() + i);
+  }
+
+  template<typename W, typename S, unsigned int N>
+  KYOSU_FORCEINLINE W bulk_load(soa_view<S, N> r, std::size_t i) noexcept
+  {
+    using p_t = eve::wide<compute_type_t<S>, eve::cardinal_t<W>>;
+    if constexpr (N == 1) return load_plane<p_t>(r.planes[0] + i);
+    else
+      return [&]<std::size_t... K>(std::index_sequence<K...>) {
+        return W{kumi::tuple{load_plane<p_t>(r.planes[K] + i)...}};
+      }(std::make_index_sequence<N>{});
+  }
+
+  template<typename W, typename T, std::size_t S>
+  KYOSU_FORCEINLINE void bulk_store(std::span<T, S> r, std::size_t i, W const& w) noexcept
+  {
+    store_chunk(w, r.data() + i);
+  }
+
+  template<typename W, typename S, unsigned int N>
+  KYOSU_FORCEINLINE void bulk_store(soa_view<S, N> r, std::size_t i, W const& w) noexcept
+  {
+    if constexpr (N == 1) store_plane(w, r.planes[0] + i);
+    else
+      [&]<std::size_t... K>(std::index_sequence<K...>) {
+        (store_plane(kumi::get<K>(w), r.planes[K] + i), ...);
+      }(std::make_index_sequence<N>{});
+  }
+
+  // out[i] = f(in[i]) for i < min(in.size(), out.size())
+  template<typename In, typename Out, typename F> KYOSU_FORCEINLINE void bulk_apply(In in, Out out, F f) noexcept
+  {
+    using w_t = eve::wide<bulk_value_t<In>>;
+    constexpr std::size_t card = w_t::size();
+    auto const n = std::min(in.size(), out.size());
+    std::size_t i = 0;
+
+    for (; i + card <= n; i += card) bulk_store(out, i, f(bulk_load<w_t>(in, i)));
+    for (; i < n; ++i) bulk_set(out, i, f(bulk_get(in, i)));
+  }
+
+  // out is a row-major rows x in.size() matrix with rows = out.size() / in.size();
+  // f(x, rows, store) computes the column(s) of x and writes row k through store(k, v)
+  template<typename In, std::size_t S1, typename Out, std::size_t S2, typename F>
+  KYOSU_FORCEINLINE void bulk_columns(std::span<In, S1> in, std::span<Out, S2> out, F f) noexcept
+  {
+    using w_t = bulk_wide_t<In>;
+    constexpr std::size_t card = w_t::size();
+    auto const n = in.size();
+    if (n == 0) return;
+    auto const rows = out.size() / n;
+    std::size_t i = 0;
+
+    for (; i + card <= n; i += card)
+      f(load_chunk<w_t>(in.data() + i), rows, [&](std::size_t k, auto const& v) { store_chunk(v, out.data() + k * n + i); });
+    for (; i < n; ++i) f(in[i], rows, [&](std::size_t k, auto const& v) { out[k * n + i] = v; });
+  }
+
+  // spans and soa_views are used as is, soa_buffers through their view, contiguous ranges as spans
+  template<typename R> KYOSU_FORCEINLINE auto bulk_range(R&& r) noexcept
+  {
+    if constexpr (requires { r.planes; }) return r;
+    else if constexpr (requires { r.view(); }) return r.view();
+    else return std::span(r);
+  }
+
+  template<typename R> using bulk_range_t = decltype(bulk_range(std::declval<R&>()));
+}
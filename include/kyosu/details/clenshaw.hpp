@@ -0,0 +1,68 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/functions/convert.hpp>
+#include <kyosu/functions/fma.hpp>
+#include <utility>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Clenshaw summation of sum_k c_k P_k(z), k = 0..n-1, for a family satisfying
+  //      P_0 = 1,  P_1 = p1,  P_k+1 = alpha(k, z) P_k + beta(k) P_k-1
+  //
+  //  c holds the coefficients by increasing degree. The backward sums are always multiplied on
+  //  the left of the recurrence factors, so that for non commutative algebras the coefficients
+  //  stand at the left of the P_k(z), as in the left Horner scheme.
+  //===-------------------------------------------------------------------------------------------
+  template<typename R, typename C, typename Alpha, typename Beta, typename P1>
+  KYOSU_FORCEINLINE constexpr R clenshaw(C const& c, Alpha alpha, Beta beta, P1 const& p1) noexcept
+  {
+    constexpr std::size_t n = kumi::size_v<C>;
+    auto coef = [&](auto k) { return R(convert(kumi::get<decltype(k)::value>(c), eve::as_element<R>())); };
+
+    if constexpr (n == 1) return coef(std::integral_constant<std::size_t, 0>{});
+    else
+    {
+      R b1(0), b2(0);
+      auto step = [&](auto k) {
+        constexpr std::size_t kk = decltype(k)::value;
+        R bk = kyosu::fma(b1, alpha(kk), kyosu::fma(b2, beta(kk + 1), coef(k)));
+        b2 = b1;
+        b1 = bk;
+      };
+
+      [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (step(std::integral_constant<std::size_t, n - 1 - I>{}), ...);
+      }(std::make_index_sequence<n - 1>{});
+
+      return kyosu::fma(b1, p1, kyosu::fma(b2, beta(std::size_t(1)), coef(std::integral_constant<std::size_t, 0>{})));
+    }
+  }
+
+  //===-------------------------------------------------------------------------------------------
+  //  Forward three-term recurrence for the same families: store(k, P_k(z)) for k = 0..n-1
+  //===-------------------------------------------------------------------------------------------
+  template<typename R, typename Alpha, typename Beta, typename P1, typename Store>
+  KYOSU_FORCEINLINE constexpr void forward_recurrence(std::size_t n, Alpha alpha, Beta beta, P1 const& p1, Store store) noexcept
+  {
+    if (n == 0) return;
+    R pkm1(1);
+    store(std::size_t(0), pkm1);
+    if (n == 1) return;
+    R pk(p1);
+    store(std::size_t(1), pk);
+    for (std::size_t k = 1; k + 1 < n; ++k)
+    {
+      R pkp1 = kyosu::fma(pk, alpha(k), beta(k) * pkm1);
+      pkm1 = pk;
+      pk = pkp1;
+      store(k + 1, pk);
+    }
+  }
+}
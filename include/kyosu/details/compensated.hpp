@@ -0,0 +1,110 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/functions/conj.hpp>
+#include <kyosu/functions/fma.hpp>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Error free transformations and compensated algorithms (kahan option)
+  //
+  //  two_add(a, b) returns {s, e} with s = a + b rounded and s + e == a + b exactly (componentwise).
+  //  two_prod(a, b) returns {p, e} with p = a * b rounded and, for real and complex values,
+  //  p + e == a * b up to the rounding of the error term itself.
+  //  The compensated sum, dot product and Horner scheme built on them behave as if computed in
+  //  twice the working precision, then rounded back (Ogita, Rump & Oishi; Graillat, Langlois & Louvet).
+  //===-------------------------------------------------------------------------------------------
+  template<typename Z> KYOSU_FORCEINLINE constexpr kumi::tuple<Z, Z> two_add(Z const& a, Z const& b) noexcept
+  {
+    if constexpr (concepts::real<Z>)
+    {
+      auto [s, e] = eve::two_add(a, b);
+      return {s, e};
+    }
+    else
+    {
+      Z s, e;
+      kumi::for_each(
+        [](auto& ss, auto& ee, auto x, auto y) {
+          auto [u, v] = eve::two_add(x, y);
+          ss = u;
+          ee = v;
+        },
+        s, e, a, b);
+      return {s, e};
+    }
+  }
+
+  template<typename Z>
+  KYOSU_FORCEINLINE constexpr kumi::tuple<Z, Z> two_prod(Z const& a, Z const& b) noexcept
+  requires(concepts::real<Z> || concepts::complex<Z>)
+  {
+    if constexpr (concepts::real<Z>)
+    {
+      auto [p, e] = eve::two_prod(a, b);
+      return {p, e};
+    }
+    else
+    {
+      auto [ar, ai] = a;
+      auto [br, bi] = b;
+      auto [rr, err] = eve::two_prod(ar, br);
+      auto [ii, eii] = eve::two_prod(ai, bi);
+      auto [ri, eri] = eve::two_prod(ar, bi);
+      auto [ir, eir] = eve::two_prod(ai, br);
+      auto [re, ere] = eve::two_add(rr, -ii);
+      auto [im, eim] = eve::two_add(ri, ir);
+      return {Z(re, im), Z(err - eii + ere, eri + eir + eim)};
+    }
+  }
+
+  // Sum2: the rounding errors of the running sum are accumulated apart
+  template<typename R, typename... Ts> KYOSU_FORCEINLINE constexpr R compensated_sum(Ts const&... ts) noexcept
+  {
+    R s(0), e(0);
+    auto step = [&](R const& t) {
+      auto [ss, es] = two_add(s, t);
+      s = ss;
+      e += es;
+    };
+    (step(R(ts)), ...);
+    return s + e;
+  }
+
+  // Dot2: sum of x_i conj(y_i) for two product types of the same size
+  template<typename R, typename Tup1, typename Tup2>
+  KYOSU_FORCEINLINE constexpr R compensated_dot(Tup1 const& xs, Tup2 const& ys) noexcept
+  {
+    R s(0), e(0);
+    kumi::for_each(
+      [&](auto x, auto y) {
+        auto [p, ep] = two_prod(R(x), R(kyosu::conj(y)));
+        auto [ss, es] = two_add(s, p);
+        s = ss;
+        e += ep + es;
+      },
+      xs, ys);
+    return s + e;
+  }
+
+  // Compensated Horner scheme: the local errors are evaluated along by a plain Horner chain
+  template<typename R, typename... Cs>
+  KYOSU_FORCEINLINE constexpr R compensated_horner(R const& x, R const& c0, Cs const&... cs) noexcept
+  {
+    R r(c0), e(0);
+    auto step = [&](R const& c) {
+      auto [p, ep] = two_prod(r, x);
+      auto [s, es] = two_add(p, c);
+      e = kyosu::fma(e, x, ep + es);
+      r = s;
+    };
+    (step(cs), ...);
+    return r + e;
+  }
+}
@@ -47,6 +47,18 @@ namespace kyosu
   struct riemann_mode
   {
   };
+  struct estrin_mode
+  {
+  };
+  struct second_order_mode
+  {
+  };
+  struct fast_mode
+  {
+  };
+  struct reproducible_mode
+  {
+  };
 
   [[maybe_unused]] inline constexpr auto assume_unitary = ::rbr::flag(assume_unitary_mode{});
   [[maybe_unused]] inline constexpr auto intrinsic = ::rbr::flag(intrinsic_mode{});
@@ -60,6 +72,10 @@ namespace kyosu
   [[maybe_unused]] inline constexpr auto type_3 = ::rbr::flag(type_3_mode{});
   [[maybe_unused]] inline constexpr auto riemann = ::rbr::flag(riemann_mode{});
   [[maybe_unused]] inline constexpr auto landau = ::rbr::flag(landau_mode{});
+  [[maybe_unused]] inline constexpr auto estrin = ::rbr::flag(estrin_mode{});
+  [[maybe_unused]] inline constexpr auto second_order = ::rbr::flag(second_order_mode{});
+  [[maybe_unused]] inline constexpr auto fast = ::rbr::flag(fast_mode{});
+  [[maybe_unused]] inline constexpr auto reproducible = ::rbr::flag(reproducible_mode{});
 
   struct assume_unitary_option : eve::_::exact_option<assume_unitary>
   {
@@ -97,6 +113,18 @@ namespace kyosu
   struct landau_option : eve::_::exact_option<landau>
   {
   };
+  struct estrin_option : eve::_::exact_option<estrin>
+  {
+  };
+  struct second_order_option : eve::_::exact_option<second_order>
+  {
+  };
+  struct fast_option : eve::_::exact_option<fast>
+  {
+  };
+  struct reproducible_option : eve::_::exact_option<reproducible>
+  {
+  };
 
   //putting eve decorators in kyosu namespace
 
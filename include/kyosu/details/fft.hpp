@@ -0,0 +1,216 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/functions/muli.hpp>
+#include <kyosu/functions/mulmi.hpp>
+#include <kyosu/functions/to_complex.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Stockham FFT kernels on planes of real and imaginary parts
+  //
+  //  A stage of radix r on sub-transforms of length r m, repeated s times, computes for p < m, q < s
+  //     y[q + s (r p + k)] = w^(p k) sum_j x[q + s (p + j m)] wr^(j k),   k < r
+  //  with w = exp(-2 i pi / (r m)) and wr = exp(-2 i pi / r) (conjugated for the inverse).
+  //  The flat index t = q + s p makes the loads contiguous, so that the butterflies of card
+  //  consecutive t are run on wides. When s is a multiple of card these share p: the twiddles are
+  //  broadcast and the stores are contiguous; otherwise twiddles and stores are done by lanes.
+  //  The stages, in the s = 1, r, r r', ... order, alternate between two buffers and leave the
+  //  output in natural order without any digit reversal pass.
+  //===-------------------------------------------------------------------------------------------
+
+  // radices 8, 4 and 2 first, then the odd factors by increasing order
+  inline std::vector<std::size_t> fft_radices(std::size_t n)
+  {
+    std::vector<std::size_t> r;
+    std::size_t k = 0;
+    for (; n > 1 && n % 2 == 0; n /= 2) ++k;
+    for (; k >= 3; k -= 3) r.push_back(8);
+    if (k == 2) r.push_back(4);
+    else if (k == 1) r.push_back(2);
+    for (std::size_t f = 3; f * f <= n; f += 2)
+      for (; n % f == 0; n /= f) r.push_back(f);
+    if (n > 1) r.push_back(n);
+    return r;
+  }
+
+  struct fft_stage
+  {
+    std::size_t radix, m, s;
+    std::size_t twiddles; // offset of the (radix - 1) m twiddles, stored by k then p
+    std::size_t roots;    // offset of the radix roots of unity of the odd radices
+  };
+
+  // z * -i, or z * i for the inverse transform
+  template<bool Inv, typename Z> KYOSU_FORCEINLINE Z fft_rot(Z const& z) noexcept
+  {
+    if constexpr (Inv) return kyosu::muli(z);
+    else return kyosu::mulmi(z);
+  }
+
+  template<int R, bool Inv, typename Z> KYOSU_FORCEINLINE void fft_butterfly(Z* a) noexcept
+  {
+    if constexpr (R == 2)
+    {
+      auto t = a[0];
+      a[0] = t + a[1];
+      a[1] = t - a[1];
+    }
+    else if constexpr (R == 4)
+    {
+      auto t0 = a[0] + a[2];
+      auto t1 = a[0] - a[2];
+      auto t2 = a[1] + a[3];
+      auto t3 = fft_rot<Inv>(a[1] - a[3]);
+      a[0] = t0 + t2;
+      a[1] = t1 + t3;
+      a[2] = t0 - t2;
+      a[3] = t1 - t3;
+    }
+    else if constexpr (R == 8)
+    {
+      Z e[4] = {a[0], a[2], a[4], a[6]};
+      Z o[4] = {a[1], a[3], a[5], a[7]};
+      fft_butterfly<4, Inv>(e);
+      fft_butterfly<4, Inv>(o);
+      // o_k w8^k with w8 = (1 - i)/sqrt(2)
+      auto c = eve::sqrt_2o_2(eve::as<eve::underlying_type_t<Z>>());
+      o[1] = (o[1] + fft_rot<Inv>(o[1])) * c;
+      o[2] = fft_rot<Inv>(o[2]);
+      o[3] = (fft_rot<Inv>(o[3]) - o[3]) * c;
+      for (int k = 0; k < 4; ++k)
+      {
+        a[k] = e[k] + o[k];
+        a[k + 4] = e[k] - o[k];
+      }
+    }
+  }
+
+  // one stage of radix R (0 for the odd radices, computed by a direct DFT)
+  template<int R, bool Inv, typename T> struct fft_pass
+  {
+    using c_t = complex_t<T>;
+    using w_t = eve::wide<T>;
+    using z_t = complex_t<w_t>;
+
+    fft_stage st;
+    T const* twr;
+    T const* twi;
+    T const* rtr;
+    T const* rti;
+    T scale;
+
+    KYOSU_FORCEINLINE c_t twiddle(std::size_t k, std::size_t p) const noexcept
+    {
+      auto i = st.twiddles + (k - 1) * st.m + p;
+      return c_t(twr[i], Inv ? -twi[i] : twi[i]);
+    }
+
+    template<typename Z, typename Load, typename Tw, typename Store>
+    KYOSU_FORCEINLINE void butterfly(Z* a, [[maybe_unused]] Z* b, Load load, Tw tw, Store store) const noexcept
+    {
+      std::size_t const r = R ? R : st.radix;
+      std::size_t const ms = st.m * st.s;
+      for (std::size_t j = 0; j < r; ++j) a[j] = load(j * ms);
+      if constexpr (R != 0) fft_butterfly<R, Inv>(a);
+      else
+      {
+        for (std::size_t k = 0; k < r; ++k)
+        {
+          Z acc = a[0];
+          for (std::size_t j = 1; j < r; ++j)
+          {
+            auto i = st.roots + (j * k) % r;
+            acc += a[j] * c_t(rtr[i], Inv ? -rti[i] : rti[i]);
+          }
+          b[k] = acc;
+        }
+        for (std::size_t k = 0; k < r; ++k) a[k] = b[k];
+      }
+      for (std::size_t k = 0; k < r; ++k)
+      {
+        Z v = k == 0 ? a[0] : Z(a[k] * tw(k));
+        if (scale != T(1)) v = v * scale;
+        store(k * st.s, v);
+      }
+    }
+
+    void operator()(T const* xr, T const* xi, T* yr, T* yi) const
+    {
+      constexpr std::size_t card = w_t::size();
+      std::size_t const r = R ? R : st.radix;
+      std::size_t const m = st.m, s = st.s, ms = m * s;
+      constexpr std::size_t na = R ? R : 1;
+      std::vector<z_t> wa(R ? 0 : 2 * r);
+      std::vector<c_t> sa(R ? 0 : 2 * r);
+      z_t za[na], zb[na];
+      c_t ca[na], cb[na];
+      z_t* pa = R ? za : wa.data();
+      z_t* pb = R ? zb : wa.data() + r;
+      c_t* qa = R ? ca : sa.data();
+      c_t* qb = R ? cb : sa.data() + r;
+
+      auto load = [&](std::size_t t) {
+        return [=](std::size_t o) {
+          return z_t(kumi::tuple{eve::load(xr + t + o, eve::cardinal_t<w_t>{}),
+                                 eve::load(xi + t + o, eve::cardinal_t<w_t>{})});
+        };
+      };
+
+      std::size_t t = 0;
+      if (s % card == 0)
+      {
+        for (; t < ms; t += card)
+        {
+          std::size_t const p = t / s, base = t % s + s * r * p;
+          butterfly(
+            pa, pb, load(t), [&](std::size_t k) { return twiddle(k, p); },
+            [&](std::size_t o, z_t const& v) {
+              eve::store(kyosu::real(v), yr + base + o);
+              eve::store(kyosu::imag(v), yi + base + o);
+            });
+        }
+      }
+      else
+      {
+        for (; t + card <= ms; t += card)
+        {
+          auto tw = [&](std::size_t k) {
+            return z_t(kumi::tuple{w_t([&](auto l, auto) { return kyosu::real(twiddle(k, (t + l) / s)); }),
+                                   w_t([&](auto l, auto) { return kyosu::imag(twiddle(k, (t + l) / s)); })});
+          };
+          butterfly(pa, pb, load(t), tw, [&](std::size_t o, z_t const& v) {
+            auto vr = kyosu::real(v);
+            auto vi = kyosu::imag(v);
+            for (std::size_t l = 0; l < card; ++l)
+            {
+              std::size_t const u = t + l, i = u % s + s * r * (u / s) + o;
+              yr[i] = vr.get(l);
+              yi[i] = vi.get(l);
+            }
+          });
+        }
+      }
+
+      for (; t < ms; ++t)
+      {
+        std::size_t const p = t / s, base = t % s + s * r * p;
+        butterfly(
+          qa, qb, [&](std::size_t o) { return c_t(xr[t + o], xi[t + o]); },
+          [&](std::size_t k) { return twiddle(k, p); },
+          [&](std::size_t o, c_t const& v) {
+            yr[base + o] = kyosu::real(v);
+            yi[base + o] = kyosu::imag(v);
+          });
+      }
+    }
+  };
+}
@@ -0,0 +1,65 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/details/abi.hpp>
+#include <eve/module/core.hpp>
+#include <cstdint>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  binary16 and bfloat16 <-> binary32 conversions on the bit patterns
+  //  U is std::uint32_t or a wide of std::uint32_t, the 16 bits values being in the low halves.
+  //  Only integer operations and one float subtraction (binary16 subnormals) are used, so that
+  //  the same code converts one value or a whole register without relying on F16C or AVX512-BF16.
+  //  Narrowing rounds to nearest even, overflows to infinity and keeps NaNs quiet.
+  //===-------------------------------------------------------------------------------------------
+  template<typename U> KYOSU_FORCEINLINE U half_to_float_bits(U h) noexcept
+  {
+    using f_t = eve::as_floating_point_t<U>;
+    constexpr std::uint32_t shifted_exp = 0x7c00u << 13;
+    U o = (h & 0x7fffu) << 13;
+    U e = o & shifted_exp;
+    o = o + ((127u - 15u) << 23);
+    // binary16 subnormals are renormalized by the float subtraction of 2^-14
+    U d = eve::bit_cast(eve::bit_cast(U(o + (1u << 23)), eve::as<f_t>()) - eve::bit_cast(U(113u << 23), eve::as<f_t>()),
+                        eve::as<U>());
+    o = eve::if_else(e == shifted_exp, U(o + ((128u - 16u) << 23)), eve::if_else(e == 0u, d, o));
+    return o | ((h & 0x8000u) << 16);
+  }
+
+  template<typename U> KYOSU_FORCEINLINE U float_to_half_bits(U f) noexcept
+  {
+    using f_t = eve::as_floating_point_t<U>;
+    constexpr std::uint32_t f32_inf = 255u << 23;
+    constexpr std::uint32_t f16_max = (127u + 16u) << 23;
+    constexpr std::uint32_t f16_min_normal = 113u << 23;
+    constexpr std::uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+    U sign = f & 0x80000000u;
+    f = f ^ sign;
+    U big = eve::if_else(f > f32_inf, U(0x7e00u), U(0x7c00u));
+    // results in the subnormal range: the float addition aligns and rounds the mantissa
+    U sub = eve::bit_cast(eve::bit_cast(f, eve::as<f_t>()) + eve::bit_cast(U(denorm_magic), eve::as<f_t>()),
+                          eve::as<U>()) - denorm_magic;
+    // normal results: rebias the exponent, then round to nearest even
+    U nrm = (f + ((15u - 127u) << 23) + 0xfffu + ((f >> 13) & 1u)) >> 13;
+    U o = eve::if_else(f >= f16_max, big, eve::if_else(f < f16_min_normal, sub, nrm));
+    return o | (sign >> 16);
+  }
+
+  template<typename U> KYOSU_FORCEINLINE U bfloat_to_float_bits(U h) noexcept
+  {
+    return h << 16;
+  }
+
+  template<typename U> KYOSU_FORCEINLINE U float_to_bfloat_bits(U f) noexcept
+  {
+    U r = (f + (0x7fffu + ((f >> 16) & 1u))) >> 16;
+    return eve::if_else((f & 0x7fffffffu) > 0x7f800000u, U((f >> 16) | 0x40u), r);
+  }
+}
@@ -10,6 +10,11 @@
 #include <kyosu/constants/fnan.hpp>
 #include <kyosu/functions/is_fnan.hpp>
 #include <kyosu/details/hyperg/hyp2_1.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
 
 namespace kyosu::_
 {
@@ -17,247 +22,201 @@ namespace kyosu::_
   //===-------------------------------------------------------------------------------------------
   //===-------------------------------------------------------------------------------------------
   //  2F1
+  //
+  //  The evaluation is split in three steps:
+  //    - hyp2_1_prepare resolves, from a, b and c only, the a <-> b swap or the Euler
+  //      transformation that brings each lane to re(c) >= re(a+b) and re(b) >= re(a),
+  //    - hyp2_1_resolve chooses for each lane the series to sum (expansion around 0, infinity,
+  //      1 or the Buhring continuation), its parameters, its argument and its prefactor,
+  //    - hyp2_1_run sums each needed series once, on the lanes that use it.
+  //  No step is recursive and each series is computed at most once per call.
   //===-------------------------------------------------------------------------------------------
   //===-------------------------------------------------------------------------------------------
+  enum class hyp2_1_series : int
+  {
+    none,
+    zero,
+    infinity,
+    one,
+    cp_rest
+  };
+
   template<typename Z> //here Z is always a complex type
-  Z hyperg2_1_internal(Z z, Z a, Z b, Z c, auto notdone, auto r) noexcept
+  struct hyp2_1_params
+  {
+    using l_t = decltype(kyosu::is_real(Z{}));
+
+    Z a, b, c;           // parameters after the swap or the Euler transformation
+    Z cab;               // c - a - b for the original parameters
+    l_t euler;           // lanes needing the (1-z)^(c-a-b) Euler prefactor
+    l_t c_negint;        // c is a non positive integer
+    l_t c_negint_ab;     // ... and a or b is a non positive integer greater than c
+    l_t negint;          // a or b is a non positive integer: the series at 0 is a polynomial
+    l_t cmb_small;       // |c-b| < 5
+    l_t abc_small;       // |a|, |b|, |c| < 5
+    l_t a_cmb_c_small;   // |a|, |c-b|, |c| < 5
+  };
+
+  template<typename Z> struct hyp2_1_plan
+  {
+    using s_t = as_real_type_t<Z>;
+
+    Z a, b, z, fac;      // the lane value is fac*series(a, b, c, z)
+    s_t series;          // hyp2_1_series value of each lane
+  };
+
+  template<typename Z> KYOSU_FORCEINLINE auto hyp2_1_is(hyp2_1_plan<Z> const& p, hyp2_1_series s) noexcept
+  {
+    using s_t = typename hyp2_1_plan<Z>::s_t;
+    return p.series == s_t(int(s));
+  }
+
+  template<typename Z> hyp2_1_params<Z> hyp2_1_prepare(Z a, Z b, Z c) noexcept
   {
     auto re_a = real(a);
     auto re_b = real(b);
     auto re_c = real(c);
-    auto ab_condition = (re_b >= re_a);
-    auto cab_condition = (re_c >= re_a + re_b);
-
-    using r_t = Z;
-    using u_t = eve::underlying_type_t<r_t>;
-    auto cinf = kyosu::cinf(as<r_t>());
-    u_t five = 5;
-    u_t thresh = u_t(1.0e-5);
-    u_t spv = 10 * eve::smallestposval(eve::as<u_t>());
     auto na = eve::nearest(re_a);
     auto nb = eve::nearest(re_b);
     auto nc = eve::nearest(re_c);
+    auto negint = [](auto x) { return is_real(x) && eve::is_lez(real(x)) && eve::is_flint(real(x)); };
 
-    auto is_a_neg_int = (a == na) && eve::is_lez(na);
-    auto is_b_neg_int = (b == nb) && eve::is_lez(nb);
-    auto is_c_neg_int = (c == nc) && eve::is_lez(nc);
-    r_t zm1 = dec(z);
-    auto z_is_one = (z == kyosu::one(as(z)));
-    r_t z_over_zm1 = z / zm1;
-    auto abs_z = kyosu::abs(z);
-    auto abs_z_over_zm1 = kyosu::abs(z_over_zm1);
-
-    auto br_c_neg_int = [&]() {
-      auto t1 = is_a_neg_int && (nc < na);
-      auto t2 = is_b_neg_int && (nc < nb);
-
-      auto test = z_is_one && abs_z < abs_z_over_zm1;
-      auto fac =
-        kyosu::if_else(t1, kyosu::if_else(test, one, kyosu::pow(-zm1, -a)),
-                       kyosu::if_else(t2, kyosu::if_else(test, one, kyosu::pow(-zm1, -b)), kyosu::nan(kyosu::as(z))));
-      auto pa = kyosu::if_else(t1, a, kyosu::if_else(t2, kyosu::if_else(test, a, b), a));
-      auto pb =
-        kyosu::if_else(t1, kyosu::if_else(test, b, c - b), kyosu::if_else(t2, kyosu::if_else(test, b, c - a), b));
-      return if_else(notdone && test, kyosu::if_else(!(t1 || t2), r, hyp_ps_zero(pa, pb, c, z_over_zm1, notdone) * fac),
-                     r);
-    };
+    hyp2_1_params<Z> q;
+    q.cab = c - a - b;
+    q.c = c;
+    q.c_negint = negint(c);
+    auto c_negint_a = (a == na) && eve::is_lez(na) && (nc < na);
+    auto c_negint_b = (b == nb) && eve::is_lez(nb) && (nc < nb);
+    q.c_negint_ab = c_negint_a || c_negint_b;
 
-    auto br_a_neg_int = [&]() { //(is_a_neg_int)
-      auto test = is_a_neg_int;
-      auto pb = kyosu::if_else(test, b, c - b);
-      auto fac = kyosu::if_else(test, one, kyosu::pow(-zm1, -a));
-      auto zz = kyosu::if_else(test, z, z_over_zm1);
-      return if_else(notdone && test, hyp_ps_zero(a, pb, c, zz, notdone && test) * fac, r);
-    };
+    auto direct = q.c_negint || negint(a) || negint(b);
+    auto ab_condition = (re_b >= re_a);
+    auto cab_condition = (re_c >= re_a + re_b);
+    // the terminating parameter of c non positive integer lanes is put in a
+    auto swap = (!direct && cab_condition && !ab_condition) || (q.c_negint && !c_negint_a && c_negint_b);
+    q.euler = !direct && !cab_condition;
+    // Euler: F(a, b, c, z) = (1-z)^(c-a-b) F(c-a, c-b, c, z) and the result is ordered as re(b) >= re(a)
+    q.a = if_else(swap, b, if_else(q.euler, if_else(ab_condition, c - b, c - a), a));
+    q.b = if_else(swap, a, if_else(q.euler, if_else(ab_condition, c - a, c - b), b));
+    q.negint = !q.c_negint && (direct || negint(q.a) || negint(q.b));
 
-    auto br_b_neg_int = [&]() { //(is_b_neg_int)
-      auto test = is_b_neg_int;
-      auto pa = kyosu::if_else(test, a, b);
-      auto pb = kyosu::if_else(test, b, c - a);
-      auto fac = kyosu::if_else(test, one, kyosu::pow(-zm1, -b));
-      auto zz = kyosu::if_else(test, z, z_over_zm1);
-      return if_else(notdone && test, hyp_ps_zero(pa, pb, c, zz, notdone && test) * fac, r);
-    };
+    constexpr auto five = eve::underlying_type_t<Z>(5);
+    auto are_ac_small = (kyosu::linfnorm(q.a) < five) && (kyosu::linfnorm(c) < five);
+    q.cmb_small = (kyosu::linfnorm(c - q.b) < five);
+    q.abc_small = are_ac_small && (kyosu::linfnorm(q.b) < five);
+    q.a_cmb_c_small = are_ac_small && q.cmb_small;
+    return q;
+  }
 
-    auto br_cab_and_notab = [&](auto test) { //if cab_condition && !ab_condition
-      auto tt = notdone && test;
-      auto aa = if_else(tt, b, a);
-      auto bb = if_else(tt, a, b);
-      return if_else(notdone && test, hyperg2_1_internal(z, aa, bb, c, notdone && test, r), r);
-    };
+  // parameters prepared for scalar a, b and c, broadcast to the type W of the arguments
+  template<typename W, typename Z> hyp2_1_params<W> hyp2_1_splat(hyp2_1_params<Z> const& q) noexcept
+  {
+    using l_t = typename hyp2_1_params<W>::l_t;
+    auto l = [](auto m) { return l_t(eve::all(m)); };
+    return {W(q.a), W(q.b), W(q.c), W(q.cab), l(q.euler), l(q.c_negint),
+            l(q.c_negint_ab), l(q.negint), l(q.cmb_small), l(q.abc_small), l(q.a_cmb_c_small)};
+  }
 
-    auto br_notcab_and_ab = [&](auto test) { //if !cab_condition && ab_condition
-      return if_else(notdone && test,
-                     kyosu::pow(-zm1, c - a - b) * hyperg2_1_internal(z, c - b, c - a, c, notdone && test, r), r);
-    };
+  template<typename Z> hyp2_1_plan<Z> hyp2_1_resolve(hyp2_1_params<Z> const& q, Z z) noexcept
+  {
+    using u_t = eve::underlying_type_t<Z>;
+    using s_t = typename hyp2_1_plan<Z>::s_t;
 
-    auto br_notcab_and_notab = [&](auto test) { //if !cab_condition && !ab_condition
-      return if_else(notdone && test, pow(-zm1, c - a - b) * hyperg2_1_internal(z, c - a, c - b, c, notdone && test, r),
-                     r);
-    };
+    Z zm1 = dec(z);
+    Z z_over_zm1 = z / zm1;
+    auto abs_z = kyosu::abs(z);
+    auto abs_zm1 = kyosu::abs(zm1);
+    auto abs_z_inv = eve::rec[eve::pedantic](abs_z);
+    auto abs_z_over_zm1 = abs_z / abs_zm1;
+    auto abs_zm1_inv = eve::rec[eve::pedantic](abs_zm1);
+    auto abs_zm1_over_z = eve::rec[eve::pedantic](abs_z_over_zm1);
 
-    auto br_small_zm1 = [&](auto test, auto zm1) { // zm1 < thresh
-      auto tzm1 = kyosu::if_else(test, zm1, thresh / 2);
-      r = if_else(notdone && test, hyp_ps_one(a, b, c, -tzm1), r);
-      return r;
-    };
+    hyp2_1_plan<Z> p{q.a, q.b, z, kyosu::one(as(z)), s_t(int(hyp2_1_series::cp_rest))};
+    auto flip = kyosu::false_(eve::as<Z>()); // series taken at z/(z-1) with parameters a, c-b and prefactor (1-z)^-a
+    auto todo = kyosu::true_(eve::as<Z>());
 
-    auto br_rest = [&]() {
-      auto abs_zm1 = abs(zm1);
-      auto abs_z_inv = eve::rec[eve::pedantic](abs_z);
-      auto abs_z_over_zm1 = abs_z / abs_zm1;
-      auto abs_zm1_inv = eve::rec[eve::pedantic](abs_zm1);
-      auto abs_zm1_over_z = eve::rec[eve::pedantic](abs_z_over_zm1);
-      auto are_ac_small = (kyosu::linfnorm(a) < five) && (kyosu::linfnorm(c) < five);
-      auto is_cmb_small = (kyosu::linfnorm(c - b) < five);
-      auto are_abc_small = are_ac_small && (kyosu::linfnorm(b) < five);
-      auto are_a_cmb_c_small = are_ac_small && is_cmb_small;
-
-      auto br_R1 = [&](auto test, auto RR) { // (abs_z <= RR)
-        auto zt = kyosu::if_else(test, z, zero);
-        r = if_else(test && notdone, hyp_ps_zero(a, b, c, z, test && notdone && test), r);
-        return r;
-      };
-
-      auto br_R2 = [&](auto test, auto RR) { // (is_cmb_small && (abs_z_over_zm1 <= RR))
-        auto zt = kyosu::if_else(test, z, zero);
-        r = if_else(notdone && test, kyosu::pow(-zm1, -a) * hyp_ps_zero(a, c - b, c, zt / dec(zt), notdone && test), r);
-        return r;
-      };
-
-      auto br_R3 = [&](auto test, auto RR) { // (abs_z_inv <= R)
-        auto zt = kyosu::if_else(test, z, kyosu::nan(as(z)));
-        r = if_else(notdone && test, hyp_ps_infinity(a, b, c, zt, notdone && test), r);
-        return r;
-      };
-
-      auto br_R4 = [&](auto test, auto RR) { // (is_cmb_small && (abs_zm1_over_z <= R))
-        auto z_over_zm1t = kyosu::if_else(test, z_over_zm1, u_t(0.5));
-        r = if_else(notdone && test, pow(-zm1, -a) * hyp_ps_infinity(a, c - b, c, z_over_zm1t, notdone && test), r);
-        return r;
-      };
-
-      auto br_R5 = [&](auto test, auto RR) { // (are_abc_small && (abs_zm1 <= R))
-        auto zm1t = kyosu::if_else(test, zm1, u_t(0.4));
-        r = if_else(notdone && test, hyp_ps_one(a, b, c, -zm1t), r);
-        return r;
-      };
-
-      auto br_R6 = [&](auto test, auto RR) { // (are_a_cmb_c_small && (abs_zm1_inv <= R))
-        auto zm1t = kyosu::if_else(test, zm1, u_t(3.0));
-        r = if_else(notdone && test, hyp_ps_one(a, b, c, -kyosu::rec(zm1t)), r);
-        return r;
-      };
-
-      auto br_last = [&]() {
-        r = if_else(notdone, hyp_ps_cp_rest(a, b, c, z, notdone), r);
-        return r;
-      };
-
-      if (eve::any(notdone))
-      {
-        constexpr u_t zp9 = u_t(0.9);
-        constexpr u_t zp5 = u_t(0.5);
-        constexpr u_t zp1 = u_t(0.1);
-        if (eve::any(abs_z <= zp9 || (is_cmb_small && (abs_z_over_zm1 <= zp9))))
-        {
-          for (u_t R = zp5; R <= zp9; R += zp1)
-          {
-            if (eve::any(notdone))
-            {
-              auto t1 = (abs_z <= R);
-              notdone = next_interval(br_R1, notdone, t1, r, t1, R);
-              if (eve::any(notdone))
-              {
-                auto t2 = (is_cmb_small && (abs_z_over_zm1 <= R));
-                notdone = next_interval(br_R2, notdone, t2, r, t2, R);
-              }
-              if (eve::none(notdone)) return r;
-            }
-          }
-        }
-        if (eve::any((abs_z_inv <= zp9) || (is_cmb_small && (abs_zm1_over_z <= zp9)) ||
-                     (are_abc_small && (abs_zm1_inv <= zp9)) || (are_a_cmb_c_small && (abs_zm1_inv <= zp9))))
-        {
-          for (u_t R = zp5; R <= zp9; R += zp1)
-          {
-            if (eve::any(notdone))
-            {
-              auto t3 = (abs_z_inv <= R);
-              notdone = next_interval(br_R3, notdone, t3, r, t3, R);
-              if (eve::any(notdone))
-              {
-                auto t4 = (is_cmb_small && (abs_zm1_over_z <= R));
-                notdone = next_interval(br_R4, notdone, t4, r, t4, R);
-                if (eve::any(notdone))
-                {
-                  auto t5 = (are_abc_small && (abs_zm1_inv <= R));
-                  notdone = next_interval(br_R5, notdone, t5, r, t5, R);
-                  if (eve::any(notdone))
-                  {
-                    auto t6 = (are_a_cmb_c_small && (abs_zm1_inv <= R));
-                    notdone = next_interval(br_R6, notdone, t6, r, t6, R);
-                  }
-                }
-              }
-            }
-          }
-          if (eve::none(notdone)) { return r; }
-        }
-        if (eve::any(notdone)) { last_interval(br_last, notdone, r); }
-      }
-      return r;
+    auto pick = [&](auto test, hyp2_1_series s, auto arg, auto flipped) {
+      auto t = todo && test;
+      p.series = if_else(t, s_t(int(s)), p.series);
+      p.z = if_else(t, arg, p.z);
+      if (flipped) flip = flip || t;
+      todo = todo && !t;
     };
 
-    if (eve::any(notdone))
+    // c non positive integer: only defined if the series terminates before the pole
+    auto z_test = (z == kyosu::one(as(z))) || (abs_z < kyosu::abs(z_over_zm1));
+    pick(q.c_negint && q.c_negint_ab && z_test, hyp2_1_series::zero, z, false);
+    pick(q.c_negint && q.c_negint_ab, hyp2_1_series::zero, z_over_zm1, true);
+    pick(q.c_negint, hyp2_1_series::none, z, false);
+    pick(q.negint, hyp2_1_series::zero, z, false);
+
+    if (eve::any(todo))
     {
-      auto t1 = (is_real(c) && eve::is_lez(real(c)) && is_flint(real(c)));
-      notdone = next_interval(br_c_neg_int, notdone, t1, r);
-      if (eve::any(notdone))
+      constexpr u_t zp9 = u_t(0.9);
+      constexpr u_t zp5 = u_t(0.5);
+      constexpr u_t zp1 = u_t(0.1);
+      // the series of smallest radius ratio is chosen, around 0 first, then around infinity and 1
+      for (u_t R = zp5; R <= zp9; R += zp1)
+      {
+        pick(abs_z <= R, hyp2_1_series::zero, z, false);
+        pick(q.cmb_small && (abs_z_over_zm1 <= R), hyp2_1_series::zero, z_over_zm1, true);
+      }
+      for (u_t R = zp5; R <= zp9; R += zp1)
       {
-        auto t2 = (is_real(a) && eve::is_lez(real(a)) && is_flint(real(a)));
-        notdone = next_interval(br_a_neg_int, notdone, t2, r);
-        if (eve::any(notdone))
-        {
-          auto t3 = (is_real(b) && eve::is_lez(real(b)) && eve::is_flint(real(b)));
-          notdone = next_interval(br_b_neg_int, notdone, t3, r);
-          if (eve::any(notdone))
-          {
-            auto t61 = cab_condition && !ab_condition;
-            notdone = next_interval(br_cab_and_notab, notdone, t61, r, t61);
-            if (eve::any(notdone))
-            {
-              auto t62 = !cab_condition && ab_condition;
-              notdone = next_interval(br_notcab_and_ab, notdone, t62, r, t62);
-              if (eve::any(notdone))
-              {
-                auto t63 = !cab_condition && !ab_condition;
-                notdone = next_interval(br_notcab_and_notab, notdone, t63, r, t63);
-                if (eve::any(notdone)) { notdone = next_interval(br_rest, notdone, notdone, r); }
-              }
-            }
-          }
-        }
+        pick(abs_z_inv <= R, hyp2_1_series::infinity, z, false);
+        pick(q.cmb_small && (abs_zm1_over_z <= R), hyp2_1_series::infinity, z_over_zm1, true);
+        pick(q.abc_small && (abs_zm1_inv <= R), hyp2_1_series::one, -zm1, false);
+        pick(q.a_cmb_c_small && (abs_zm1_inv <= R), hyp2_1_series::one, -kyosu::rec(zm1), false);
       }
     }
-    return r;
+
+    if (eve::any(flip))
+    {
+      p.b = if_else(flip, q.c - q.b, p.b);
+      p.fac = if_else(flip, kyosu::pow(-zm1, -q.a), p.fac);
+    }
+    if (eve::any(q.euler)) p.fac = if_else(q.euler, kyosu::pow(-zm1, q.cab), one) * p.fac;
+    return p;
+  }
+
+  template<typename Z> Z hyp2_1_run(Z c, hyp2_1_plan<Z> const& p) noexcept
+  {
+    using u_t = eve::underlying_type_t<Z>;
+    Z r(kyosu::fnan(eve::as<u_t>()));
+
+    // inactive lanes get an argument for which the series ends at once
+    auto run = [&](hyp2_1_series s, auto series, auto inactive) {
+      auto t = hyp2_1_is(p, s);
+      if (eve::any(t)) r = if_else(t, series(if_else(t, p.z, inactive), t), r);
+    };
+    run(hyp2_1_series::zero, [&](auto z, auto t) { return hyp_ps_zero(p.a, p.b, c, z, t); }, zero);
+    run(hyp2_1_series::infinity, [&](auto z, auto t) { return hyp_ps_infinity(p.a, p.b, c, z, t); }, u_t(10));
+    run(hyp2_1_series::one, [&](auto z, auto) { return hyp_ps_one(p.a, p.b, c, z); }, u_t(-0.4));
+    run(hyp2_1_series::cp_rest, [&](auto z, auto t) { return hyp_ps_cp_rest(p.a, p.b, c, z, t); }, u_t(0.5));
+    return r * p.fac;
+  }
+
+  template<typename Z> //here Z is always a complex type
+  Z hyperg2_1_internal(Z z, Z a, Z b, Z c) noexcept
+  {
+    return hyp2_1_run(c, hyp2_1_resolve(hyp2_1_prepare(a, b, c), z));
+  }
+
+  // next function ensures the right cut in complex plane
+  template<typename Z> KYOSU_FORCEINLINE Z hyp2_1_cut(Z z) noexcept
+  {
+    return if_else(is_real(z) && eve::is_greater(real(z), eve::one(kyosu::as_real(z))),
+                   Z(real(z), eve::mzero(kyosu::as_real(z))), z);
   }
 
   template<typename Z, eve::sized_product_type<2> T1, eve::sized_product_type<1> T2>
   auto hyperg(Z z0, T1 aa, T2 bb) noexcept -> decltype(kumi::get<0>(T1()) + kumi::get<0>(T2()) + z0)
   {
     using r_t = decltype(kumi::get<0>(T1()) + kumi::get<0>(T2()) + z0);
-    using u_t = eve::underlying_type_t<r_t>;
     r_t a(kumi::get<0>(aa));
     r_t b(kumi::get<1>(aa));
     r_t c(kumi::get<0>(bb));
-    r_t z(z0);
-    // next line to ensure the right cut in complex plane
-    z = if_else(is_real(z) && eve::is_greater(real(z), eve::one(kyosu::as_real(z))),
-                r_t(real(z), eve::mzero(kyosu::as_real(z))), z);
-    r_t r = r_t(kyosu::fnan(eve::as<u_t>()));
-    auto notdone = kyosu::true_(eve::as<r_t>());
-    return hyperg2_1_internal(z, a, b, c, notdone, r);
+    return hyperg2_1_internal(hyp2_1_cut(r_t(z0)), a, b, c);
   }
 
   template<typename Z, eve::sized_product_type<2> T1, eve::sized_product_type<1> T2>
@@ -265,18 +224,79 @@ namespace kyosu::_
     -> decltype(kumi::get<0>(T1()) + kumi::get<0>(T2()) + z0)
   {
     using r_t = decltype(kumi::get<0>(T1()) + kumi::get<0>(T2()) + z0);
-    using u_t = eve::underlying_type_t<r_t>;
     r_t a(kumi::get<0>(aa));
     r_t b(kumi::get<1>(aa));
     r_t c(kumi::get<0>(bb));
     //if c is a negative integer the value is computed by continuity.
     c = if_else(is_negint(c), eve::next(real(c)), c);
-    r_t z(z0);
-    // next line to ensure the right cut in complex plane
-    z = if_else(is_real(z) && eve::is_greater(real(z), eve::one(kyosu::as_real(z))),
-                r_t(real(z), eve::mzero(kyosu::as_real(z))), z);
-    r_t r = r_t(kyosu::fnan(eve::as<u_t>()));
-    auto notdone = kyosu::true_(eve::as<r_t>());
-    return hyperg2_1_internal(z, a, b, c, notdone, r) * tgamma_inv(c);
+    return hyperg2_1_internal(hyp2_1_cut(r_t(z0)), a, b, c) * tgamma_inv(c);
+  }
+
+  //===-------------------------------------------------------------------------------------------
+  //  Batch evaluation over contiguous ranges sharing the same parameters: the points are first
+  //  grouped by series, so that each SIMD chunk sums a single series on all its lanes.
+  //===-------------------------------------------------------------------------------------------
+  template<typename W, typename Z, std::size_t S1, typename R, std::size_t S2>
+  void hyp2_1_batch(hyp2_1_params<W> const& q, std::span<Z, S1> zs, std::span<R, S2> rs)
+  {
+    using w_t = W;
+    constexpr std::size_t card = w_t::size();
+    constexpr std::size_t nseries = std::size_t(hyp2_1_series::cp_rest) + 1;
+    auto const n = std::min(zs.size(), rs.size());
+    if (n == 0) return;
+
+    auto gather = [&](auto at) { return w_t([&](auto j, auto) { return hyp2_1_cut(R(zs[at(std::size_t(j))])); }); };
+
+    // series used by each point
+    std::vector<std::uint8_t> kind(n);
+    for (std::size_t i = 0; i < n; i += card)
+    {
+      auto p = hyp2_1_resolve(q, gather([&](std::size_t j) { return std::min(i + j, n - 1); }));
+      for (std::size_t j = 0; j < card && i + j < n; ++j) kind[i + j] = std::uint8_t(p.series.get(j));
+    }
+
+    // counting sort of the points by series
+    std::array<std::size_t, nseries + 1> start{};
+    for (auto k : kind) ++start[k + 1];
+    for (std::size_t s = 0; s < nseries; ++s) start[s + 1] += start[s];
+    std::vector<std::size_t> idx(n);
+    auto pos = start;
+    for (std::size_t i = 0; i < n; ++i) idx[pos[kind[i]]++] = i;
+
+    for (std::size_t s = 0; s < nseries; ++s)
+    {
+      if (start[s] == start[s + 1]) continue;
+      auto const last = start[s + 1] - 1;
+      for (std::size_t i = start[s]; i <= last; i += card)
+      {
+        auto zz = gather([&](std::size_t j) { return idx[std::min(i + j, last)]; });
+        auto r = hyp2_1_run(q.c, hyp2_1_resolve(q, zz));
+        for (std::size_t j = 0; j < card && i + j <= last; ++j) rs[idx[i + j]] = r.get(j);
+      }
+    }
+  }
+
+  template<typename Z, std::size_t S1, typename R, std::size_t S2>
+  void hyperg2_1_batch(std::span<Z, S1> zs, R a, R b, R c, std::span<R, S2> rs)
+  {
+    using w_t = eve::wide<R>;
+    hyp2_1_batch(hyp2_1_prepare(w_t(a), w_t(b), w_t(c)), zs, rs);
+  }
+
+  template<typename Z, std::size_t S1, eve::sized_product_type<2> T1, eve::sized_product_type<1> T2, typename R, std::size_t S2>
+  void hyperg(std::span<Z, S1> zs, T1 aa, T2 bb, std::span<R, S2> rs)
+  {
+    hyperg2_1_batch(zs, R(kumi::get<0>(aa)), R(kumi::get<1>(aa)), R(kumi::get<0>(bb)), rs);
+  }
+
+  template<typename Z, std::size_t S1, eve::sized_product_type<2> T1, eve::sized_product_type<1> T2, typename R, std::size_t S2>
+  void hyperg(std::span<Z, S1> zs, T1 aa, T2 bb, std::span<R, S2> rs, decltype(kyosu::regularized))
+  {
+    R c(kumi::get<0>(bb));
+    //if c is a negative integer the value is computed by continuity.
+    c = if_else(is_negint(c), eve::next(real(c)), c);
+    hyperg2_1_batch(zs, R(kumi::get<0>(aa)), R(kumi::get<1>(aa)), c, rs);
+    auto fac = tgamma_inv(c);
+    for (std::size_t i = 0; i < std::min(zs.size(), rs.size()); ++i) rs[i] *= fac;
   }
 }
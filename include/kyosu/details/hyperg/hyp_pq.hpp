@@ -0,0 +1,170 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/functions/linfnorm.hpp>
+#include <kyosu/functions/tgamma_inv.hpp>
+#include <kyosu/constants/wrapped.hpp>
+#include <kyosu/details/hyperg/is_negint.hpp>
+#include <kyosu/details/instrument.hpp>
+#include <array>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //===-------------------------------------------------------------------------------------------
+  //   hypergeometric pFq for p or q in ]2, 6]
+  //
+  //   The series is summed directly using the term ratio
+  //      t_k+1/t_k = z (a_1+k)...(a_p+k)/((b_1+k)...(b_q+k)(k+1))
+  //   Lanes for which it converges too slowly (p = q+1 and |z| close to 1) or diverges
+  //   (p = q+1 and |z| >= 1, p > q+1) are summed from their first K terms by the Levin u and
+  //   Weniger delta sequence transformations, keeping the one with the smallest error estimate.
+  //===-------------------------------------------------------------------------------------------
+  //===-------------------------------------------------------------------------------------------
+  template<typename... Ts> struct hyp_pq_result : as_cayley_dickson<Ts...>
+  {
+  };
+
+  // Coefficients of the Levin u (levin = true) and Weniger delta recurrences, with beta = 1:
+  //    N_k+1(n) = N_k(n+1) - c[k][n] N_k(n)
+  template<typename U, int K> constexpr auto hyp_pq_transform_coefficients(bool levin)
+  {
+    std::array<std::array<U, K>, K> c{};
+    for (int k = 0; k < K; ++k)
+      for (int n = 0; n + k < K; ++n)
+      {
+        double b = 1.0 + n;
+        double r = 1.0;
+        if (levin)
+        {
+          // (b)(b+k)^(k-1)/(b+k+1)^k
+          for (int i = 0; i < k; ++i) r *= (b + k) / (b + k + 1);
+          r *= b / (b + k);
+        }
+        else if (k > 0) r = ((b + k) * (b + k - 1)) / ((b + 2 * k) * (b + 2 * k - 1));
+        c[k][n] = U(r);
+      }
+    return c;
+  }
+
+  // returns the transformed estimate of the series and an estimation of its error
+  template<int K, typename R, typename C>
+  KYOSU_FORCEINLINE auto hyp_pq_transform(std::array<R, K + 1> const& s, std::array<R, K + 1> const& w, C const& c)
+  {
+    std::array<R, K + 1> num, den;
+    for (int n = 0; n <= K; ++n)
+    {
+      den[n] = kyosu::rec(w[n]);
+      num[n] = s[n] * den[n];
+    }
+    R prev{};
+    for (int k = 0; k < K; ++k)
+    {
+      if (k == K - 1) prev = num[0] / den[0];
+      for (int n = 0; n + k < K; ++n)
+      {
+        num[n] = num[n + 1] - c[k][n] * num[n];
+        den[n] = den[n + 1] - c[k][n] * den[n];
+      }
+    }
+    R r = num[0] / den[0];
+    return kumi::tuple{r, kyosu::linfnorm(r - prev)};
+  }
+
+  template<typename Z, eve::product_type T1, eve::product_type T2>
+  requires((kumi::size_v<T1> > 2 || kumi::size_v<T2> > 2) && kumi::size_v<T1> <= 6 && kumi::size_v<T2> <= 6)
+  auto hyperg(Z zz, T1 aa, T2 bb)
+  {
+    using r_t = complexify_t<kumi::apply_traits_t<hyp_pq_result, kumi::result::cat_t<T1, T2, kumi::tuple<Z>>>>;
+    using u_t = eve::underlying_type_t<r_t>;
+    constexpr std::size_t p = kumi::size_v<T1>;
+    constexpr std::size_t q = kumi::size_v<T2>;
+    constexpr int K = sizeof(u_t) == 8 ? 20 : 12;
+    constexpr std::size_t Direct = 1000;
+    constexpr std::size_t Maxit = 100000;
+    auto tol = eve::eps(eve::as<u_t>());
+
+    r_t z(zz);
+    auto a = kumi::map([](auto x) { return r_t(x); }, aa);
+    auto b = kumi::map([](auto x) { return r_t(x); }, bb);
+
+    // a non positive integer a_i ends the summation, a non positive integer b_j not preceded by one is a pole
+    auto terminating = kumi::fold_left([](auto m, auto ai) { return m || is_negint(ai); }, a, kyosu::false_(as<r_t>()));
+    auto pole = kumi::fold_left(
+      [&](auto m, auto bj) {
+        auto cancelled = kumi::fold_left([&](auto c, auto ai) { return c || (is_negint(ai) && (real(ai) > real(bj))); },
+                                         a, kyosu::false_(as<r_t>()));
+        return m || (is_negint(bj) && !cancelled);
+      },
+      b, kyosu::false_(as<r_t>()));
+
+    auto convergent = terminating || kyosu::is_eqz(z);
+    if constexpr (p <= q) convergent = kyosu::true_(as<r_t>());
+    else if constexpr (p == q + 1) convergent = convergent || (kyosu::abs(z) < u_t(1));
+
+    r_t t(1), s(1);
+    std::array<r_t, K + 2> ts;
+    std::array<r_t, K + 1> ss;
+    ts[0] = t;
+    ss[0] = s;
+    auto converged = kyosu::false_(as<r_t>());
+    auto smallp = converged;
+    std::size_t k = 0;
+    for (; k < Maxit; ++k)
+    {
+      auto num = kumi::fold_left([k](auto m, auto ai) { return m * (ai + u_t(k)); }, a, z);
+      auto den = kumi::fold_left([k](auto m, auto bj) { return m * (bj + u_t(k)); }, b, r_t(u_t(k + 1)));
+      // a terminated series is exact: its next ratios may be 0/0 or 1/0 when a pole is cancelled
+      auto ended = terminating && kyosu::is_eqz(t);
+      t = kyosu::if_else(ended, r_t(0), t * (num / den));
+      s += t;
+      if (k + 1 <= K + 1) ts[k + 1] = t;
+      if (k + 1 <= K) ss[k + 1] = s;
+      auto small = kyosu::linfnorm(t) <= kyosu::linfnorm(s) * tol;
+      converged = converged || ended || (small && smallp);
+      smallp = small;
+      auto stop = converged || pole || (!convergent && (k > K));
+      if constexpr (p == q + 1) stop = stop || (k >= Direct);
+      if (eve::all(stop)) break;
+    }
+    KYOSU_INSTRUMENT_ITERATIONS("hypergeometric", "series", std::min(k + 1, Maxit));
+    KYOSU_INSTRUMENT_BRANCH("hypergeometric", "pole", pole);
+
+    r_t r = kyosu::if_else(converged, s, r_t(kyosu::fnan(eve::as<u_t>())));
+    auto accelerate = !converged && !pole && !terminating;
+    KYOSU_INSTRUMENT_BRANCH("hypergeometric", "acceleration", accelerate);
+    if (eve::any(accelerate))
+    {
+      constexpr auto levin = hyp_pq_transform_coefficients<u_t, K>(true);
+      constexpr auto delta = hyp_pq_transform_coefficients<u_t, K>(false);
+      std::array<r_t, K + 1> wu, wd;
+      for (int n = 0; n <= K; ++n)
+      {
+        wu[n] = u_t(n + 1) * ts[n];
+        wd[n] = ts[n + 1];
+      }
+      auto [ru, eu] = hyp_pq_transform<K>(ss, wu, levin);
+      auto [rd, ed] = hyp_pq_transform<K>(ss, wd, delta);
+      auto ra = kyosu::if_else(eu <= ed, ru, rd);
+      auto ea = eve::min(eu, ed);
+      auto ok = accelerate && (ea <= eve::sqrt(tol) * kyosu::linfnorm(ra));
+      r = kyosu::if_else(ok, ra, r);
+    }
+    return kyosu::if_else(pole, kyosu::cinf(eve::as<r_t>()), r);
+  }
+
+  template<typename Z, eve::product_type T1, eve::product_type T2>
+  requires((kumi::size_v<T1> > 2 || kumi::size_v<T2> > 2) && kumi::size_v<T1> <= 6 && kumi::size_v<T2> <= 6)
+  auto hyperg(Z z, T1 aa, T2 bb, decltype(kyosu::regularized))
+  {
+    //if some b_j is a negative integer the value is computed by continuity.
+    auto b = kumi::map([](auto x) { return if_else(is_negint(x), eve::next(real(x)), x); }, bb);
+    auto g = kumi::fold_left([](auto m, auto bj) { return m * tgamma_inv(bj); }, b, decltype(tgamma_inv(kumi::get<0>(b)))(1));
+    return hyperg(z, aa, b) * g;
+  }
+}
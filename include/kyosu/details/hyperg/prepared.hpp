@@ -0,0 +1,258 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/constants/cinf.hpp>
+#include <kyosu/constants/fnan.hpp>
+#include <kyosu/details/hyperg/hyp2_1/hyp2_1_base.hpp>
+#include <kyosu/functions/digamma.hpp>
+#include <kyosu/functions/is_flint.hpp>
+#include <kyosu/functions/is_not_fnan.hpp>
+#include <kyosu/functions/linfnorm.hpp>
+#include <kyosu/functions/log.hpp>
+#include <kyosu/functions/pow.hpp>
+#include <kyosu/functions/tgamma.hpp>
+#include <kyosu/functions/tgamma_inv.hpp>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Prepared evaluations of 1F1 and U for scalar parameters
+  //
+  //  Everything that depends on the parameters only is computed once: the branch taken, the
+  //  gamma and digamma factors, and the ratios of consecutive terms of the series. The loops
+  //  over z are then reduced to products and additions.
+  //===-------------------------------------------------------------------------------------------
+  enum class hyp1_1_kind : int
+  {
+    pole,
+    polynomial,
+    series
+  };
+
+  template<typename C> struct hyp1_1_params
+  {
+    static constexpr std::size_t tabulated = 64;
+
+    C a, b;
+    hyp1_1_kind kind = hyp1_1_kind::series;
+    int n = 0;                   // degree of the polynomial
+    std::array<C, tabulated> rho; // rho[j] = (a+j) / ((b+j) (j+1)), ratio of the terms j+1 and j
+
+    C ratio(std::size_t j) const noexcept
+    {
+      using u_t = as_real_type_t<C>;
+      return j < tabulated ? rho[j] : (a + u_t(j)) / ((b + u_t(j)) * u_t(j + 1));
+    }
+  };
+
+  // same branches as hyperg(z, {a}, {b})
+  template<typename C> hyp1_1_params<C> hyp1_1_prepare(C a, C b) noexcept
+  {
+    using u_t = as_real_type_t<C>;
+    hyp1_1_params<C> q{a, b};
+    bool anegint = eve::all(kyosu::is_flint(a) && eve::is_lez(real(a)));
+    bool bnegint = eve::all(kyosu::is_flint(b) && eve::is_lez(real(b)));
+    if (bnegint && (!anegint || (real(a) < real(b)))) q.kind = hyp1_1_kind::pole;
+    else if (anegint)
+    {
+      q.kind = hyp1_1_kind::polynomial;
+      q.n = int(-real(a));
+    }
+    for (std::size_t j = 0; j < q.tabulated; ++j) q.rho[j] = (a + u_t(j)) / ((b + u_t(j)) * u_t(j + 1));
+    return q;
+  }
+
+  template<typename C, typename Z> Z hyp1_1_run(hyp1_1_params<C> const& q, Z z) noexcept
+  {
+    using u_t = eve::underlying_type_t<Z>;
+    if (q.kind == hyp1_1_kind::pole) return kyosu::cinf(eve::as<Z>());
+    if (q.kind == hyp1_1_kind::polynomial)
+    {
+      Z a1(1), s(1);
+      for (int j = 0; j < q.n; ++j)
+      {
+        a1 *= Z(q.ratio(j)) * z;
+        s += a1;
+      }
+      return s;
+    }
+
+    auto tol = eve::eps(eve::as<u_t>());
+    constexpr std::size_t Maxit = 100000;
+    auto zr1 = z * Z(q.rho[0]);
+    Z s1 = kyosu::inc(zr1);
+    Z s2 = s1 + zr1 * z * Z(q.rho[1]);
+    Z s3{};
+    auto smallp = kyosu::false_(as<Z>());
+    for (std::size_t j = 2; j < Maxit; ++j)
+    {
+      s3 = s2 + (s2 - s1) * (Z(q.ratio(j)) * z);
+      auto small = kyosu::linfnorm[kyosu::flat](s3 - s2) < kyosu::linfnorm[kyosu::flat](s1) * tol;
+      if (eve::all(small && smallp)) return s3;
+      s1 = s2;
+      s2 = s3;
+      smallp = small;
+    }
+    return if_else(smallp, s3, allbits);
+  }
+
+  //===-------------------------------------------------------------------------------------------
+  //  U(a, b, z) with the branches of tricomi_:
+  //    - |z| > 50: the expansion at infinity, z^-a sum (a)_k (a-b+1)_k (-1/z)^k / k!, capped at
+  //      Maxit terms where tricomi_ sums until convergence,
+  //    - b positive integer n: the logarithmic expansion (DLMF 13.2.9),
+  //    - otherwise: the combination of two 1F1 (DLMF 13.2.42).
+  //===-------------------------------------------------------------------------------------------
+  template<typename C> struct tricomi_params
+  {
+    static constexpr std::size_t tabulated = 128;
+    static constexpr std::size_t Maxit = 500;
+
+    C a, b;
+    std::array<C, tabulated> large; // -(a+k) (a-b+1+k) / (k+1), ratio of the terms k+1 and k at infinity
+    bool bpflint = false;
+
+    // b positive integer n
+    C fac, gn, s0;              // (-1)^n / gamma(a-n+1), 1 / gamma(n), first term of the second sum
+    std::vector<C> q2, d2, c3;  // ratios and digamma differences of the second sum, coefficients of the third
+    hyp1_1_params<C> m_an;      // 1F1(a; n; z)
+
+    // other b
+    C f1, f2;                   // gamma(b-1) / gamma(a), gamma(1-b) / gamma(a-b+1)
+    hyp1_1_params<C> m_1, m_2;  // 1F1(a-b+1; 2-b; z), 1F1(a; b; z)
+
+    C large_ratio(std::size_t k) const noexcept
+    {
+      using u_t = as_real_type_t<C>;
+      return k < tabulated ? large[k] : -(a + u_t(k)) * (a - b + u_t(k + 1)) / u_t(k + 1);
+    }
+  };
+
+  template<typename C> tricomi_params<C> tricomi_prepare(C a, C b)
+  {
+    using u_t = as_real_type_t<C>;
+    tricomi_params<C> q{a, b};
+    for (std::size_t k = 0; k < q.tabulated; ++k) q.large[k] = -(a + u_t(k)) * (a - b + u_t(k + 1)) / u_t(k + 1);
+    q.bpflint = eve::all(kyosu::is_real(b) && eve::is_flint(real(b)) && eve::is_gtz(real(b)));
+    if (q.bpflint)
+    {
+      auto n = real(b);
+      q.fac = eve::sign_alternate(n) * kyosu::tgamma_inv(kyosu::inc(a - n));
+      q.gn = C(kyosu::tgamma_inv(n));
+      q.m_an = hyp1_1_prepare(a, C(n));
+
+      // second sum: sum (a)_k (psi(a+k) - psi(k+1) - psi(n+k)) z^k / ((k+n-1)! k!)
+      auto haa = a;
+      auto h1 = u_t(1);
+      auto hn = n;
+      auto daa = kyosu::digamma(haa);
+      auto d1 = kyosu::digamma(h1);
+      auto dn = kyosu::digamma(hn);
+      q.s0 = q.gn * (daa - d1 - dn);
+      q.q2.resize(q.Maxit);
+      q.d2.resize(q.Maxit);
+      for (std::size_t k = 1; k <= q.Maxit; ++k)
+      {
+        q.q2[k - 1] = (a + u_t(k - 1)) / ((n + u_t(k - 1)) * u_t(k));
+        daa += kyosu::rec(haa++);
+        d1 += eve::rec(h1++);
+        dn += eve::rec(hn++);
+        q.d2[k - 1] = daa - d1 - dn;
+      }
+
+      // third sum: - sum_1^(n-1) (k-1)! z^-k / ((1-a)_k (n-k-1)!)
+      auto oma = kyosu::oneminus(a);
+      auto aak = oma;
+      for (int k = 1; k < int(n); ++k)
+      {
+        q.c3.push_back(kyosu::tgamma(u_t(k)) / (aak * kyosu::tgamma(n - k)));
+        aak *= oma + u_t(k);
+      }
+    }
+    else
+    {
+      q.f1 = kyosu::tgamma(kyosu::dec(b)) * kyosu::tgamma_inv(a);
+      q.f2 = kyosu::tgamma(kyosu::oneminus(b)) * kyosu::tgamma_inv(kyosu::inc(a - b));
+      q.m_1 = hyp1_1_prepare(kyosu::inc(a - b), 2 - b);
+      q.m_2 = hyp1_1_prepare(a, b);
+    }
+    return q;
+  }
+
+  // expansion at infinity, iz = 1/z
+  template<typename C, typename Z> Z tricomi_large(tricomi_params<C> const& q, Z iz) noexcept
+  {
+    using u_t = eve::underlying_type_t<Z>;
+    auto tol = eve::eps(eve::as<u_t>());
+    auto t = kyosu::pow(iz, Z(q.a));
+    auto s = t;
+    auto test = kyosu::false_(eve::as(iz));
+    for (std::size_t k = 0; k < q.Maxit; ++k)
+    {
+      t *= Z(q.large_ratio(k)) * iz;
+      s += kyosu::if_else(test, zero, t);
+      test = kyosu::linfnorm[kyosu::flat](t) <= kyosu::linfnorm[kyosu::flat](s) * tol;
+      if (eve::all(test)) break;
+    }
+    return s;
+  }
+
+  // b positive integer
+  template<typename C, typename Z> Z tricomi_bpflint(tricomi_params<C> const& q, Z z) noexcept
+  {
+    using u_t = eve::underlying_type_t<Z>;
+    auto tol = eve::eps(eve::as<u_t>());
+    auto t1 = kyosu::log(z) * Z(q.gn) * hyp1_1_run(q.m_an, z);
+
+    auto t2 = [&]() {
+      Z fac(q.gn);
+      Z s(q.s0);
+      auto small = kyosu::false_(eve::as(z));
+      for (std::size_t k = 0; k < q.Maxit; ++k)
+      {
+        fac *= Z(q.q2[k]) * z;
+        auto t = fac * Z(q.d2[k]);
+        s += if_else(small, zero, t);
+        small = kyosu::linfnorm[kyosu::flat](t) <= kyosu::linfnorm[kyosu::flat](s) * tol;
+        if (eve::all(small)) return s;
+      }
+      return kyosu::fnan(eve::as(z));
+    }();
+
+    auto iz = kyosu::rec(z);
+    Z t3(0);
+    for (std::size_t k = q.c3.size(); k-- > 0;) t3 = (t3 + Z(q.c3[k])) * iz;
+    return Z(q.fac) * (t1 + t2 - t3);
+  }
+
+  template<typename C, typename Z> Z tricomi_run(tricomi_params<C> const& q, Z z) noexcept
+  {
+    using u_t = eve::underlying_type_t<Z>;
+    auto r = kyosu::fnan(eve::as<Z>());
+    auto ok = kyosu::is_not_fnan(z);
+    auto zlarge = kyosu::abs(z) > u_t(50);
+    auto large = ok && zlarge;
+    auto other = ok && !zlarge;
+    // the lanes of the other branch are given arguments for which the series converge at once
+    if (eve::any(large)) r = if_else(large, tricomi_large(q, kyosu::rec(if_else(large, z, Z(64)))), r);
+    if (eve::any(other))
+    {
+      auto zo = if_else(other, z, Z(1));
+      if (q.bpflint) r = if_else(other, tricomi_bpflint(q, zo), r);
+      else
+      {
+        auto p = kyosu::pow(zo, Z(kyosu::oneminus(q.b)));
+        r = if_else(other, Z(q.f1) * p * hyp1_1_run(q.m_1, zo) + Z(q.f2) * hyp1_1_run(q.m_2, zo), r);
+      }
+    }
+    return r;
+  }
+}
@@ -0,0 +1,21 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+//======================================================================================================================
+// Instrumentation points, see kyosu::instrument. FUNCTION and NAME are string literals.
+// Without KYOSU_INSTRUMENT they expand to nothing and their arguments are not evaluated.
+//======================================================================================================================
+#if defined(KYOSU_INSTRUMENT)
+#include <kyosu/instrument.hpp>
+#define KYOSU_INSTRUMENT_BRANCH(FUNCTION, NAME, MASK) ::kyosu::instrument::record_branch(FUNCTION, NAME, MASK)
+#define KYOSU_INSTRUMENT_ITERATIONS(FUNCTION, NAME, N) ::kyosu::instrument::record_iterations(FUNCTION, NAME, N)
+#else
+#define KYOSU_INSTRUMENT_BRANCH(FUNCTION, NAME, MASK) ((void)0)
+#define KYOSU_INSTRUMENT_ITERATIONS(FUNCTION, NAME, N) ((void)0)
+#endif
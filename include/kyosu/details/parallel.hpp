@@ -0,0 +1,38 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  f(k) for k in [0, count[ on at most `threads` threads, the calling one included.
+  //  Thread t processes k = t, t + threads, ... so that the work is spread whatever its order.
+  //===-------------------------------------------------------------------------------------------
+  template<typename F> void parallel_for(std::size_t count, std::size_t threads, F const& f)
+  {
+    threads = std::min(threads, count);
+    if (threads <= 1)
+    {
+      for (std::size_t k = 0; k < count; ++k) f(k);
+      return;
+    }
+
+    auto work = [&](std::size_t t) {
+      for (std::size_t k = t; k < count; k += threads) f(k);
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (std::size_t t = 1; t < threads; ++t) pool.emplace_back(work, t);
+    work(0);
+    for (auto& th : pool) th.join();
+  }
+}
@@ -0,0 +1,80 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/details/abi.hpp>
+#include <eve/module/core.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Piecewise polynomial tables
+  //  N polynomials with D coefficients (by increasing degree) are stored as D aligned planes of N
+  //  coefficients. A SIMD evaluation then fetches the coefficients of all lanes by one gather per
+  //  degree, whatever the pieces the lanes fall in, instead of one row load per lane.
+  //===-------------------------------------------------------------------------------------------
+  template<typename T, std::size_t N, std::size_t D> struct piecewise_table
+  {
+    static constexpr std::size_t size = N;
+    static constexpr std::size_t degree = D - 1;
+
+    struct alignas(64) plane
+    {
+      std::array<T, N> c;
+    };
+
+    std::array<plane, D> planes;
+
+    // builds the planes from N rows of D coefficients (any kumi product type or std::array)
+    template<typename Row> static constexpr piecewise_table from_rows(std::array<Row, N> const& rows) noexcept
+    {
+      piecewise_table t{};
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        [&]<std::size_t... K>(std::index_sequence<K...>) {
+          ((t.planes[K].c[i] = T(get<K>(rows[i]))), ...);
+        }(std::make_index_sequence<D>{});
+      }
+      return t;
+    }
+
+    // value at x of the polynomial of index i, i must be in [0, N[
+    template<typename I, typename V> KYOSU_FORCEINLINE constexpr V operator()(I i, V x) const noexcept
+    {
+      if constexpr (eve::scalar_value<V>)
+      {
+        V r = planes[D - 1].c[i];
+        for (std::size_t k = D - 1; k-- > 0;) r = eve::fma(r, x, V(planes[k].c[i]));
+        return r;
+      }
+      else
+      {
+        V r = eve::gather(planes[D - 1].c.data(), i);
+        [&]<std::size_t... K>(std::index_sequence<K...>) {
+          ((r = eve::fma(r, x, eve::gather(planes[D - 2 - K].c.data(), i))), ...);
+        }(std::make_index_sequence<D - 1>{});
+        return r;
+      }
+    }
+
+    // index of the piece containing x >= 0 for pieces of unit width, clamped to [0, N[
+    template<typename V> KYOSU_FORCEINLINE static constexpr auto index(V x) noexcept
+    {
+      if constexpr (eve::scalar_value<V>) return std::min(std::size_t(x), N - 1);
+      else
+      {
+        using i_t = eve::as_integer_t<V>;
+        auto ix = eve::convert(eve::if_else(eve::is_nan(x), eve::zero, x), eve::as<eve::element_type_t<i_t>>());
+        return eve::min(ix, eve::element_type_t<i_t>(N - 1));
+      }
+    }
+  };
+}
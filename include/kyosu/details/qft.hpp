@@ -0,0 +1,106 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <eve/module/core.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Quaternion Fourier transforms by symplectic decomposition
+  //
+  //  For a unit pure quaternion mu, choose nu unit pure orthogonal to mu and omega = mu nu.
+  //  With q = a + b mu + c nu + d omega, q = z1 + z2 nu where z1 = a + b mu and z2 = c + d mu
+  //  both lie in the complex plane C_mu = {x + y mu}, in which exp(-mu t) also lies. Since
+  //  nu exp(-mu t) = exp(mu t) nu:
+  //     sum exp(-mu t) q = F(z1) + F(z2) nu            (left transform)
+  //     sum q exp(-mu t) = F(z1) + conj(F(conj z2)) nu  (right transform)
+  //  where F is the complex DFT. conj(F(conj z)) is also swap(F(swap z)), swap exchanging the
+  //  real and imaginary parts, so that both transforms are two complex FFTs on pairs of planes
+  //  of the (a, b, c, d) coordinates: (a, b), (c, d) on the left, (a, b), (d, c) on the right.
+  //  When the frame (mu, nu, omega) is a permutation of (i, j, k) the coordinates are planes of
+  //  the data and no rotation pass is needed.
+  //===-------------------------------------------------------------------------------------------
+  template<typename T> struct qft_frame
+  {
+    std::array<std::array<T, 3>, 3> m{}; // m[r]: r-th vector of the frame in the (i, j, k) basis
+    std::array<unsigned int, 3> perm{};  // m[r] is the basis vector perm[r] when permutation is true
+    bool permutation = true;
+
+    qft_frame() : qft_frame(1, 0, 0) {}
+
+    qft_frame(double x, double y, double z)
+    {
+      auto dot = [](auto const& u, auto const& v) { return u[0] * v[0] + u[1] * v[1] + u[2] * v[2]; };
+      auto normalize = [&](auto& u) {
+        auto l = std::sqrt(dot(u, u));
+        for (auto& c : u) c /= l;
+      };
+      std::array<double, 3> mu{x, y, z};
+      normalize(mu);
+      std::array<double, 3> nu = std::abs(mu[1]) <= std::abs(mu[2]) ? std::array<double, 3>{0, 1, 0}
+                                                                      : std::array<double, 3>{0, 0, 1};
+      auto p = dot(nu, mu);
+      for (int c = 0; c < 3; ++c) nu[c] -= p * mu[c];
+      normalize(nu);
+      std::array<double, 3> om{mu[1] * nu[2] - mu[2] * nu[1], mu[2] * nu[0] - mu[0] * nu[2],
+                               mu[0] * nu[1] - mu[1] * nu[0]};
+
+      std::array<std::array<double, 3>, 3> f{mu, nu, om};
+      for (int r = 0; r < 3; ++r)
+      {
+        unsigned int ones = 0;
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+          m[r][c] = T(f[r][c]);
+          if (f[r][c] == 1)
+          {
+            ++ones;
+            perm[r] = c;
+          }
+          else if (f[r][c] != 0) permutation = false;
+        }
+        if (ones != 1) permutation = false;
+      }
+    }
+  };
+
+  // y_r = sum_c a(r, c) x_c on n elements of three planes, y may be x
+  template<bool Transposed, typename T>
+  void qft_rotate(std::array<std::array<T, 3>, 3> const& a, std::array<T const*, 3> x, std::array<T*, 3> y,
+                  std::size_t n) noexcept
+  {
+    auto coef = [&](int r, int c) { return Transposed ? a[c][r] : a[r][c]; };
+    auto apply = [&](auto x0, auto x1, auto x2, auto store) {
+      for (int r = 0; r < 3; ++r) store(r, coef(r, 0) * x0 + coef(r, 1) * x1 + coef(r, 2) * x2);
+    };
+
+    using w_t = eve::wide<T>;
+    constexpr std::size_t card = w_t::size();
+    std::size_t i = 0;
+    for (; i + card <= n; i += card)
+    {
+      auto ld = [&](int c) { return eve::load(x[c] + i, eve::cardinal_t<w_t>{}); };
+      apply(ld(0), ld(1), ld(2), [&](int r, w_t const& v) { eve::store(v, y[r] + i); });
+    }
+    for (; i < n; ++i) apply(x[0][i], x[1][i], x[2][i], [&](int r, T v) { y[r][i] = v; });
+  }
+
+  // out = in transposed, in being a rows x cols row major matrix
+  template<typename T> void qft_transpose(T const* in, T* out, std::size_t rows, std::size_t cols) noexcept
+  {
+    constexpr std::size_t tile = 16;
+    for (std::size_t r0 = 0; r0 < rows; r0 += tile)
+      for (std::size_t c0 = 0; c0 < cols; c0 += tile)
+        for (std::size_t r = r0; r < std::min(rows, r0 + tile); ++r)
+          for (std::size_t c = c0; c < std::min(cols, c0 + tile); ++c) out[c * rows + r] = in[r * cols + c];
+  }
+}
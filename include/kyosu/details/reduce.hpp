@@ -0,0 +1,160 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/parallel.hpp>
+#include <array>
+#include <vector>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Reductions of ranges
+  //  A reducer provides identity(as<A>), map(x...) (scalar or wide), combine(a, b) and finish(a).
+  //
+  //  The default mode runs four independent SIMD accumulators on each part of the range, sums
+  //  their lanes by a pairwise tree and the parts in order.
+  //
+  //  The reproducible mode cuts the range in blocks of reduction_block elements. In a block,
+  //  element i goes to the virtual lane i % reduction_lanes, the last incomplete group of lanes
+  //  being padded with zeros (that all the reducers map to their identity), and the lanes are
+  //  combined by a fixed pairwise tree. The blocks are then combined by a fixed pairwise tree.
+  //  The order of the operations only depends on the size of the range: the result is the same
+  //  bits whatever the native cardinal (up to reduction_lanes) and the number of threads.
+  //===-------------------------------------------------------------------------------------------
+  inline constexpr std::size_t reduction_lanes = 16;
+  inline constexpr std::size_t reduction_block = 4096;
+
+  template<typename V, std::size_t M, typename C>
+  KYOSU_FORCEINLINE V pairwise_reduce(std::array<V, M> a, C const& combine) noexcept
+  {
+    for (std::size_t h = M / 2; h > 0; h /= 2)
+      for (std::size_t i = 0; i < h; ++i) a[i] = combine(a[i], a[i + h]);
+    return a[0];
+  }
+
+  template<typename V, typename C> V pairwise_reduce(V const* a, std::size_t n, C const& combine) noexcept
+  {
+    if (n == 1) return a[0];
+    auto h = n / 2;
+    return combine(pairwise_reduce(a, h, combine), pairwise_reduce(a + h, n - h, combine));
+  }
+
+  template<typename Red, typename R0, typename... Rs>
+  using reduce_scalar_t =
+    decltype(std::declval<Red>().map(bulk_get(std::declval<R0>(), 0), bulk_get(std::declval<Rs>(), 0)...));
+
+  template<typename Red, typename R0, typename... Rs>
+  auto reduce_range(Red const& red, std::size_t b, std::size_t e, R0 r0, Rs... rs) noexcept
+  {
+    using c_t = eve::cardinal_t<eve::wide<bulk_value_t<R0>>>;
+    constexpr std::size_t card = c_t::value;
+    auto chunk = [&](std::size_t i) {
+      return red.map(bulk_load<eve::wide<bulk_value_t<R0>, c_t>>(r0, i),
+                     bulk_load<eve::wide<bulk_value_t<Rs>, c_t>>(rs, i)...);
+    };
+    auto combine = [&](auto const& x, auto const& y) { return red.combine(x, y); };
+    using a_t = decltype(chunk(0));
+    using s_t = reduce_scalar_t<Red, R0, Rs...>;
+
+    a_t a0 = red.identity(eve::as<a_t>()), a1 = a0, a2 = a0, a3 = a0;
+    std::size_t i = b;
+    for (; i + 4 * card <= e; i += 4 * card)
+    {
+      a0 = red.combine(a0, chunk(i));
+      a1 = red.combine(a1, chunk(i + card));
+      a2 = red.combine(a2, chunk(i + 2 * card));
+      a3 = red.combine(a3, chunk(i + 3 * card));
+    }
+    for (; i + card <= e; i += card) a0 = red.combine(a0, chunk(i));
+
+    a_t a = red.combine(red.combine(a0, a1), red.combine(a2, a3));
+    std::array<s_t, card> lanes;
+    for (std::size_t l = 0; l < card; ++l) lanes[l] = a.get(l);
+    s_t s = pairwise_reduce(lanes, combine);
+    for (; i < e; ++i) s = red.combine(s, red.map(bulk_get(r0, i), bulk_get(rs, i)...));
+    return s;
+  }
+
+  template<typename Red, typename R0, typename... Rs>
+  auto reduce_block_reproducible(Red const& red, std::size_t b, std::size_t e, R0 r0, Rs... rs) noexcept
+  {
+    constexpr std::size_t L = reduction_lanes;
+    constexpr std::size_t card = std::min<std::size_t>(eve::wide<bulk_value_t<R0>>::size(), L);
+    constexpr std::size_t M = L / card;
+    using c_t = eve::fixed<card>;
+    auto chunk = [&](std::size_t i, auto const& q0, auto const&... qs) {
+      return red.map(bulk_load<eve::wide<bulk_value_t<R0>, c_t>>(q0, i),
+                     bulk_load<eve::wide<bulk_value_t<Rs>, c_t>>(qs, i)...);
+    };
+    auto combine = [&](auto const& x, auto const& y) { return red.combine(x, y); };
+    using a_t = decltype(chunk(0, r0, rs...));
+    using s_t = reduce_scalar_t<Red, R0, Rs...>;
+
+    std::array<a_t, M> acc;
+    acc.fill(red.identity(eve::as<a_t>()));
+    std::size_t i = b;
+    for (; i + L <= e; i += L)
+      for (std::size_t m = 0; m < M; ++m) acc[m] = red.combine(acc[m], chunk(i + m * card, r0, rs...));
+
+    if (i < e)
+    {
+      auto pad = [&](auto r) {
+        std::array<bulk_value_t<decltype(r)>, L> t{};
+        for (std::size_t j = 0; i + j < e; ++j) t[j] = bulk_get(r, i + j);
+        return t;
+      };
+      auto t0 = pad(r0);
+      auto ts = kumi::tuple{pad(rs)...};
+      kumi::apply(
+        [&](auto&... t) {
+          for (std::size_t m = 0; m < M; ++m)
+            acc[m] = red.combine(acc[m], chunk(m * card, std::span(t0), std::span(t)...));
+        },
+        ts);
+    }
+
+    std::array<s_t, L> lanes;
+    for (std::size_t m = 0; m < M; ++m)
+      for (std::size_t l = 0; l < card; ++l) lanes[m * card + l] = acc[m].get(l);
+    return pairwise_reduce(lanes, combine);
+  }
+
+  template<bool Reproducible, typename Red, typename R0, typename... Rs>
+  auto bulk_reduce(Red const& red, std::size_t threads, R0 r0, Rs... rs)
+  {
+    using s_t = reduce_scalar_t<Red, R0, Rs...>;
+    auto const n = std::min({r0.size(), rs.size()...});
+    if (n == 0) return red.finish(red.identity(eve::as<s_t>()));
+
+    if constexpr (Reproducible)
+    {
+      auto const nb = (n + reduction_block - 1) / reduction_block;
+      auto block = [&](std::size_t k) {
+        return reduce_block_reproducible(red, k * reduction_block, std::min(n, (k + 1) * reduction_block), r0, rs...);
+      };
+      if (nb == 1) return red.finish(block(0));
+      auto combine = [&](auto const& x, auto const& y) { return red.combine(x, y); };
+      std::vector<s_t> partials(nb);
+      parallel_for(nb, threads, [&](std::size_t k) { partials[k] = block(k); });
+      return red.finish(pairwise_reduce(partials.data(), nb, combine));
+    }
+    else
+    {
+      auto const parts = std::max<std::size_t>(1, std::min(threads, n / reduction_block));
+      if (parts == 1) return red.finish(reduce_range(red, 0, n, r0, rs...));
+      std::vector<s_t> partials(parts);
+      parallel_for(parts, parts, [&](std::size_t k) {
+        partials[k] = reduce_range(red, n * k / parts, n * (k + 1) / parts, r0, rs...);
+      });
+      s_t s = partials[0];
+      for (std::size_t k = 1; k < parts; ++k) s = red.combine(s, partials[k]);
+      return red.finish(s);
+    }
+  }
+}
@@ -0,0 +1,266 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/fft.hpp>
+#include <kyosu/types/soa.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <vector>
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @class fft_plan
+  //! @brief Precomputed discrete Fourier transform of size n on complex values stored as planes
+  //!
+  //! The forward transform computes \f$X_k = \sum_{j=0}^{n-1} x_j e^{-2i\pi jk/n}\f$ and the inverse one
+  //! \f$x_j = \frac1n\sum_{k=0}^{n-1} X_k e^{2i\pi jk/n}\f$, so that inverse(forward(x)) is x.
+  //!
+  //! The data are kyosu::soa_view<T, 2> (or the views of kyosu::soa_buffer<T, 2>): the real and imaginary parts are
+  //! loaded from their planes directly into SIMD registers, without array of structures round trips.
+  //! n is factored in radices 8, 4 and 2, processed by specialized butterflies, then in odd factors, processed by
+  //! direct DFTs: sizes with large prime factors are supported but slower.
+  //!
+  //! The `batch` parameter transforms `batch` consecutive signals of size n. In and out views of out-of-place
+  //! transforms must not overlap. A plan can be used by several threads at once.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/fft.cpp}
+  //====================================================================================================================
+  template<eve::floating_scalar_value T> class fft_plan
+  {
+  public:
+    using view_type = soa_view<T, 2>;
+    using const_view_type = soa_view<T const, 2>;
+
+    fft_plan() = default;
+
+    explicit fft_plan(std::size_t n) : n_(n)
+    {
+      std::size_t s = 1, len = n;
+      for (auto r : _::fft_radices(n))
+      {
+        std::size_t const m = len / r;
+        stages_.push_back(_::fft_stage{r, m, s, twr_.size(), rtr_.size()});
+        for (std::size_t k = 1; k < r; ++k)
+          for (std::size_t p = 0; p < m; ++p)
+          {
+            auto a = -2 * std::numbers::pi * double((p * k) % len) / double(len);
+            twr_.push_back(T(std::cos(a)));
+            twi_.push_back(T(std::sin(a)));
+          }
+        if (r != 2 && r != 4 && r != 8)
+          for (std::size_t j = 0; j < r; ++j)
+          {
+            auto a = -2 * std::numbers::pi * double(j) / double(r);
+            rtr_.push_back(T(std::cos(a)));
+            rti_.push_back(T(std::sin(a)));
+          }
+        s *= r;
+        len = m;
+      }
+    }
+
+    std::size_t size() const noexcept { return n_; }
+
+    /// Out-of-place forward transforms
+    void forward(const_view_type in, view_type out, std::size_t batch = 1) const { transform<false>(in, out, batch); }
+
+    /// Out-of-place inverse transforms
+    void inverse(const_view_type in, view_type out, std::size_t batch = 1) const { transform<true>(in, out, batch); }
+
+    /// In-place forward transforms
+    void forward(view_type data, std::size_t batch = 1) const { transform<false>(data, batch); }
+
+    /// In-place inverse transforms
+    void inverse(view_type data, std::size_t batch = 1) const { transform<true>(data, batch); }
+
+  private:
+    template<bool Inv> void pass(_::fft_stage const& st, T const* xr, T const* xi, T* yr, T* yi, T scale) const
+    {
+      auto run = [&]<int R>(std::integral_constant<int, R>) {
+        _::fft_pass<R, Inv, T>{st, twr_.data(), twi_.data(), rtr_.data(), rti_.data(), scale}(xr, xi, yr, yi);
+      };
+      switch (st.radix)
+      {
+        case 2: run(std::integral_constant<int, 2>{}); break;
+        case 4: run(std::integral_constant<int, 4>{}); break;
+        case 8: run(std::integral_constant<int, 8>{}); break;
+        default: run(std::integral_constant<int, 0>{}); break;
+      }
+    }
+
+    // stage i reads the output of stage i-1 (x for the first one) and writes to a if i is even, to b otherwise
+    template<bool Inv> void run(T const* xr, T const* xi, T* ar, T* ai, T* br, T* bi) const
+    {
+      T const scale = Inv ? T(1) / T(n_) : T(1);
+      for (std::size_t i = 0; i < stages_.size(); ++i)
+      {
+        T* yr = i % 2 == 0 ? ar : br;
+        T* yi = i % 2 == 0 ? ai : bi;
+        pass<Inv>(stages_[i], xr, xi, yr, yi, i + 1 == stages_.size() ? scale : T(1));
+        xr = yr;
+        xi = yi;
+      }
+    }
+
+    template<bool Inv> void transform(const_view_type in, view_type out, std::size_t batch) const
+    {
+      std::vector<T> work(stages_.size() > 1 ? 2 * n_ : 0);
+      T* wr = work.data();
+      T* wi = wr + n_;
+      for (std::size_t b = 0; b < batch; ++b)
+      {
+        auto o = b * n_;
+        T const* xr = in.planes[0] + o;
+        T const* xi = in.planes[1] + o;
+        T* yr = out.planes[0] + o;
+        T* yi = out.planes[1] + o;
+        if (stages_.empty()) std::copy_n(xr, n_, yr), std::copy_n(xi, n_, yi);
+        else if (stages_.size() % 2 == 1) run<Inv>(xr, xi, yr, yi, wr, wi);
+        else run<Inv>(xr, xi, wr, wi, yr, yi);
+      }
+    }
+
+    template<bool Inv> void transform(view_type data, std::size_t batch) const
+    {
+      if (stages_.empty()) return;
+      std::vector<T> work(2 * n_);
+      T* wr = work.data();
+      T* wi = wr + n_;
+      for (std::size_t b = 0; b < batch; ++b)
+      {
+        T* xr = data.planes[0] + b * n_;
+        T* xi = data.planes[1] + b * n_;
+        if (stages_.size() % 2 == 0) run<Inv>(xr, xi, wr, wi, xr, xi);
+        else
+        {
+          std::copy_n(xr, n_, wr);
+          std::copy_n(xi, n_, wi);
+          run<Inv>(wr, wi, xr, xi, wr, wi);
+        }
+      }
+    }
+
+    std::size_t n_ = 0;
+    std::vector<_::fft_stage> stages_;
+    std::vector<T> twr_, twi_, rtr_, rti_;
+  };
+
+  //====================================================================================================================
+  //! @class real_fft_plan
+  //! @brief Precomputed discrete Fourier transform of size n, even, of real signals
+  //!
+  //! The forward transform computes the n/2+1 first values of the DFT of a real signal, the others being their
+  //! conjugates, and the inverse transform recovers the signal from them. The n real values are packed as the n/2
+  //! complex values \f$x_{2j} + i x_{2j+1}\f$, transformed by a complex FFT of size n/2, then separated, which halves
+  //! the cost of a complex transform of the zero-padded signal.
+  //!
+  //! For `batch` transforms, the real signals are consecutive blocks of n values and the spectra consecutive
+  //! blocks of n/2+1 values.
+  //====================================================================================================================
+  template<eve::floating_scalar_value T> class real_fft_plan
+  {
+  public:
+    using view_type = soa_view<T, 2>;
+    using const_view_type = soa_view<T const, 2>;
+
+    real_fft_plan() = default;
+
+    /// Plan for real signals of n values, n being even: the signal is packed as n/2 complex values
+    explicit real_fft_plan(std::size_t n) : n_(n), half_(n / 2)
+    {
+      EVE_ASSERT(n % 2 == 0, "the size of a real transform must be even");
+      for (std::size_t k = 0; k <= half_ / 2; ++k)
+      {
+        auto a = -2 * std::numbers::pi * double(k) / double(n);
+        wr_.push_back(T(std::cos(a)));
+        wi_.push_back(T(std::sin(a)));
+      }
+    }
+
+    std::size_t size() const noexcept { return n_; }
+    std::size_t spectrum_size() const noexcept { return half_ + 1; }
+
+    /// Spectra of the real signals in
+    void forward(std::span<T const> in, view_type out, std::size_t batch = 1) const
+    {
+      using c_t = complex_t<T>;
+      std::vector<T> work(2 * half_);
+      const_view_type z{{work.data(), work.data() + half_}, half_};
+      for (std::size_t b = 0; b < batch; ++b)
+      {
+        auto x = in.data() + b * n_;
+        for (std::size_t j = 0; j < half_; ++j)
+        {
+          work[j] = x[2 * j];
+          work[half_ + j] = x[2 * j + 1];
+        }
+        auto s = out.subview(b * (half_ + 1), half_ + 1);
+        plan_.forward(z, s);
+
+        // X_k = E_k + w^k O_k and X_h-k = conj(E_k - w^k O_k), with E_k and O_k the DFT of the even and odd values
+        auto z0 = s[0];
+        s.set(0, c_t(real(z0) + imag(z0)));
+        s.set(half_, c_t(real(z0) - imag(z0)));
+        for (std::size_t k = 1; k <= half_ / 2; ++k)
+        {
+          auto zk = s[k], zh = conj(s[half_ - k]);
+          auto e = (zk + zh) * T(0.5);
+          auto o = mulmi(zk - zh) * T(0.5) * c_t(wr_[k], wi_[k]);
+          s.set(k, e + o);
+          s.set(half_ - k, conj(e - o));
+        }
+      }
+    }
+
+    /// Real signals of the spectra in
+    void inverse(const_view_type in, std::span<T> out, std::size_t batch = 1) const
+    {
+      using c_t = complex_t<T>;
+      std::vector<T> work(2 * half_);
+      view_type z{{work.data(), work.data() + half_}, half_};
+      for (std::size_t b = 0; b < batch; ++b)
+      {
+        auto s = in.subview(b * (half_ + 1), half_ + 1);
+        for (std::size_t k = 0; k <= half_ / 2; ++k)
+        {
+          auto xk = s[k], xh = conj(s[half_ - k]);
+          auto e = (xk + xh) * T(0.5);
+          auto o = (xk - xh) * T(0.5) * c_t(wr_[k], -wi_[k]);
+          z.set(k, e + muli(o));
+          if (k != 0) z.set(half_ - k, conj(e - muli(o)));
+        }
+        plan_.inverse(z);
+        auto x = out.data() + b * n_;
+        for (std::size_t j = 0; j < half_; ++j)
+        {
+          x[2 * j] = work[j];
+          x[2 * j + 1] = work[half_ + j];
+        }
+      }
+    }
+
+  private:
+    std::size_t n_ = 0, half_ = 0;
+    fft_plan<T> plan_{half_};
+    std::vector<T> wr_, wi_;
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+}
@@ -127,6 +127,7 @@
 #include <kyosu/functions/kolmmean.hpp>
 #include <kyosu/functions/kronecker.hpp>
 #include <kyosu/functions/kummer.hpp>
+#include <kyosu/functions/laguerre.hpp>
 #include <kyosu/functions/lambda.hpp>
 #include <kyosu/functions/lbeta.hpp>
 #include <kyosu/functions/ldiv.hpp>
@@ -166,6 +167,7 @@
 #include <kyosu/functions/rec.hpp>
 #include <kyosu/functions/reldist.hpp>
 #include <kyosu/functions/reverse_horner.hpp>
+#include <kyosu/functions/roots.hpp>
 #include <kyosu/functions/rsqrt.hpp>
 #include <kyosu/functions/sec.hpp>
 #include <kyosu/functions/sech.hpp>
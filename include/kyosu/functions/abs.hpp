@@ -9,10 +9,11 @@
 
 #include <kyosu/details/callable.hpp>
 #include <kyosu/details/decorators.hpp>
+#include <kyosu/functions/sqr_abs.hpp>
 
 namespace kyosu
 {
-  template<typename Options> struct abs_t : eve::elementwise_callable<abs_t, Options, pedantic_option, eve::raw_option, flat_option>
+  template<typename Options> struct abs_t : eve::elementwise_callable<abs_t, Options, pedantic_option, eve::raw_option, flat_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z>
     KYOSU_FORCEINLINE constexpr as_real_type_t<Z> operator()(Z z) const noexcept
@@ -46,6 +47,7 @@ namespace kyosu
   //!      // Semantic modifyiers
   //!      template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T> abs[raw](T z) noexcept;  // 2
   //!      template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T> abs[flat](T z) noexcept; // 3
+  //!      template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T> abs[fast](T z) noexcept; // 4
   //!   }
   //!   @endcode
   //!
@@ -60,6 +62,8 @@ namespace kyosu
   //!    2. With the raw option no provision is made to enhance accuracy and avoid overflows.
   //!       oly items c, f; g, h, i, k are satisfied
   //!    3. With the `flat` otpion it is the \f$l_\infty\f$ norm of the components that is computed.
+  //!    4. With the `fast` option the square root of `sqr_abs(z)` is returned: the relative error is less than
+  //!       2 ulp as long as \f$|z|^2\f$ neither overflows nor underflows and special values are not handled.
   //!
   //!  @groupheader{External references}
   //!   *  [C++ standard reference: complex abs](https://en.cppreference.com/w/cpp/numeric/complex/abs)
@@ -80,6 +84,7 @@ namespace kyosu::_
   {
     if constexpr (concepts::real<Z>) return eve::abs(v);
     else if constexpr (O::contains(flat)) return eve::maxabs(kumi::flatten(kumi::make_tuple(v)));
+    else if constexpr (O::contains(fast)) return eve::sqrt(kyosu::sqr_abs(v));
     else if constexpr (O::contains(eve::raw)) return eve::hypot(v);
     else return eve::hypot[eve::pedantic](v);
   }
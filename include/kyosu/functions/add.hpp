@@ -8,6 +8,7 @@
 #pragma once
 #include <kyosu/details/callable.hpp>
 #include <kyosu/types/tuple.hpp>
+#include <kyosu/details/compensated.hpp>
 
 namespace kyosu
 {
@@ -76,7 +77,9 @@ namespace kyosu
   //!
   //!     1. The value of the sum of the arguments is returned.
   //!     2. The value of the sum of the tuple elements is returned.
-  //!     3. kahan algorithm is used to enhance accuracy.
+  //!     3. kahan algorithm is used to enhance accuracy: the rounding errors of the running sum are
+  //!        accumulated apart (two_add based Sum2 algorithm), so that the result is as accurate as if computed
+  //!        in twice the working precision.
   //!     4. [The operation is performed conditionnaly](@ref conditional)
   //!
   //! @note If all elements are real typed the result will be real typed, using a call to `eve::add`
@@ -98,6 +101,7 @@ namespace kyosu::_
     using r_t = as_cayley_dickson_t<T0, Ts...>;
     if constexpr (concepts::real<r_t>) return eve::add[o](t0, ts...);
     else if constexpr (sizeof...(Ts) == 0) return t0;
+    else if constexpr (O::contains(eve::kahan)) return compensated_sum<r_t>(t0, ts...);
     else return kumi::map(eve::add[o], r_t(t0), r_t(ts)...);
   }
 
@@ -12,7 +12,7 @@
 
 namespace kyosu
 {
-  template<typename Options> struct arg_t : eve::elementwise_callable<arg_t, Options, radpi_option>
+  template<typename Options> struct arg_t : eve::elementwise_callable<arg_t, Options, radpi_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z>
     KYOSU_FORCEINLINE constexpr as_real_type_t<Z> operator()(Z v) const noexcept
@@ -46,6 +46,7 @@ namespace kyosu
   //!     // semantic modifyers
   //!     template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T> arg[radpi](T z) noexcept;
   //!     template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T> arg[rad](T z)   noexcept;
+  //!     template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T> arg[fast](T z)  noexcept;
   //!   }
   //!   @endcode
   //!
@@ -63,6 +64,8 @@ namespace kyosu
   //!       \f$z_0\f$ is the real part of \f$z\f$,
   //!       \f$z_1\f$ is the `ipart` of \f$z\f$ and \f$\underline{z}\f$ the `pure` part of \f$z\f$.
   //!      - The radpi option provides a result in \f$\pi\f$ multiples.
+  //!      - The fast option uses the regular `eve::atan2` instead of its pedantic version: the result is within
+  //!        2 ulp of the exact value for finite non zero inputs, but infinities and signed zeros are not handled.
   //!
   //!  @groupheader{External references}
   //!   *  [Wolfram MathWorld: Argument](https://functions.wolfram.com/ComplexComponents/Arg/02/)
@@ -85,10 +88,15 @@ namespace kyosu
     template<typename Z, eve::callable_options O>
     KYOSU_FORCEINLINE constexpr auto arg_(KYOSU_DELAY(), O const& o, Z v) noexcept
     {
-      if constexpr (concepts::real<Z>) { return eve::arg[o](v); }
+      if constexpr (concepts::real<Z>) { return eve::arg[o.drop(fast)](v); }
       else
       {
-        if constexpr (concepts::complex<Z>) return eve::atan2[o][eve::pedantic](imag(v), real(v));
+        if constexpr (O::contains(fast))
+        {
+          if constexpr (concepts::complex<Z>) return eve::atan2[o.drop(fast)](imag(v), real(v));
+          else return eve::atan2[o.drop(fast)](eve::sign(imag(v)) * abs[fast](pure(v)), real(v));
+        }
+        else if constexpr (concepts::complex<Z>) return eve::atan2[o][eve::pedantic](imag(v), real(v));
         else return eve::atan2[o][eve::pedantic](eve::sign(imag(v)) * abs(pure(v)), real(v));
       }
     }
@@ -13,7 +13,7 @@
 
 namespace kyosu
 {
-  template<typename Options> struct cos_t : eve::elementwise_callable<cos_t, Options, raw_option, pedantic_option, radpi_option>
+  template<typename Options> struct cos_t : eve::elementwise_callable<cos_t, Options, raw_option, pedantic_option, radpi_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z> KYOSU_FORCEINLINE constexpr Z operator()(Z const& z) const noexcept
     {
@@ -46,6 +46,7 @@ namespace kyosu
   //!     // semantic modifyers
   //!     constexpr auto cos[radpi](cayley_dickson_like z)         noexcept; //2
   //!     constexpr auto cos[rad](cayley_dickson_like z)           noexcept; //1
+  //!     constexpr auto cos[fast](cayley_dickson_like z)          noexcept; //3
   //!   }
   //!   @endcode
   //!
@@ -58,6 +59,8 @@ namespace kyosu
   //!      1. Returns the cosine of the argument in radian.
   //!         The behavior of this function is equivalent to `kyosu::cosh(i*z)`.
   //!      2. Returns the cosine of the argument in \f$\pi\f$ multiples.
+  //!      3. With the fast option, no special value is handled (see kyosu::cosh). It can be combined with `radpi`.
+  //!         For finite results the relative error of each part is less than 4 ulp.
   //!
   //!  @groupheader{External references}
   //!   *  [C++ standard reference: complex cos](https://en.cppreference.com/w/cpp/numeric/complex/cos)
@@ -80,10 +83,10 @@ namespace kyosu
     template<typename Z, eve::callable_options O>
     constexpr KYOSU_FORCEINLINE Z cos_(KYOSU_DELAY(), O const& o, Z const& z)
     {
-      if constexpr (concepts::real<Z>) return eve::cos[o](z);
+      if constexpr (concepts::real<Z>) return eve::cos[o.drop(fast)](z);
       else if constexpr (concepts::complex<Z>)
       {
-        if constexpr (!O::contains(radpi)) return cosh(muli(z));
+        if constexpr (!O::contains(radpi)) return cosh[o](muli(z));
         else
         {
           auto [rz, iz] = z;
@@ -92,7 +95,7 @@ namespace kyosu
           auto [sh, ch] = eve::sinhcosh(iz);
           auto r = c * ch;
           auto i = eve::if_else(is_imag(z) || kyosu::is_real(z), eve::zero, -s * sh);
-          if (eve::any(kyosu::is_not_finite(z)))
+          if (!O::contains(fast) && eve::any(kyosu::is_not_finite(z)))
           {
             r = eve::if_else(eve::is_infinite(iz) && eve::is_not_finite(rz), eve::inf(eve::as(r)), r);
             i = eve::if_else(eve::is_infinite(iz) && eve::is_not_finite(rz), eve::nan(eve::as(r)), i);
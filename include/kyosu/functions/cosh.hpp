@@ -14,7 +14,7 @@
 namespace kyosu
 {
   template<typename Options>
-  struct cosh_t : eve::elementwise_callable<cosh_t, Options, raw_option, pedantic_option>
+  struct cosh_t : eve::elementwise_callable<cosh_t, Options, raw_option, pedantic_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z>
     KYOSU_FORCEINLINE constexpr Z operator()(Z const& z) const noexcept
@@ -43,6 +43,7 @@ namespace kyosu
 //!   namespace kyosu
 //!   {
 //!     template<kyosu::concepts::cayley_dickson_like T> constexpr T cosh(T z) noexcept;
+//!     template<kyosu::concepts::cayley_dickson_like T> constexpr T cosh[fast](T z) noexcept;
 //!   }
 //!   @endcode
 //!
@@ -70,6 +71,8 @@ namespace kyosu
 //!        *  If z is \f$\textrm{NaN}+i y\f$ (for any finite non-zero y), the result is \f$\textrm{NaN}+i \textrm{NaN}\f$
 //!        *  If z is \f$\textrm{NaN}+i \textrm{NaN}\f$, the result is \f$\textrm{NaN}+i \textrm{NaN}\f$
 //!     - This is semantically equivalent to `(exp(z)+exp(-z))/2`.
+//!     - With the fast option, \f$\cos y\cosh x + i\sin y\sinh x\f$ is returned without any special value handling.
+//!       For finite results the relative error of each part is less than 4 ulp.
 //!
 //!  @groupheader{External references}
 //!   *  [C++ standard reference: complex cosh](https://en.cppreference.com/w/cpp/numeric/complex/cosh)
@@ -99,6 +102,7 @@ namespace kyosu::_
       auto [sh, ch] = eve::sinhcosh(rz);
       auto r = c*ch;
       auto i = s*sh;
+      if constexpr(O::contains(fast)) return Z(r, i);
       i = eve::if_else(kyosu::is_eqz(kyosu::ipart(z)) || kyosu::is_real(z), eve::zero, i);
       auto res = Z(r, i);
       if (eve::any(kyosu::is_not_finite(z)))
@@ -9,6 +9,7 @@
 #include <kyosu/details/callable.hpp>
 #include <kyosu/functions/convert.hpp>
 #include <kyosu/functions/mul.hpp>
+#include <kyosu/functions/sqr_abs.hpp>
 
 namespace kyosu
 {
@@ -77,7 +78,9 @@ namespace kyosu
   //!
   //!    1. The value of the division of its first argument with the product of the others.
   //!    2. same as 1. on the tuple elements.
-  //!    3. kahan algorithm is used to enhance accuracy.
+  //!    3. kahan algorithm is used to enhance accuracy: the numerator \f$x_0\bar d\f$ is computed by the kahan
+  //!       product and \f$|d|^2\f$ by error free transformations, which avoids the cancellations of the regular
+  //!       algorithm.
   //!    4. [The operation is performed conditionnaly](@ref conditional)
   //!
   //! @note If all elements are real typed the result will be real typed, using a call to `eve::div`
@@ -105,6 +108,11 @@ namespace kyosu::_
     using r_t = as_cayley_dickson_t<T0, Ts...>;
     if constexpr (concepts::real<r_t>) return eve::div(t0, ts...);
     else if constexpr (sizeof...(Ts) == 0) return t0;
+    else if constexpr (O::contains(eve::kahan))
+    {
+      r_t d(kyosu::mul[o](ts...));
+      return kyosu::mul[o](r_t(t0), if_else(is_infinite(d), eve::zero, conj(d))) / sqr_abs[o](d);
+    }
     else if constexpr (sizeof...(Ts) == 1)
     {
       return kyosu::mul[o](t0, if_else(is_infinite(ts...), eve::zero, conj(ts...)) / sqr_abs(ts...));
@@ -9,6 +9,7 @@
 #include <kyosu/details/callable.hpp>
 #include <kyosu/types/tuple.hpp>
 #include <kyosu/functions/mul.hpp>
+#include <kyosu/details/compensated.hpp>
 
 namespace kyosu
 {
@@ -85,7 +86,9 @@ namespace kyosu
   //!
   //!    1. dot product. \f$\sum_s x_s\bar{y}_s\f$.
   //!    2. use the content of the tuples
-  //!    3. kahan algorithms are used to improve accuracy.
+  //!    3. kahan algorithms are used to improve accuracy. For real and complex values, the products and the sum
+  //!       are computed by error free transformations (Dot2 algorithm): the result is as accurate as if computed
+  //!       in twice the working precision.
   //!
   //!  @groupheader{External references}
   //!   *  [Wikipedia taxicab norm](https://en.wikipedia.org/wiki/Dot_product)
@@ -105,7 +108,8 @@ namespace kyosu::_
   template<concepts::cayley_dickson_like T0, concepts::cayley_dickson_like T1, eve::callable_options O>
   KYOSU_FORCEINLINE constexpr auto dot_(KYOSU_DELAY(), O const& o, T0 z0, T1 z1) noexcept
   {
-    return z0 * conj(z1);
+    if constexpr (O::contains(eve::kahan)) return kyosu::mul[o](z0, conj(z1));
+    else return z0 * conj(z1);
   }
 
   template<typename... Ts, eve::callable_options O>
@@ -115,15 +119,24 @@ namespace kyosu::_
     using r_t = as_cayley_dickson_like_t<Ts...>;
     auto coeffs = eve::zip(r_t(args)...);
     auto [f, s] = kumi::split(coeffs, kumi::index<sizeof...(Ts) / 2>);
-    auto tup = kumi::map([o](auto a, auto b) { return kyosu::mul[o](a, conj(b)); }, f, s);
-    return add[o](tup);
+    if constexpr (O::contains(eve::kahan) && concepts::complex_like<r_t>) return compensated_dot<r_t>(f, s);
+    else
+    {
+      auto tup = kumi::map([o](auto a, auto b) { return kyosu::mul[o](a, conj(b)); }, f, s);
+      return add[o](tup);
+    }
   }
 
   template<eve::non_empty_product_type Tup1, eve::non_empty_product_type Tup2, eve::callable_options O>
   KYOSU_FORCEINLINE constexpr auto dot_(KYOSU_DELAY(), O const& o, Tup1 z0, Tup2 z1) noexcept
   requires(!concepts::cayley_dickson_like<Tup1> && !concepts::cayley_dickson_like<Tup2>)
   {
-    auto tup = kumi::map([o](auto a, auto b) { return kyosu::mul[o](a, conj(b)); }, z0, z1);
-    return add[o](tup);
+    using r_t = kumi::apply_traits_t<as_cayley_dickson_like, kumi::result::cat_t<Tup1, Tup2>>;
+    if constexpr (O::contains(eve::kahan) && concepts::complex_like<r_t>) return compensated_dot<r_t>(z0, z1);
+    else
+    {
+      auto tup = kumi::map([o](auto a, auto b) { return kyosu::mul[o](a, conj(b)); }, z0, z1);
+      return add[o](tup);
+    }
   }
 }
@@ -7,6 +7,7 @@
 //======================================================================================================================
 #pragma once
 #include <kyosu/details/callable.hpp>
+#include <kyosu/details/instrument.hpp>
 #include <kyosu/functions/maxabs.hpp>
 #include <kyosu/functions/sqrt.hpp>
 #include <kyosu/functions/fma.hpp>
@@ -110,7 +111,8 @@ namespace kyosu::_
 
     // duplication
     r_t hf = half(as<r_t>());
-    for (unsigned k = 1; k < 30; ++k)
+    unsigned k = 1;
+    for (; k < 30; ++k)
     {
       auto root_x = kyosu::sqrt(xn);
       auto root_y = kyosu::sqrt(yn);
@@ -127,6 +129,7 @@ namespace kyosu::_
       fn *= r_t(4);
       if (eve::all(q < kyosu::abs(an))) break;
     }
+    KYOSU_INSTRUMENT_ITERATIONS("ellint_rf", "duplication", eve::min(k, 29u));
     auto denom = kyosu::rec(an * fn);
     auto xx = (a0 - x) * denom;
     auto yy = (a0 - y) * denom;
@@ -16,7 +16,7 @@
 namespace kyosu
 {
   template<typename Options>
-  struct exp_t : eve::elementwise_callable<exp_t, Options, radpi_option, raw_option, pedantic_option, real_only_option>
+  struct exp_t : eve::elementwise_callable<exp_t, Options, radpi_option, raw_option, pedantic_option, real_only_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z> KYOSU_FORCEINLINE constexpr complexify_if_t<Options, Z>  operator()(Z const& z) const noexcept
     {
@@ -49,6 +49,7 @@ namespace kyosu
   //!      // Semantic modifyiers
   //!      template<kyosu::concepts::cayley_dickson_like T> constexpr T exp[raw}(T z) noexcept;
   //!      template<kyosu::concepts::cayley_dickson_like T> constexpr T exp[radpi}(T z) noexcept;
+  //!      template<kyosu::concepts::cayley_dickson_like T> constexpr T exp[fast}(T z) noexcept;
   //!   }
   //!   @endcode
   //!
@@ -79,6 +80,8 @@ namespace kyosu
   //!
   //!     2. with the raw options, no care is taken to satisfy the corners cases.
   //!     3. computes \f$ e^{\pi z}\f$. `exppi` alias can be used.
+  //!     4. with the fast option, the result is \f$e^x(\cos y + i \sin y)\f$ with neither symmetry enforcement
+  //!        nor special values handling. For finite results the relative error is less than 4 ulp.
   //!
   //!  @groupheader{Example}
   //!
@@ -119,12 +122,12 @@ namespace kyosu::_
     }
     else if constexpr (concepts::complex<Z>)
     {
-      if constexpr(O::contains(raw))
+      if constexpr(O::contains(raw) || O::contains(fast))
       {
         auto [rz, iz] = z;
 
-        auto [s, c] = eve::sincos[o](iz);
-        auto r = kyosu::exp[real_only][o.drop(raw)](rz);
+        auto [s, c] = eve::sincos[o.drop(fast)](iz);
+        auto r = kyosu::exp[real_only][o.drop(raw, fast)](rz);
         auto rr = Z(r * c, r * s);
         return rr;
       }
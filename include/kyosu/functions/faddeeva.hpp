@@ -7,7 +7,9 @@
 //======================================================================================================================
 #pragma once
 #include <kyosu/details/callable.hpp>
+#include <kyosu/details/instrument.hpp>
 #include <kyosu/functions/to_complex.hpp>
+#include <kyosu/details/w_im.hpp>
 
 namespace kyosu
 {
@@ -154,20 +156,36 @@ namespace kyosu::_
                        small_z(z));
       };
 
+      auto real_axis = [](auto z) { // tabulated imaginary part on the real axis
+        auto x = real(z);
+        return complex(eve::exp(-eve::sqr(x)), w_im(x));
+      };
+
       auto indneg = eve::is_ltz(imag(z));
       z = if_else(indneg, conj(z), z);
       auto r = complex(eve::nan(eve::as(real(z))), eve::nan(eve::as(real(z)))); // nan case treated here
       r = if_else(eve::is_infinite(real(z)), Z{}, r);
       auto notdone = is_finite(z);
       if (eve::any(notdone))
+      {
+        KYOSU_INSTRUMENT_BRANCH("faddeeva", "real axis", notdone && eve::is_eqz(imag(z)));
+        notdone = next_interval(real_axis, notdone, eve::is_eqz(imag(z)), r, z);
+      }
+      if (eve::any(notdone))
       {
         auto indin = sqr_abs(z) <= real_t(64);
         auto indband = indin && (imag(z) < real_t(5.0e-3));
+        KYOSU_INSTRUMENT_BRANCH("faddeeva", "narrow band", notdone && indband);
         notdone = next_interval(smallim, notdone, indband, r, z);
         if (eve::any(notdone))
         {
+          KYOSU_INSTRUMENT_BRANCH("faddeeva", "exponential series", notdone && indin);
           notdone = next_interval(fexp, notdone, indin, r, z);
-          if (eve::any(notdone)) { notdone = next_interval(contfr, notdone, notdone, r, z); }
+          if (eve::any(notdone))
+          {
+            KYOSU_INSTRUMENT_BRANCH("faddeeva", "continued fraction", notdone);
+            notdone = next_interval(contfr, notdone, notdone, r, z);
+          }
         }
       }
       return if_else(indneg, conj(r), r);
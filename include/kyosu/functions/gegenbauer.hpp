@@ -11,6 +11,8 @@
 #include <kyosu/details/hyperg/is_negint.hpp>
 #include <kyosu/functions/tgamma.hpp>
 #include <kyosu/functions/tgamma_inv.hpp>
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/clenshaw.hpp>
 
 namespace kyosu
 {
@@ -29,6 +31,41 @@ namespace kyosu
       return KYOSU_CALL(nn, ll, zz);
     }
 
+    template<typename L, typename Z, typename Data>
+    using series_t = as_cayley_dickson_like_t<as_cayley_dickson_like_t<L, Z>, coefficients<Data>>;
+
+    // Clenshaw evaluation of Gegenbauer series
+    template<concepts::real L, concepts::cayley_dickson_like Z, eve::non_empty_product_type Data>
+    KYOSU_FORCEINLINE constexpr series_t<L, Z, Data> operator()(L ll, Z zz, coefficients<Data> const& c) const noexcept
+    {
+      return KYOSU_CALL(ll, zz, c);
+    }
+
+    template<concepts::real L, concepts::cayley_dickson_like Z, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(L ll,
+                                                std::span<Z, S1> zs,
+                                                coefficients<Data> const& c,
+                                                std::span<R, S2> rs) const noexcept
+    requires(eve::scalar_value<L> && std::same_as<R, series_t<L, std::remove_cv_t<Z>, Data>>)
+    {
+      KYOSU_CALL(ll, zs, c, rs);
+    }
+
+    // Sequences of Gegenbauer polynomials
+    template<concepts::real L, concepts::cayley_dickson_like Z, typename R, std::size_t S>
+    KYOSU_FORCEINLINE constexpr void operator()(L ll, Z zz, std::span<R, S> ps) const noexcept
+    requires(eve::scalar_value<L> && std::same_as<R, Z>)
+    {
+      KYOSU_CALL(ll, zz, ps);
+    }
+
+    template<concepts::real L, concepts::cayley_dickson_like Z, std::size_t S1, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(L ll, std::span<Z, S1> zs, std::span<R, S2> ps) const noexcept
+    requires(eve::scalar_value<L> && std::same_as<R, std::remove_cv_t<Z>>)
+    {
+      KYOSU_CALL(ll, zs, ps);
+    }
+
     KYOSU_CALLABLE_OBJECT(gegenbauer_t, gegenbauer_);
   };
 
@@ -59,17 +96,37 @@ namespace kyosu
   //!      // Lanes masking
   //!      constexpr auto gegenbauer[conditional_expr auto c](/* any previous overload */)  noexcept; // 2
   //!      constexpr auto gegenbauer[logical_value auto m](/* any previous overload */)     noexcept; // 2
+  //!
+  //!      // Series evaluation
+  //!      auto constexpr gegenbauer(auto lambda, auto z, auto coefs)                       noexcept; // 3
+  //!      constexpr void gegenbauer(auto lambda, std::span<Z> zs, auto coefs, std::span<R> rs) noexcept; // 4
+  //!
+  //!      // Sequences
+  //!      constexpr void gegenbauer(auto lambda, auto z, std::span<R> ps)                  noexcept; // 5
+  //!      constexpr void gegenbauer(auto lambda, std::span<Z> zs, std::span<R> ps)         noexcept; // 6
   //!   }
   //!   @endcode
   //!
   //!   **Parameters**
   //!
   //!     * `n`,  lambda, `z` :  real or cayley_dickson.
+  //!     * `coefs` : kyosu::coefficients of the series by increasing degree.
+  //!     * `zs`, `rs` : spans of input points and of output values.
+  //!     * `ps` : span receiving the values of the successive polynomials.
   //!
   //!    **Return value**
   //!
   //!      1.The value of the function at `z` is returned. real input `z` is treated as `complex(z)`.
   //!      2. [The operation is performed conditionnaly](@ref conditional).
+  //!      3. computes \f$\sum_{k=0}^{n-1} c_kC^{(\lambda)}_k(z)\f$ for a real \f$\lambda\f$ using the Clenshaw
+  //!         backward recurrence: \f$O(n)\f$ fma and no hypergeometric evaluation.
+  //!         For non commutative algebras, the coefficients are on the left of the polynomials.
+  //!         Unlike 1., real inputs lead to a real result.
+  //!      4. computes 3. at each element of `zs` and stores the results in `rs`.
+  //!      5. fills `ps` with \f$C^{(\lambda)}_0(z), \dots, C^{(\lambda)}_{m-1}(z)\f$ where `m` is the size of `ps`,
+  //!         using the three term recurrence.
+  //!      6. fills the row-major matrix `ps` of `m = ps.size()/zs.size()` rows with \f$C^{(\lambda)}_k(zs_j)\f$
+  //!         at row `k` and column `j`. The recurrence runs on SIMD chunks of points.
   //!
   //!  @groupheader{External references}
   //!   *  [Wolfram MathWorld: GegenbauerC](https://functions.wolfram.com/Polynomials/GegenbauerC3/02/)
@@ -120,4 +177,52 @@ namespace kyosu::_
     using r_t = complexify_t<as_cayley_dickson_like_t<N, L, Z>>;
     return eve::_::mask_op(cx, eve::_::return_2nd, r_t(z), kyosu::gegenbauer[o](r_t(n), r_t(l), r_t(z)));
   }
+
+  // (k+1) C_k+1 = 2(k+l) z C_k - (k+2l-1) C_k-1, with C_1 = 2l z
+  template<typename U, typename L, typename Z> KYOSU_FORCEINLINE constexpr auto gegenbauer_recurrence(L ll, Z z) noexcept
+  {
+    auto l = eve::convert(ll, eve::as<U>());
+    auto alpha = [l, z](std::size_t k) { return (2 * (U(k) + l) / U(k + 1)) * z; };
+    auto beta = [l](std::size_t k) { return -(U(k) - 1 + 2 * l) / U(k + 1); };
+    return kumi::tuple{alpha, beta, (2 * l) * z};
+  }
+
+  template<typename L, typename Z, eve::non_empty_product_type Data, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr auto gegenbauer_(KYOSU_DELAY(), O const&, L l, Z z, coefficients<Data> const& c) noexcept
+  {
+    using r_t = as_cayley_dickson_like_t<as_cayley_dickson_like_t<L, Z>, coefficients<Data>>;
+    auto [alpha, beta, p1] = gegenbauer_recurrence<eve::underlying_type_t<r_t>>(l, z);
+    return clenshaw<r_t>(c, alpha, beta, p1);
+  }
+
+  template<typename L, typename Z, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void gegenbauer_(KYOSU_DELAY(),
+                                               O const& o,
+                                               L l,
+                                               std::span<Z, S1> zs,
+                                               coefficients<Data> const& c,
+                                               std::span<R, S2> rs) noexcept
+  {
+    bulk_apply(zs, rs, [&](auto z) { return gegenbauer[o](l, z, c); });
+  }
+
+  template<typename L, typename Z, typename R, std::size_t S, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void gegenbauer_(KYOSU_DELAY(), O const&, L l, Z z, std::span<R, S> ps) noexcept
+  {
+    auto [alpha, beta, p1] = gegenbauer_recurrence<eve::underlying_type_t<R>>(l, z);
+    forward_recurrence<R>(ps.size(), alpha, beta, p1, [&](std::size_t k, R const& v) { ps[k] = v; });
+  }
+
+  template<typename L, typename Z, std::size_t S1, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void gegenbauer_(KYOSU_DELAY(),
+                                               O const&,
+                                               L l,
+                                               std::span<Z, S1> zs,
+                                               std::span<R, S2> ps) noexcept
+  {
+    bulk_columns(zs, ps, [&](auto z, std::size_t n, auto store) {
+      auto [alpha, beta, p1] = gegenbauer_recurrence<eve::underlying_type_t<R>>(l, z);
+      forward_recurrence<decltype(z)>(n, alpha, beta, p1, store);
+    });
+  }
 }
@@ -10,11 +10,17 @@
 #include <kyosu/functions/to_complex.hpp>
 #include <kyosu/functions/convert.hpp>
 #include <kyosu/functions/fma.hpp>
+#include <kyosu/functions/sqr.hpp>
 #include <kyosu/types/helpers.hpp>
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/compensated.hpp>
 
 namespace kyosu
 {
-  template<typename Options> struct horner_t : eve::callable<horner_t, Options, raw_option, pedantic_option, eve::left_option, eve::right_option>
+  template<typename Options>
+  struct horner_t
+    : eve::callable<horner_t, Options, raw_option, pedantic_option, eve::left_option, eve::right_option, estrin_option, second_order_option,
+                   eve::kahan_option>
   {
     template<concepts::cayley_dickson_like... Zs>
     KYOSU_FORCEINLINE constexpr as_cayley_dickson_like_t<Zs...> operator()(Zs const&... zs) const noexcept
@@ -30,6 +36,15 @@ namespace kyosu
       return KYOSU_CALL(z, t);
     }
 
+    template<concepts::cayley_dickson_like X, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(std::span<X, S1> xs,
+                                                coefficients<Data> const& t,
+                                                std::span<R, S2> rs) const noexcept
+    requires(std::same_as<R, as_cayley_dickson_like_t<std::remove_cv_t<X>, coefficients<Data>>>)
+    {
+      KYOSU_CALL(xs, t, rs);
+    }
+
     KYOSU_CALLABLE_OBJECT(horner_t, horner_);
   };
 
@@ -46,6 +61,9 @@ namespace kyosu
   //!
   //!   using the `right` semantic modifyier allows to use a right-horner scheme: coefficients are at the right of the x powers).
   //!
+  //!   The plain scheme is a chain of n dependent fma. The `estrin` and `second_order` modifiers reorder the
+  //!   computation to expose instruction level parallelism, at the price of a few more operations.
+  //!
   //!   @groupheader{Header file}
   //!
   //!   @code
@@ -66,6 +84,16 @@ namespace kyosu
   //!     template<auto T, auto C ...>  auto horner[right](T x, C ... coefs) noexcept;  //3
   //!     template<auto C, auto K>      auto horner[right]r(T x, K tup)      noexcept;  //3
   //!
+  //!     Evaluation strategies
+  //!     template<auto T, auto C ...>  auto horner[estrin](T x, C ... coefs)       noexcept;  //4
+  //!     template<auto C, auto K>      auto horner[estrin](T x, K tup)             noexcept;  //4
+  //!     template<auto T, auto C ...>  auto horner[second_order](T x, C ... coefs) noexcept;  //5
+  //!     template<auto C, auto K>      auto horner[second_order](T x, K tup)       noexcept;  //5
+  //!     template<auto T, auto C ...>  auto horner[kahan](T x, C ... coefs)        noexcept;  //7
+  //!     template<auto C, auto K>      auto horner[kahan](T x, K tup)              noexcept;  //7
+  //!
+  //!     Multi-point evaluation
+  //!     template<auto T, auto K, auto R> void horner(std::span<T> xs, K tup, std::span<R> rs) noexcept;  //6
   //!   }
   //!   @endcode
   //!
@@ -86,6 +114,22 @@ namespace kyosu
   //!       The value of the polynom at  `x` is returned,  according to the formula:
   //!        \f$\displaystyle p(x) = (x (x (x a_0+a_1)+ ... )+a_{n-1})\f$.\n
   //!        Of course for real or complex entries `left` and `right` leads to the same result
+  //!    4. The polynomial is evaluated by the Estrin scheme: adjacent coefficients are paired as
+  //!       \f$c_{2i}+c_{2i+1}x\f$, then the pairs are combined with \f$x^2\f$, \f$x^4\f$,...
+  //!       The dependency chain is of length \f$\lceil\log_2 n\rceil\f$ instead of \f$n\f$.
+  //!    5. The polynomial is evaluated as \f$E(x^2)+O(x^2)x\f$ where \f$E\f$ and \f$O\f$ gather the
+  //!       even and odd power coefficients. The two Horner chains are independent and run in parallel.
+  //!    6. The polynomial is evaluated at each element of `xs` and the values are stored in `rs`.
+  //!       The coefficients are splatted once and kept in registers for all the points, which are processed
+  //!       by chunks of the native SIMD cardinal. Only the `min(xs.size(), rs.size())` first values are computed.
+  //!       Options 3 to 5 can be used along.
+  //!
+  //!       `left`, `right`, `estrin` and `second_order` can be combined and all lead to the same
+  //!       mathematical result, only rounding errors differ.
+  //!    7. For real and complex values, the compensated Horner scheme is used: the rounding errors of each
+  //!       step, obtained by error free transformations, are evaluated along by a second Horner chain and added
+  //!       at the end. The result is as accurate as if computed in twice the working precision for about
+  //!       three times the cost. It takes precedence over `estrin` and `second_order`.
   //!
   //!    **Notes**
   //!
@@ -108,24 +152,98 @@ namespace kyosu
 
 namespace kyosu::_
 {
+  //===-------------------------------------------------------------------------------------------
+  //  Estrin scheme: c is a tuple of coefficients by increasing power order.
+  //  Each level folds adjacent pairs as c_2i + c_2i+1 x and squares x.
+  //===-------------------------------------------------------------------------------------------
+  template<bool Right, typename X, typename C>
+  KYOSU_FORCEINLINE constexpr auto estrin_fold(X const& x, C const& c) noexcept
+  {
+    constexpr std::size_t n = kumi::size_v<C>;
+    if constexpr (n == 1) return kumi::get<0>(c);
+    else
+    {
+      auto pair = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+        if constexpr (2 * I + 1 == n) return kumi::get<2 * I>(c);
+        else if constexpr (Right) return kyosu::fma(x, kumi::get<2 * I + 1>(c), kumi::get<2 * I>(c));
+        else return kyosu::fma(kumi::get<2 * I + 1>(c), x, kumi::get<2 * I>(c));
+      };
+
+      auto folded = [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return kumi::tuple{pair(std::integral_constant<std::size_t, I>{})...};
+      }(std::make_index_sequence<(n + 1) / 2>{});
+
+      return estrin_fold<Right>(kyosu::sqr(x), folded);
+    }
+  }
+
+  //===-------------------------------------------------------------------------------------------
+  //  Second order Horner scheme: c is a tuple of coefficients by increasing power order.
+  //  Even and odd coefficients are evaluated by two independent Horner chains in x^2.
+  //===-------------------------------------------------------------------------------------------
+  template<bool Right, typename X, typename C>
+  KYOSU_FORCEINLINE constexpr auto second_order_fold(X const& x, C const& c) noexcept
+  {
+    constexpr std::size_t n = kumi::size_v<C>;
+    if constexpr (n == 1) return kumi::get<0>(c);
+    else
+    {
+      auto x2 = kyosu::sqr(x);
+      auto chain = [&]<std::size_t Start>(std::integral_constant<std::size_t, Start>) {
+        constexpr std::size_t m = (n - Start + 1) / 2;
+        auto that = kumi::get<Start + 2 * (m - 1)>(c);
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+          if constexpr (Right) ((that = kyosu::fma(x2, that, kumi::get<Start + 2 * (m - 2 - I)>(c))), ...);
+          else ((that = kyosu::fma(that, x2, kumi::get<Start + 2 * (m - 2 - I)>(c))), ...);
+        }(std::make_index_sequence<m - 1>{});
+        return that;
+      };
+
+      auto even = chain(std::integral_constant<std::size_t, 0>{});
+      auto odd = chain(std::integral_constant<std::size_t, 1>{});
+      if constexpr (Right) return kyosu::fma(x, odd, even);
+      else return kyosu::fma(odd, x, even);
+    }
+  }
+
   template<typename X, concepts::cayley_dickson_like Z, typename... Zs, eve::callable_options O>
   KYOSU_FORCEINLINE constexpr auto horner_(KYOSU_DELAY(), O const& o, X xx, Z z, Zs... zs) noexcept
   {
-    if constexpr ((concepts::real<X> && ... && concepts::real<Zs>)) { return eve::horner[o](xx, z, zs...); }
+    constexpr bool reordered = O::contains(estrin) || O::contains(second_order);
+    constexpr bool right = O::contains(eve::right);
+    constexpr bool compensated = O::contains(eve::kahan) && concepts::complex_like<as_cayley_dickson_like_t<X, Z, Zs...>>;
+
+    if constexpr (!reordered && !compensated && concepts::real<X> && concepts::real<Z> && (... && concepts::real<Zs>))
+    {
+      return eve::horner[o](xx, z, zs...);
+    }
     else
     {
       using r_t = as_cayley_dickson_like_t<X, Z, Zs...>;
       constexpr size_t N = sizeof...(Zs);
 
-      if constexpr (N == 0) return r_t(0);
-      else if constexpr (N == 1) return convert(z, eve::as_element<r_t>{});
+      if constexpr (N == 0) return convert(z, eve::as_element<r_t>{});
       else
       {
         r_t x = r_t(xx);
-        r_t that(z);
-        if constexpr (O::contains(eve::right)) { ((that = fma(x, that, convert(zs, eve::as_element<r_t>{}))), ...); }
-        else { ((that = fma(that, x, convert(zs, eve::as_element<r_t>{}))), ...); }
-        return that;
+        if constexpr (compensated)
+        {
+          return compensated_horner(x, r_t(convert(z, eve::as_element<r_t>{})),
+                                    r_t(convert(zs, eve::as_element<r_t>{}))...);
+        }
+        else if constexpr (reordered)
+        {
+          auto c = kumi::reverse(kumi::tuple{convert(z, eve::as_element<r_t>{}), convert(zs, eve::as_element<r_t>{})...});
+          if constexpr (O::contains(estrin)) return estrin_fold<right>(x, c);
+          else return second_order_fold<right>(x, c);
+        }
+        else
+        {
+          r_t that(z);
+          if constexpr (right) { ((that = fma(x, that, convert(zs, eve::as_element<r_t>{}))), ...); }
+          else { ((that = fma(that, x, convert(zs, eve::as_element<r_t>{}))), ...); }
+          return that;
+        }
       }
     }
   }
@@ -137,4 +255,21 @@ namespace kyosu::_
     auto x = convert(xx, eve::as_element<r_t>());
     return kumi::apply([&](auto... m) { return horner[o](x, convert(m, eve::as_element<r_t>())...); }, tup);
   }
+
+  template<typename X, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void horner_(KYOSU_DELAY(),
+                                           O const& o,
+                                           std::span<X, S1> xs,
+                                           coefficients<Data> const& tup,
+                                           std::span<R, S2> rs) noexcept
+  {
+    // Coefficients are splatted once so that the loop body only performs the fma chain
+    using w_t = as_cayley_dickson_like_t<bulk_wide_t<X>, coefficients<Data>>;
+    auto wc = coefficients(kumi::map([](auto m) { return w_t(convert(m, eve::as_element<w_t>())); }, tup));
+
+    bulk_apply(xs, rs, [&](auto x) {
+      if constexpr (eve::simd_value<decltype(x)>) return horner[o](x, wc);
+      else return horner[o](x, tup);
+    });
+  }
 }
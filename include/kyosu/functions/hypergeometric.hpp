@@ -19,6 +19,9 @@
 #include <kyosu/details/hyperg/hyp2_1.hpp>
 #include <kyosu/details/hyperg/hyp2_2.hpp>
 
+#include <kyosu/details/hyperg/hyp_pq.hpp>
+#include <kyosu/details/bulk.hpp>
+
 namespace kyosu
 {
   template<typename Options>
@@ -52,13 +55,26 @@ namespace kyosu
         else return _::hyperg(z, a, b, kyosu::regularized);
       }
     }
+
+    template<concepts::complex_like Z, std::size_t S1, eve::product_type T1, eve::product_type T2, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE void operator()(std::span<Z, S1> zs, T1 a, T2 b, std::span<R, S2> rs) const noexcept
+    requires(std::same_as<R, res_t<std::remove_cv_t<Z>, T1, T2>>)
+    {
+      constexpr bool reg = Options::contains(kyosu::regularized) && !T2::empty();
+      if constexpr (eve::scalar_value<R> && kumi::size_v<T1> == 2 && kumi::size_v<T2> == 1)
+      {
+        if constexpr (reg) _::hyperg(zs, a, b, rs, kyosu::regularized);
+        else _::hyperg(zs, a, b, rs);
+      }
+      else _::bulk_apply(zs, rs, [&](auto z) { return (*this)(z, a, b); });
+    }
   };
 
   //======================================================================================================================
   //! @addtogroup functions
   //! @{
   //!   @var hypergeometric
-  //!   @brief Computes the hypergeometric function \f${}_pF_q(a_1, \dots, a_p; b_1,\dots, b_p; z)\f$ for \f$ 0 \le p,  q \le 2\f$.
+  //!   @brief Computes the hypergeometric function \f${}_pF_q(a_1, \dots, a_p; b_1,\dots, b_p; z)\f$ for \f$ 0 \le p,  q \le 6\f$.
   //!
   //!   **Defined in Header**
   //!
@@ -76,6 +92,9 @@ namespace kyosu
   //!
   //!      // Semantic modifyiers
   //!     constexpr auto hypergeometric[regularized](auto z, auto a, auto b) noexcept; // 2
+  //!
+  //!      // Batch evaluation
+  //!     constexpr void hypergeometric(std::span<Z> zs, auto a, auto b, std::span<R> rs) noexcept; // 3
   //!   }
   //!   @endcode
   //!
@@ -84,6 +103,7 @@ namespace kyosu
   //!     * `a`: homogeneous kumi tuple of size p
   ///!    * `b`: homogeneous kumi tuple of size q
   //!     * `z`: Value to process.
+  //!     * `zs`, `rs`: spans of input points and of output values.
   //!
   //!   **Return value**
   //!
@@ -94,8 +114,14 @@ namespace kyosu
   //!       * if \f$p > q + 1\f$: the series converges only for \f$z = 0\f$ unless the
   //!          summation stops, an \f$a_i\f$ or \f$b_i\f$ being a non positive flint and the polynomial is so defined everywhere.
   //!     2. With the regularized option the result is divided by the product of the \f$\Gamma(b_i)\f$ extended to the elements of the `b` tuple.
+  //!     3. computes 1. or 2. at each element of `zs` and stores the results in `rs`. For \f${}_2F_1\f$ with scalar
+  //!        parameters, the points are grouped by the series used to compute them, so that each SIMD chunk
+  //!        sums only one series.
+  //!
+  //!     For \f${}_2F_1\f$ and \f${}_1F_1\f$ evaluated many times with the same scalar parameters, kyosu::prepare
+  //!     builds an evaluator that computes the parameter dependent quantities once.
   //!
-  //!     Up to now the only implemented functions are for size of `a` and `b` tuples running from 0 to 2. And some can have flaws.
+  //!     Up to now the implemented functions are for size of `a` and `b` tuples running from 0 to 6. And some can have flaws.
   //!
   //!   @note hypergeometric functons are a kind of jungle. As **KYOSU** and **EVE** only use standard floating types as base of computations,
   //!         overflows or lack of precision along large computation or huge values can degrade the accuracy.
@@ -118,9 +144,15 @@ namespace kyosu
   //!      and \f${}_2F_2(z, \{a_0, a_1\}, \{b_0, b_1\})\f$ are always computed using the standard serie definition, it implies that their results are only correct
   //!      for small values of `|z|`.
   //!   * The serie defining \f${}_2F_0(z, \{a_0, a_1\}, \{\})\f$ is generally never convergent (but at zero) except when a component of `a` is a nonpositive integer.
+  //!   * When \f$p\f$ or \f$q\f$ is greater than 2, the series is summed directly with vectorized Pochhammer term ratios.
+  //!     If \f$p = q+1\f$ and \f$|z|\f$ is close to or greater than 1, or if \f$p > q+1\f$, its first terms are summed
+  //!     using the Levin u and Weniger \f$\delta\f$ sequence transformations, the one with the smallest error
+  //!     estimate being retained. A `fnan` is returned if this estimate is greater than \f$\sqrt\epsilon\f$.
   //!   * Implementation of \f${}_2F_1(z, \{a_0, a_1\}, \{b\})\f$ which is the proper hypergeometric function is mainly inspired by the article :
   //!     Fast computation of the Gauss hypergeometric function with all its parameters complex with application to the
   //!     Poschl-Teller-Ginocchio potential wave functions by N. Michel and M.V. Stoitsov, adapted to perform SIMD calls
+  //!     Each lane is first resolved to one transformation and one series (around 0, infinity, 1 or the
+  //!     continuation formula), then each series is summed once on the lanes that need it.
   //!
   //!  @groupheader{Example}
   //!  @godbolt{doc/hypergeometric.cpp}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <kyosu/details/hyperg/hyp1_1.hpp>
+#include <kyosu/details/instrument.hpp>
 #include <kyosu/functions/tgamma_inv.hpp>
 
 namespace kyosu
@@ -65,6 +66,8 @@ namespace kyosu
   //!     2. With the regularized options, returns the value at `z` of the Regularized Kummer function \f$\mathbf{M}\f$,
   //!        i.e. \f$M\f$ divided by \f$\Gamma(b)\f$, well defined even if `b` is a negative integer.
   //!
+  //!     `kyosu::prepare(kyosu::kummer, a, b)` builds an evaluator for fixed scalar parameters.
+  //!
   //!  @groupheader{External references}
   //!   *  [DLMF: Kummer Functions](https://dlmf.nist.gov/13.2)
   //!   *  [Wolfram MathWorld:Confluent Hypergeometric Function of the Second Kind ](https://mathworld.wolfram.com/ConfluentHypergeometricFunctionoftheSecondKind.html)
@@ -127,11 +130,16 @@ namespace kyosu::_
           auto r = kyosu::dec(a + j) / (j * kyosu::dec(b + j));
           s3 = s2 + (s2 - s1) * r * z;
           auto small = kyosu::linfnorm[kyosu::flat](s3 - s2) < kyosu::linfnorm[kyosu::flat](s1) * tol;
-          if (eve::all(small && smallp)) return gb * s3;
+          if (eve::all(small && smallp))
+          {
+            KYOSU_INSTRUMENT_ITERATIONS("kummer", "series", j - 2);
+            return gb * s3;
+          }
           s1 = s2;
           s2 = s3;
           smallp = small;
         }
+        KYOSU_INSTRUMENT_ITERATIONS("kummer", "series", Maxit - 2);
         return if_else(smallp, gb * s3, allbits);
       };
 
@@ -140,11 +148,17 @@ namespace kyosu::_
 
       if (eve::any(notdone))
       {
+        KYOSU_INSTRUMENT_BRANCH("kummer", "zero", notdone && abnegint);
         notdone = next_interval(br_abnegint, notdone, abnegint, r);
         if (eve::any(notdone))
         {
+          KYOSU_INSTRUMENT_BRANCH("kummer", "polynomial", notdone && anegintnotb);
           notdone = next_interval(br_anegintnotb, notdone, anegintnotb, r);
-          if (eve::any(notdone)) { notdone = last_interval(br_regular, notdone, r, notdone); }
+          if (eve::any(notdone))
+          {
+            KYOSU_INSTRUMENT_BRANCH("kummer", "regular", notdone);
+            notdone = last_interval(br_regular, notdone, r, notdone);
+          }
         }
         return r;
       }
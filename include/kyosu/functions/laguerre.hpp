@@ -0,0 +1,213 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright: KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/details/callable.hpp>
+#include <kyosu/functions/hypergeometric.hpp>
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/clenshaw.hpp>
+
+namespace kyosu
+{
+  template<typename Options>
+  struct laguerre_t : eve::strict_elementwise_callable<laguerre_t, Options, raw_option, pedantic_option, eve::successor_option>
+  {
+    template<concepts::real N, concepts::cayley_dickson Z>
+    KYOSU_FORCEINLINE constexpr auto operator()(N nn, Z zz) const noexcept -> decltype(nn + zz)
+    {
+      using r_t = decltype(nn + zz);
+      auto n = r_t(nn);
+      auto z = r_t(zz);
+      auto r = kyosu::hypergeometric(z, kumi::tuple{-n}, kumi::tuple{eve::one(eve::as<eve::underlying_type_t<r_t>>())});
+      return if_else(is_real(z), complex(real(r)), r);
+    }
+
+    template<concepts::real N, concepts::real Z>
+    KYOSU_FORCEINLINE constexpr auto operator()(N n, Z z) const noexcept -> decltype(n + complex(z))
+    {
+      return (*this)(n, complex(z));
+    }
+
+    // Recurrence relation for Laguerre polynomials:
+    template<concepts::cayley_dickson Z, concepts::cayley_dickson T, concepts::real N>
+    KYOSU_FORCEINLINE constexpr auto operator()(N n, Z z, T ln, T lnm1) const noexcept -> decltype(z + ln)
+    {
+      auto np1 = kyosu::inc(n);
+      return ((n + np1 - z) * ln - n * lnm1) / np1;
+    }
+
+    template<concepts::real Z, concepts::cayley_dickson T, concepts::real N>
+    KYOSU_FORCEINLINE constexpr auto operator()(N n, Z z, T ln, T lnm1) const noexcept -> decltype(z + ln)
+    {
+      return (*this)(n, complex(z), ln, lnm1);
+    }
+
+    // Clenshaw evaluation of Laguerre series
+    template<concepts::cayley_dickson_like Z, eve::non_empty_product_type Data>
+    KYOSU_FORCEINLINE constexpr as_cayley_dickson_like_t<Z, coefficients<Data>> operator()(
+      Z z, coefficients<Data> const& c) const noexcept
+    {
+      return KYOSU_CALL(z, c);
+    }
+
+    template<concepts::cayley_dickson_like Z, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(std::span<Z, S1> zs,
+                                                coefficients<Data> const& c,
+                                                std::span<R, S2> rs) const noexcept
+    requires(std::same_as<R, as_cayley_dickson_like_t<std::remove_cv_t<Z>, coefficients<Data>>>)
+    {
+      KYOSU_CALL(zs, c, rs);
+    }
+
+    // Sequences of Laguerre polynomials
+    template<concepts::cayley_dickson_like Z, typename R, std::size_t S>
+    KYOSU_FORCEINLINE constexpr void operator()(Z z, std::span<R, S> ps) const noexcept
+    requires(std::same_as<R, Z>)
+    {
+      KYOSU_CALL(z, ps);
+    }
+
+    template<concepts::cayley_dickson_like Z, std::size_t S1, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(std::span<Z, S1> zs, std::span<R, S2> ps) const noexcept
+    requires(std::same_as<R, std::remove_cv_t<Z>>)
+    {
+      KYOSU_CALL(zs, ps);
+    }
+
+    KYOSU_CALLABLE_OBJECT(laguerre_t, laguerre_);
+  };
+
+  //================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var laguerre
+  //!   @brief Computes the value of the Laguerre polynomial of order `n` at `z`:
+  //!
+  //!    * The Laguerre polynomial of order n is given by \f$\displaystyle \mbox{L}_{n}(z)
+  //!      = \frac{e^z}{n!}\frac{d^n}{dz^n}(z^ne^{-z})\f$.
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/functions.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve
+  //!   {
+  //!      // Regular overload
+  //!      auto constexpr laguerre(kyosu::concepts::real auto n, kyosu::concepts::cayley_dickson auto z) noexcept; // 1
+  //!      auto constexpr laguerre(kyosu::concepts::real auto n, kyosu::concepts::real auto z)           noexcept; // 1
+  //!
+  //!      // Lanes masking
+  //!      constexpr auto laguerre[conditional_expr auto c](/* any previous overload */)                 noexcept; // 2
+  //!      constexpr auto laguerre[logical_value auto m](/* any previous overload */)                    noexcept; // 2
+  //!
+  //!      // Semantic options
+  //!      constexpr auto laguerre[successor](integral_value auto n,
+  //!                                         kyosu::concepts::cayley_dickson auto z,
+  //!                                         kyosu::concepts::cayley_dickson auto ln,
+  //!                                         kyosu::concepts::cayley_dickson auto lnm1)                  noexcept; // 3
+  //!
+  //!      // Series evaluation
+  //!      auto constexpr laguerre(kyosu::concepts::cayley_dickson_like auto z, auto coefs)              noexcept; // 4
+  //!      constexpr void laguerre(std::span<Z> zs, auto coefs, std::span<R> rs)                         noexcept; // 5
+  //!
+  //!      // Sequences
+  //!      constexpr void laguerre(kyosu::concepts::cayley_dickson_like auto z, std::span<R> ps)         noexcept; // 6
+  //!      constexpr void laguerre(std::span<Z> zs, std::span<R> ps)                                     noexcept; // 7
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `n`: real positive argument.
+  //!     * `z`: cayley_dickson or real argument
+  //!     * `ln`, `lnm1`: cayley_dickson arguments
+  //!     * `coefs` : kyosu::coefficients of the series by increasing degree.
+  //!     * `zs`, `rs` : spans of input points and of output values.
+  //!     * `ps` : span receiving the values of the successive polynomials.
+  //!     * `c`: [Conditional expression](@ref eve::conditional_expr) masking the operation.
+  //!     * `m`: [Logical value](@ref eve::logical_value) masking the operation.
+  //!
+  //!    **Return value**
+  //!
+  //!      1. The value of the Laguerre polynomial of order `n` at `z` is returned.
+  //!      2. [The operation is performed conditionnaly](@ref conditional).
+  //!      3. The `successor` option implements the three term recurrence relation for the
+  //!         Laguerre polynomials, \f$\displaystyle \mbox{L}_{n+1} =
+  //!         \left((2n+1-z)\mbox{L}_{n}(z)-n\mbox{L}_{n-1}(z)\right)/(n+1)\f$.
+  //!      4. computes \f$\sum_{k=0}^{n-1} c_k\mbox{L}_k(z)\f$ using the Clenshaw backward recurrence,
+  //!         which costs \f$O(n)\f$ fma and no hypergeometric evaluation.
+  //!         For non commutative algebras, the coefficients are on the left of the polynomials.
+  //!         Unlike 1., real inputs lead to a real result.
+  //!      5. computes 4. at each element of `zs` and stores the results in `rs`.
+  //!      6. fills `ps` with \f$L_0(z), \dots, L_{m-1}(z)\f$ where `m` is the size of `ps`,
+  //!         using the three term recurrence.
+  //!      7. fills the row-major matrix `ps` of `m = ps.size()/zs.size()` rows with \f$L_k(zs_j)\f$
+  //!         at row `k` and column `j`. The recurrence runs on SIMD chunks of points.
+  //!
+  //!  @groupheader{External references}
+  //!   *  [DLMF: Classical Orthogonal Polynomials](https://dlmf.nist.gov/18.3)
+  //!   *  [C++ standard reference: laguerre](https://en.cppreference.com/w/cpp/numeric/special_functions/laguerre)
+  //!   *  [Wolfram MathWorld: Laguerre Polynomial](https://mathworld.wolfram.com/LaguerrePolynomial.html)
+  //!
+  //!   @groupheader{Example}
+  //!   @godbolt{doc/laguerre.cpp}
+  //================================================================================================
+  inline constexpr auto laguerre = eve::functor<laguerre_t>;
+  //================================================================================================
+  //! @}
+  //================================================================================================
+}
+
+namespace kyosu::_
+{
+  // (k+1) L_k+1 = (2k+1-z) L_k - k L_k-1, with L_1 = 1-z
+  template<typename U, typename Z> KYOSU_FORCEINLINE constexpr auto laguerre_recurrence(Z z) noexcept
+  {
+    auto alpha = [z](std::size_t k) { return (U(2 * k + 1) - z) / U(k + 1); };
+    auto beta = [](std::size_t k) { return -U(k) / U(k + 1); };
+    return kumi::tuple{alpha, beta, oneminus(z)};
+  }
+
+  template<typename Z, eve::non_empty_product_type Data, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr auto laguerre_(KYOSU_DELAY(), O const&, Z z, coefficients<Data> const& c) noexcept
+  {
+    using r_t = as_cayley_dickson_like_t<Z, coefficients<Data>>;
+    auto [alpha, beta, p1] = laguerre_recurrence<eve::underlying_type_t<r_t>>(z);
+    return clenshaw<r_t>(c, alpha, beta, p1);
+  }
+
+  template<typename Z, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void laguerre_(KYOSU_DELAY(),
+                                             O const& o,
+                                             std::span<Z, S1> zs,
+                                             coefficients<Data> const& c,
+                                             std::span<R, S2> rs) noexcept
+  {
+    bulk_apply(zs, rs, [&](auto z) { return laguerre[o](z, c); });
+  }
+
+  template<typename Z, typename R, std::size_t S, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void laguerre_(KYOSU_DELAY(), O const&, Z z, std::span<R, S> ps) noexcept
+  {
+    auto [alpha, beta, p1] = laguerre_recurrence<eve::underlying_type_t<R>>(z);
+    forward_recurrence<R>(ps.size(), alpha, beta, p1, [&](std::size_t k, R const& v) { ps[k] = v; });
+  }
+
+  template<typename Z, std::size_t S1, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void laguerre_(KYOSU_DELAY(), O const&, std::span<Z, S1> zs, std::span<R, S2> ps) noexcept
+  {
+    bulk_columns(zs, ps, [&](auto z, std::size_t n, auto store) {
+      auto [alpha, beta, p1] = laguerre_recurrence<eve::underlying_type_t<R>>(z);
+      forward_recurrence<decltype(z)>(n, alpha, beta, p1, store);
+    });
+  }
+}
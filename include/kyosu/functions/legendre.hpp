@@ -10,6 +10,8 @@
 #include <kyosu/functions/hypergeometric.hpp>
 #include <kyosu/functions/acos.hpp>
 #include <kyosu/functions/cos.hpp>
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/clenshaw.hpp>
 
 namespace kyosu
 {
@@ -47,6 +49,40 @@ namespace kyosu
     {
       return (*this)(n, complex(z), pn, pnm1);
     }
+
+    // Clenshaw evaluation of Legendre series
+    template<concepts::cayley_dickson_like Z, eve::non_empty_product_type Data>
+    KYOSU_FORCEINLINE constexpr as_cayley_dickson_like_t<Z, coefficients<Data>> operator()(
+      Z z, coefficients<Data> const& c) const noexcept
+    {
+      return KYOSU_CALL(z, c);
+    }
+
+    template<concepts::cayley_dickson_like Z, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(std::span<Z, S1> zs,
+                                                coefficients<Data> const& c,
+                                                std::span<R, S2> rs) const noexcept
+    requires(std::same_as<R, as_cayley_dickson_like_t<std::remove_cv_t<Z>, coefficients<Data>>>)
+    {
+      KYOSU_CALL(zs, c, rs);
+    }
+
+    // Sequences of Legendre polynomials
+    template<concepts::cayley_dickson_like Z, typename R, std::size_t S>
+    KYOSU_FORCEINLINE constexpr void operator()(Z z, std::span<R, S> ps) const noexcept
+    requires(std::same_as<R, Z>)
+    {
+      KYOSU_CALL(z, ps);
+    }
+
+    template<concepts::cayley_dickson_like Z, std::size_t S1, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(std::span<Z, S1> zs, std::span<R, S2> ps) const noexcept
+    requires(std::same_as<R, std::remove_cv_t<Z>>)
+    {
+      KYOSU_CALL(zs, ps);
+    }
+
+    KYOSU_CALLABLE_OBJECT(legendre_t, legendre_);
   };
 
   //================================================================================================
@@ -84,6 +120,14 @@ namespace kyosu
   //!                                         kyosu::concepts::cayley_dickson auto z,
   //!                                         kyosu::concepts::cayley_dickson auto pn,
   //!                                         kyosu::concepts::cayley_dickson auto pnm1)                  noexcept; // 3
+  //!
+  //!      // Series evaluation
+  //!      auto constexpr legendre(kyosu::concepts::cayley_dickson_like auto z, auto coefs)              noexcept; // 4
+  //!      constexpr void legendre(std::span<Z> zs, auto coefs, std::span<R> rs)                         noexcept; // 5
+  //!
+  //!      // Sequences
+  //!      constexpr void legendre(kyosu::concepts::cayley_dickson_like auto z, std::span<R> ps)         noexcept; // 6
+  //!      constexpr void legendre(std::span<Z> zs, std::span<R> ps)                                     noexcept; // 7
   //!   }
   //!   @endcode
   //!
@@ -92,6 +136,9 @@ namespace kyosu
   //!     * `n`: real positive argument.
   //!     * `z`: cayley_dickson or real argument
   //!     * `pn`, `pnm1`: cayley_dickson arguments
+  //!     * `coefs` : kyosu::coefficients of the series by increasing degree.
+  //!     * `zs`, `rs` : spans of input points and of output values.
+  //!     * `ps` : span receiving the values of the successive polynomials.
   //!     * `c`: [Conditional expression](@ref eve::conditional_expr) masking the operation.
   //!     * `m`: [Logical value](@ref eve::logical_value) masking the operation.
   //!
@@ -102,6 +149,15 @@ namespace kyosu
   //!      3. The `successor` option implements the three term recurrence relation for the
   //!         (associated) Legendre functions, \f$\displaystyle \mbox{P}_{l+1} =
   //!         \left((2l+1)\mbox{P}_{l}(x)-l\mbox{P}_{l-1}(x)\right)/(l+1)\f$.
+  //!      4. computes \f$\sum_{k=0}^{n-1} c_k\mbox{P}_k(z)\f$ using the Clenshaw backward recurrence,
+  //!         which costs \f$O(n)\f$ fma and no hypergeometric evaluation.
+  //!         For non commutative algebras, the coefficients are on the left of the polynomials.
+  //!         Unlike 1., real inputs lead to a real result.
+  //!      5. computes 4. at each element of `zs` and stores the results in `rs`.
+  //!      6. fills `ps` with \f$P_0(z), \dots, P_{m-1}(z)\f$ where `m` is the size of `ps`,
+  //!         using the three term recurrence.
+  //!      7. fills the row-major matrix `ps` of `m = ps.size()/zs.size()` rows with \f$P_k(zs_j)\f$
+  //!         at row `k` and column `j`. The recurrence runs on SIMD chunks of points.
   //!
   //!  @groupheader{External references}
   //!   *  [DLMF: Classical Orthogonal Polynomials](https://dlmf.nist.gov/18.3)
@@ -116,3 +172,48 @@ namespace kyosu
   //! @}
   //================================================================================================
 }
+
+namespace kyosu::_
+{
+  // (k+1) P_k+1 = (2k+1) z P_k - k P_k-1, with P_1 = z
+  template<typename U, typename Z> KYOSU_FORCEINLINE constexpr auto legendre_recurrence(Z z) noexcept
+  {
+    auto alpha = [z](std::size_t k) { return (U(2 * k + 1) / U(k + 1)) * z; };
+    auto beta = [](std::size_t k) { return -U(k) / U(k + 1); };
+    return kumi::tuple{alpha, beta, z};
+  }
+
+  template<typename Z, eve::non_empty_product_type Data, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr auto legendre_(KYOSU_DELAY(), O const&, Z z, coefficients<Data> const& c) noexcept
+  {
+    using r_t = as_cayley_dickson_like_t<Z, coefficients<Data>>;
+    auto [alpha, beta, p1] = legendre_recurrence<eve::underlying_type_t<r_t>>(z);
+    return clenshaw<r_t>(c, alpha, beta, p1);
+  }
+
+  template<typename Z, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void legendre_(KYOSU_DELAY(),
+                                             O const& o,
+                                             std::span<Z, S1> zs,
+                                             coefficients<Data> const& c,
+                                             std::span<R, S2> rs) noexcept
+  {
+    bulk_apply(zs, rs, [&](auto z) { return legendre[o](z, c); });
+  }
+
+  template<typename Z, typename R, std::size_t S, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void legendre_(KYOSU_DELAY(), O const&, Z z, std::span<R, S> ps) noexcept
+  {
+    auto [alpha, beta, p1] = legendre_recurrence<eve::underlying_type_t<R>>(z);
+    forward_recurrence<R>(ps.size(), alpha, beta, p1, [&](std::size_t k, R const& v) { ps[k] = v; });
+  }
+
+  template<typename Z, std::size_t S1, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void legendre_(KYOSU_DELAY(), O const&, std::span<Z, S1> zs, std::span<R, S2> ps) noexcept
+  {
+    bulk_columns(zs, ps, [&](auto z, std::size_t n, auto store) {
+      auto [alpha, beta, p1] = legendre_recurrence<eve::underlying_type_t<R>>(z);
+      forward_recurrence<decltype(z)>(n, alpha, beta, p1, store);
+    });
+  }
+}
@@ -9,11 +9,12 @@
 #include <kyosu/details/callable.hpp>
 #include <kyosu/functions/to_polar.hpp>
 #include <kyosu/functions/muli.hpp>
+#include <kyosu/functions/sqr_abs.hpp>
 
 namespace kyosu
 {
   template<typename Options>
-  struct log_t : eve::strict_elementwise_callable<log_t, Options, raw_option, radpi_option, real_only_option, pedantic_option>
+  struct log_t : eve::strict_elementwise_callable<log_t, Options, raw_option, radpi_option, real_only_option, pedantic_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z>
     KYOSU_FORCEINLINE constexpr complexify_if_t<Options, Z> operator()(Z const& z) const noexcept
@@ -55,6 +56,7 @@ namespace kyosu
   //!
   //!      // semantic modifyers
   //!      template<concepts::real T> constexpr complexify_t<T> log[real_only](T z) noexcept;
+  //!      template<kyosu::concepts::cayley_dickson_like T> constexpr complexify_t<T> log[fast](T z) noexcept;
   //!   }
   //!   @endcode
   //!
@@ -88,6 +90,9 @@ namespace kyosu
   //!      * If z is \f$\textrm{NaN}+i \textrm{NaN}\f$, the result is \f$\textrm{NaN}+i \textrm{NaN}\f$
   //!    - For general cayley_dickson entry`log(z)` is semantically equivalent to `log(abs(z)) + sign(pure(z)) * arg(z)`
   //!    - with two parameters return the nth branch of the logarithm.
+  //!    - with the fast option, the real part is computed as \f$\log(|z|^2)/2\f$ without scaling and no
+  //!      special value is handled. For \f$|z|^2\f$ in the normal range the absolute error of both parts is
+  //!      less than 2 epsilon (a relative error for the imaginary part and away from \f$|z| = 1\f$ for the real one).
   //!
   //!  @groupheader{External references}
   //!   *  [Wolfram MathWorld: Logarithm](https://mathworld.wolfram.com/Logarithm.html)
@@ -109,8 +114,13 @@ namespace kyosu::_
   template<concepts::cayley_dickson_like Z, eve::callable_options O>
   KYOSU_FORCEINLINE constexpr auto log_(KYOSU_DELAY(), O const& o, Z z) noexcept
   {
-    if constexpr (O::contains(real_only) && concepts::real<Z>) return eve::log[o.drop(real_only)](z);
+    if constexpr (O::contains(real_only) && concepts::real<Z>) return eve::log[o.drop(real_only, fast)](z);
     else if constexpr (concepts::real<Z>) return kyosu::log[o.drop(radpi)](complex(z));
+    else if constexpr (kyosu::concepts::complex<Z> && O::contains(fast))
+    {
+      auto lr = eve::log(kyosu::sqr_abs(z));
+      return Z(eve::half(eve::as(lr)) * lr, kyosu::arg[fast](z));
+    }
     else if constexpr (kyosu::concepts::complex<Z>)
     {
       auto [rho, theta] = to_polar[o](z);
@@ -21,7 +21,7 @@
 
 namespace kyosu
 {
-  template<typename Options> struct pow_t : eve::callable<pow_t, Options, raw_option, real_only_option, pedantic_option>
+  template<typename Options> struct pow_t : eve::callable<pow_t, Options, raw_option, real_only_option, pedantic_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z0, concepts::cayley_dickson_like Z1>
     KYOSU_FORCEINLINE constexpr auto operator()(Z0 z0, Z1 z1) const noexcept
@@ -69,6 +69,7 @@ namespace kyosu
   //!   {
   //!     constexpr auto pow(auto z0, auto z1) noexcept;                \\123
   //!     constexpr auto pow(auto z0, eve::integral_value n)  noexcept; \\4
+  //!     constexpr auto pow[fast](auto z0, auto z1) noexcept;          \\5
   //!   }
   //!   @endcode
   //!
@@ -115,6 +116,10 @@ namespace kyosu
   //!         that is used (feasible as every monogen ideals are commutative).
   //!         If the first parameter is integral typed the result is real typed.
   //!
+  //!      5. with the fast option and non integral exponents, `exp[fast](z1*log[fast](z0))` is returned and none of the
+  //!         above special values is handled. The relative error is bounded by a few ulp times
+  //!         \f$1+|z_1\log z_0|\f$, as the error on the logarithm is amplified by the exponential.
+  //!
   //!  @groupheader{External references}
   //!   *  [C++ standard reference: complex pow](https://en.cppreference.com/w/cpp/numeric/complex/pow)
   //!   *  [Wolfram MathWorld: Power](https://mathworld.wolfram.com/Power.html)
@@ -175,6 +180,10 @@ namespace kyosu::_
   requires(!eve::integral_value<C1>)
   {
     if constexpr (O::contains(real_only)) { return kyosu::inject(eve::pow(c0, c1)); }
+    else if constexpr (O::contains(fast) && concepts::complex_like<C0> && concepts::complex_like<C1>)
+    {
+      return kyosu::exp[fast](c1 * kyosu::log[fast](c0));
+    }
     else
     {
       if constexpr (concepts::real<C0> && concepts::real<C1>)
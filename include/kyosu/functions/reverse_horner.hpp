@@ -15,7 +15,8 @@
 namespace kyosu
 {
   template<typename Options>
-  struct reverse_horner_t : eve::callable<reverse_horner_t, Options, raw_option, pedantic_option, eve::left_option, eve::right_option>
+  struct reverse_horner_t
+    : eve::callable<reverse_horner_t, Options, raw_option, pedantic_option, eve::left_option, eve::right_option, estrin_option, second_order_option>
   {
     template<concepts::cayley_dickson_like... Zs>
     KYOSU_FORCEINLINE constexpr as_cayley_dickson_like_t<Zs...> operator()(Zs const&... zs) const noexcept
@@ -69,6 +70,10 @@ namespace kyosu
   //!     template<auto T, auto C ...>  auto reverse_horner[right](T x, C ... coefs) noexcept; //3
   //!     template<auto C, auto K>      auto reverse_horner[right]r(T x, K tup)      noexcept; //3
   //!
+  //!     Evaluation strategies
+  //!     template<auto T, auto C ...>  auto reverse_horner[estrin](T x, C ... coefs)       noexcept; //4
+  //!     template<auto T, auto C ...>  auto reverse_horner[second_order](T x, C ... coefs) noexcept; //4
+  //!
   //!   }
   //!   @endcode
   //!
@@ -91,6 +96,7 @@ namespace kyosu
   //!       The value of the polynom at  `x` is returned,  according to the formula:
   //!        \f$\displaystyle p(x) = (x (x (x a_{n-1}+a_{n-2})+ ... )+a_0)\f$.\n
   //!        Of course for real or complex entries left and right have no specific actions
+  //!    4. the evaluation is reordered to expose instruction level parallelism (see kyosu::horner).
   //!
   //!    **Notes**
   //!
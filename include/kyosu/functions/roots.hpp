@@ -0,0 +1,233 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright: KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+#include <kyosu/details/callable.hpp>
+#include <kyosu/functions/abs.hpp>
+#include <kyosu/functions/convert.hpp>
+#include <kyosu/functions/exp_i.hpp>
+#include <kyosu/functions/if_else.hpp>
+#include <kyosu/functions/rec.hpp>
+#include <kyosu/types/helpers.hpp>
+#include <array>
+#include <numbers>
+
+namespace kyosu::_
+{
+  template<typename Data> using roots_value_t = complexify_t<kumi::apply_traits_t<as_cayley_dickson_like, Data>>;
+}
+
+namespace kyosu
+{
+  template<typename Options> struct roots_t : eve::callable<roots_t, Options>
+  {
+    template<eve::non_empty_product_type Data>
+    requires(concepts::complex<_::roots_value_t<Data>>)
+    KYOSU_FORCEINLINE constexpr auto operator()(coefficients<Data> const& c) const noexcept
+      -> eve::zipped<std::array<_::roots_value_t<Data>, kumi::size_v<Data> - 1>,
+                     eve::as_logical_t<as_real_type_t<_::roots_value_t<Data>>>>
+    {
+      return KYOSU_CALL(c);
+    }
+
+    KYOSU_CALLABLE_OBJECT(roots_t, roots_);
+  };
+
+  //======================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var roots
+  //!   @brief Computes all the complex roots of a polynomial by the Aberth-Ehrlich method
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/functions.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu
+  //!   {
+  //!      template<auto K> auto roots(K tup) noexcept;
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `tup` : kyosu::coefficients of the polynomial of degree n, real or complex, by decreasing power order
+  //!       as for kyosu::horner. The leading coefficient must not be zero.
+  //!
+  //!   **Return value**
+  //!
+  //!     The zipped pair of an array of the n complex roots, multiple roots being repeated, and of the mask of the
+  //!     converged polynomials.
+  //!
+  //!     All the approximations of the roots are refined simultaneously by the Aberth-Ehrlich iteration
+  //!     \f$z_k \leftarrow z_k - \frac{N_k}{1 - N_k\sum_{j\neq k}\frac{1}{z_k-z_j}}\f$, \f$N_k = p(z_k)/p'(z_k)\f$,
+  //!     starting from points on the circle of radius the geometric mean of the moduli of the roots. A root is
+  //!     frozen as soon as \f$|p(z_k)|\f$ reaches the rounding error bound of its evaluation, so that it is the
+  //!     exact root of a polynomial with coefficients close to the input ones to a few ulps.
+  //!
+  //!       * If the coefficients are scalar, the approximations are stored in SIMD registers and refined by
+  //!         chunks of the native cardinal.
+  //!       * If the coefficients are SIMD values, each lane holds an independent polynomial. Each root keeps a
+  //!         mask of its converged lanes, and the iteration stops when all the lanes have converged.
+  //!
+  //!     Lanes not converged after 100 iterations hold the last approximations.
+  //!     kyosu::bulk::roots solves large batches of polynomials stored in kyosu::soa_view.
+  //!
+  //!  @groupheader{External references}
+  //!   *  [Wikipedia: Aberth method](https://en.wikipedia.org/wiki/Aberth_method)
+  //!
+  //!  @groupheader{Example}
+  //!  @godbolt{doc/roots.cpp}
+  //======================================================================================================================
+  inline constexpr auto roots = eve::functor<roots_t>;
+  //======================================================================================================================
+  //! @}
+  //======================================================================================================================
+}
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Aberth-Ehrlich iterations
+  //  z holds m blocks of approximations: one root of all the lane polynomials (m = n), or card
+  //  roots of a single polynomial whose coefficients a are splatted. others(k) returns the sum
+  //  over the other roots of 1 / (z_k - z_j). The blocks are updated in place (Gauss-Seidel) and
+  //  a lane is frozen once |p(z)| is below the rounding error bound of the Horner scheme.
+  //===-------------------------------------------------------------------------------------------
+  inline constexpr int aberth_max_iterations = 100;
+
+  // approximations on the circle of radius the geometric mean of the moduli of the roots
+  template<typename Z, typename R> KYOSU_FORCEINLINE Z aberth_guess(Z const& a0, Z const& an, R k, std::size_t n)
+  {
+    using e_t = eve::element_type_t<R>;
+    auto r = eve::pow(kyosu::abs(an) / kyosu::abs(a0), e_t(1) / e_t(n));
+    r = eve::if_else(eve::is_eqz(r) || eve::is_not_finite(r), eve::one, r);
+    return Z(r * kyosu::exp_i(k * e_t(2 * std::numbers::pi / double(n)) + e_t(0.4)));
+  }
+
+  template<typename Z, typename L, typename Others>
+  L aberth(Z const* a, std::size_t n, Z* z, L* done, std::size_t m, Others others) noexcept
+  {
+    using r_t = as_real_type_t<Z>;
+    using e_t = eve::element_type_t<r_t>;
+    auto const tol = eve::eps(eve::as<e_t>()) * e_t(4 * n);
+    auto l1 = [](Z const& c) { return eve::abs(kyosu::real(c)) + eve::abs(kyosu::imag(c)); };
+
+    L all(false);
+    for (int it = 0; it < aberth_max_iterations && !eve::all(all); ++it)
+    {
+      all = L(true);
+      for (std::size_t k = 0; k < m; ++k)
+      {
+        if (!eve::all(done[k]))
+        {
+          Z p = a[0], dp(0);
+          r_t az = kyosu::abs(z[k]), e = l1(a[0]);
+          for (std::size_t i = 1; i <= n; ++i)
+          {
+            dp = dp * z[k] + p;
+            p = p * z[k] + a[i];
+            e = e * az + l1(a[i]);
+          }
+          auto nk = p / dp;
+          auto w = nk / (e_t(1) - nk * others(k));
+          done[k] = done[k] || kyosu::abs(p) <= tol * e;
+          z[k] = kyosu::if_else(done[k], z[k], z[k] - w);
+        }
+        all = all && done[k];
+      }
+    }
+    return all;
+  }
+
+  // n roots of one polynomial per lane
+  template<typename Z, typename L> L aberth_lanes(Z const* a, std::size_t n, Z* z, L* done) noexcept
+  {
+    using r_t = as_real_type_t<Z>;
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      z[k] = aberth_guess(a[0], a[n], r_t(k), n);
+      done[k] = L(false);
+    }
+    return aberth(a, n, z, done, n, [&](std::size_t k) {
+      Z s(0);
+      for (std::size_t j = 0; j < n; ++j)
+        if (j != k) s += kyosu::rec(z[k] - z[j]);
+      return s;
+    });
+  }
+
+  // n roots of one polynomial, whose coefficients are splatted in a, by blocks of card roots
+  template<typename Z, typename L> L aberth_blocks(Z const* a, std::size_t n, Z* z, L* done) noexcept
+  {
+    using r_t = as_real_type_t<Z>;
+    using e_t = eve::element_type_t<r_t>;
+    constexpr std::size_t card = r_t::size();
+    std::size_t const m = (n + card - 1) / card;
+    auto index = [](std::size_t b) { return r_t([&](auto l, auto) { return e_t(b * card + l); }); };
+    for (std::size_t b = 0; b < m; ++b)
+    {
+      z[b] = aberth_guess(a[0], a[n], index(b), n);
+      done[b] = index(b) >= e_t(n);
+    }
+    return aberth(a, n, z, done, m, [&](std::size_t b) {
+      Z s(0);
+      auto ib = index(b);
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        auto zj = Z(kumi::tuple{r_t(kyosu::real(z[j / card]).get(j % card)),
+                                r_t(kyosu::imag(z[j / card]).get(j % card))});
+        s += kyosu::if_else(ib == e_t(j), Z(0), kyosu::rec(z[b] - zj));
+      }
+      return s;
+    });
+  }
+
+  template<eve::non_empty_product_type Data, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr auto roots_(KYOSU_DELAY(), O const&, coefficients<Data> const& c) noexcept
+  {
+    using z_t = roots_value_t<Data>;
+    using l_t = eve::as_logical_t<as_real_type_t<z_t>>;
+    constexpr std::size_t n = kumi::size_v<Data> - 1;
+    auto a = kumi::apply([](auto... m) { return std::array<z_t, n + 1>{z_t(convert(m, eve::as_element<z_t>()))...}; },
+                         c);
+    std::array<z_t, n> zs;
+    if constexpr (n == 0) return eve::zip(zs, l_t(true));
+    else if constexpr (n == 1)
+    {
+      zs[0] = -a[1] / a[0];
+      return eve::zip(zs, l_t(true));
+    }
+    else if constexpr (eve::scalar_value<z_t>)
+    {
+      using r_t = eve::wide<as_real_type_t<z_t>>;
+      using w_t = complex_t<r_t>;
+      using lw_t = eve::as_logical_t<r_t>;
+      constexpr std::size_t card = r_t::size();
+      constexpr std::size_t m = (n + card - 1) / card;
+      std::array<w_t, n + 1> wa;
+      for (std::size_t i = 0; i <= n; ++i) wa[i] = w_t(a[i]);
+      std::array<w_t, m> z;
+      std::array<lw_t, m> done;
+      auto ok = aberth_blocks(wa.data(), n, z.data(), done.data());
+      for (std::size_t k = 0; k < n; ++k)
+        zs[k] = z_t(kyosu::real(z[k / card]).get(k % card), kyosu::imag(z[k / card]).get(k % card));
+      return eve::zip(zs, l_t(eve::all(ok)));
+    }
+    else
+    {
+      std::array<l_t, n> done;
+      auto ok = aberth_lanes(a.data(), n, zs.data(), done.data());
+      return eve::zip(zs, ok);
+    }
+  }
+}
@@ -14,7 +14,7 @@
 
 namespace kyosu
 {
-  template<typename Options> struct sin_t : eve::elementwise_callable<sin_t, Options, raw_option, pedantic_option, radpi_option>
+  template<typename Options> struct sin_t : eve::elementwise_callable<sin_t, Options, raw_option, pedantic_option, radpi_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z> KYOSU_FORCEINLINE constexpr Z operator()(Z const& z) const noexcept
     {
@@ -47,6 +47,7 @@ namespace kyosu
   //!     // semantic modifyers
   //!     constexpr auto sin[radpi](cayley_dickson_like z)  noexcept; //2
   //!     constexpr auto sin[rad](cayley_dickson_like z)    noexcept; //1
+  //!     constexpr auto sin[fast](cayley_dickson_like z)   noexcept; //3
   //!   }
   //!   @endcode
   //!
@@ -61,6 +62,8 @@ namespace kyosu
   //!         where \f$I_z = \frac{\underline{z}}{|\underline{z}|}\f$ and
   //!         \f$\underline{z}\f$ is the [pure](@ref kyosu::imag ) part of \f$z\f$.
   //!     2. Returns the cosine of an argument given in \f$\pi\f$ multiples.
+  //!     3. With the fast option, no special value is handled (see kyosu::sinh). It can be combined with `radpi`.
+  //!        For finite results the relative error of each part is less than 4 ulp.
   //!
   //!  @groupheader{External references}
   //!   *  [C++ standard reference: complex sin](https://en.cppreference.com/w/cpp/numeric/complex/sin)
@@ -83,10 +86,10 @@ namespace kyosu
     template<typename Z, eve::callable_options O>
     KYOSU_FORCEINLINE constexpr Z sin_(KYOSU_DELAY(), O const& o, Z z) noexcept
     {
-      if constexpr (kyosu::concepts::real<Z>) return eve::sin[o](z);
+      if constexpr (kyosu::concepts::real<Z>) return eve::sin[o.drop(fast)](z);
       else if constexpr (concepts::complex<Z>)
       {
-        if constexpr (!O::contains(radpi)) return kyosu::muli(kyosu::sinh(Z(kyosu::mulmi(z))));
+        if constexpr (!O::contains(radpi)) return kyosu::muli(kyosu::sinh[o](Z(kyosu::mulmi(z))));
         else
         {
           auto rz = -kyosu::imag(z);
@@ -96,7 +99,7 @@ namespace kyosu
           auto [sh, ch] = eve::sinhcosh(rz);
           auto r = c * sh;
           auto i = s * ch;
-          if (eve::any(kyosu::is_not_finite(z)))
+          if (!O::contains(fast) && eve::any(kyosu::is_not_finite(z)))
           {
             r = eve::if_else(eve::is_infinite(rz) && eve::is_not_finite(iz), rz, r);
             i = eve::if_else(eve::is_infinite(rz) && eve::is_nan(iz), iz, i);
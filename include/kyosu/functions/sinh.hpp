@@ -14,7 +14,7 @@
 
 namespace kyosu
 {
-  template<typename Options> struct sinh_t : eve::elementwise_callable<sinh_t, Options, raw_option, pedantic_option>
+  template<typename Options> struct sinh_t : eve::elementwise_callable<sinh_t, Options, raw_option, pedantic_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z> KYOSU_FORCEINLINE constexpr Z operator()(Z const& z) const noexcept
     {
@@ -42,6 +42,7 @@ namespace kyosu
   //!   namespace kyosu
   //!   {
   //!      template<kyosu::concepts::cayley_dickson_like T> constexpr auto sinh(T z) noexcept; //2
+  //!      template<kyosu::concepts::cayley_dickson_like T> constexpr auto sinh[fast](T z) noexcept;
   //!   }
   //!   @endcode
   //!
@@ -66,6 +67,8 @@ namespace kyosu
   //!       * If z is \f$\textrm{NaN}\f$, the result is \f$\textrm{NaN}\f$
   //!       * If z is \f$\textrm{NaN}+i y\f$ (for any finite nonzero y), the result is \f$\textrm{NaN}+i \textrm{NaN}\f$
   //!     - The call is semantically equivalent to (exp(z)-exp(-z))/2.
+  //!     - With the fast option, \f$\cos y\sinh x + i\sin y\cosh x\f$ is returned without any special value handling.
+  //!       For finite results the relative error of each part is less than 4 ulp.
   //!
   //!  @groupheader{External references}
   //!   *  [C++ standard reference: complex sinh](https://en.cppreference.com/w/cpp/numeric/complex/sinh)
@@ -95,6 +98,7 @@ namespace kyosu::_
       auto [sh, ch] = eve::sinhcosh(rz);
       auto r = c * sh;
       auto i = s * ch;
+      if constexpr (O::contains(fast)) return Z(r, i);
       if (eve::all(kyosu::is_finite(z))) return Z(r, i);
       auto infrz = kyosu::is_infinite(rz);
       auto nanrz = kyosu::is_nan(rz);
@@ -11,7 +11,7 @@
 
 namespace kyosu
 {
-  template<typename Options> struct sqr_abs_t : eve::elementwise_callable<sqr_abs_t, Options, raw_option, pedantic_option>
+  template<typename Options> struct sqr_abs_t : eve::elementwise_callable<sqr_abs_t, Options, raw_option, pedantic_option, eve::kahan_option>
   {
     template<concepts::cayley_dickson_like Z>
     KYOSU_FORCEINLINE constexpr as_real_type_t<Z> operator()(Z z) const noexcept
@@ -41,6 +41,7 @@ namespace kyosu
   //!   {
   //!      template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T>  sqr_abs(T z)           noexcept; //1
   //!      template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T>  sqr_abs[pedantic](T z) noexcept; //2
+  //!      template<kyosu::concepts::cayley_dickson_like T> constexpr as_real_type_t<T>  sqr_abs[kahan](T z)    noexcept; //3
   //!   }
   //!   @endcode
   //!
@@ -52,6 +53,8 @@ namespace kyosu
   //!
   //!     1. Returns the squared modulus of its argument, a floating value.
   //!     2. Returns inf as soon as the sum of the non-nan squared components is infinite
+  //!     3. The squares and their sum are computed by error free transformations (`eve::two_prod`,
+  //!        `eve::two_add`), the result is then almost correctly rounded.
   //!
   //!  @groupheader{Example}
   //!
@@ -69,6 +72,19 @@ namespace kyosu::_
   KYOSU_FORCEINLINE constexpr auto sqr_abs_(KYOSU_DELAY(), O const&, Z v) noexcept
   {
     if constexpr (concepts::real<Z>) return eve::sqr(v);
+    else if constexpr (O::contains(eve::kahan))
+    {
+      as_real_type_t<Z> s(0), e(0);
+      kumi::for_each(
+        [&](auto x) {
+          auto [p, ep] = eve::two_prod(x, x);
+          auto [t, et] = eve::two_add(s, p);
+          s = t;
+          e += ep + et;
+        },
+        v);
+      return s + e;
+    }
     else if constexpr (O::contains(pedantic))
     {
       if constexpr (concepts::complex<Z>)
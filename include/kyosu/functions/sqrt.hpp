@@ -8,6 +8,7 @@
 #pragma once
 #include <kyosu/details/callable.hpp>
 #include <kyosu/functions/to_complex.hpp>
+#include <kyosu/functions/abs.hpp>
 #include <kyosu/functions/is_pure.hpp>
 #include <kyosu/functions/is_real.hpp>
 #include <kyosu/functions/is_nan.hpp>
@@ -17,7 +18,7 @@
 
 namespace kyosu
 {
-  template<typename Options> struct sqrt_t : eve::strict_elementwise_callable<sqrt_t, Options, raw_option, pedantic_option, real_only_option>
+  template<typename Options> struct sqrt_t : eve::strict_elementwise_callable<sqrt_t, Options, raw_option, pedantic_option, real_only_option, fast_option>
   {
     template<concepts::cayley_dickson_like Z>
     KYOSU_FORCEINLINE constexpr complexify_if_t<Options, Z> operator()(Z const& z) const noexcept
@@ -60,6 +61,7 @@ namespace kyosu
   //!      // semantic modifyers
   //!      template<eve::value K> constexpr auto sqrt[principal](\*any previus overload)  noexcept; //3
   //!      template<concepts::real T> constexpr auto sqrt[real_only](T z)                 noexcept; //1
+  //!      constexpr auto sqrt[fast](auto z)                                              noexcept; //4
   //!   }
   //!   @endcode
   //!
@@ -90,6 +92,9 @@ namespace kyosu
   //!        *  If z is \f$NaN+i y\f$, the result is \f$NaN+i NaN\f$
   //!        *  If z is \f$NaN+i NaN\f$, the result is \f$NaN+i NaN\f$
   //!     2. Returns the kth sqrt root of z, k is taken modulo 1; 0 is identical to 1. 1 gives the opposite root.
+  //!     4. With the fast option, the principal root is computed from \f$\sqrt{(|x|+|z|)/2}\f$ with an unscaled
+  //!        modulus and none of the above special values is handled. The relative error is less than 4 ulp as long
+  //!        as \f$|z|^2\f$ neither overflows nor underflows.
   //!
   //!  @groupheader{External references}
   //!   *  [C++ standard reference: complex cosh](https://en.cppreference.com/w/cpp/numeric/complex/sqrt)
@@ -111,8 +116,16 @@ namespace kyosu::_
   template<typename Z, eve::callable_options O>
   KYOSU_FORCEINLINE constexpr auto sqrt_(KYOSU_DELAY(), O const& o, Z z) noexcept
   {
-    if constexpr (O::contains(real_only) && concepts::real<Z>) return eve::sqrt[o.drop(real_only)](z);
-    else if constexpr (concepts::real<Z>) return sqrt(complex(z));
+    if constexpr (O::contains(real_only) && concepts::real<Z>) return eve::sqrt[o.drop(real_only, fast)](z);
+    else if constexpr (concepts::real<Z>) return sqrt[o](complex(z));
+    else if constexpr (kyosu::concepts::complex<Z> && O::contains(fast))
+    {
+      auto [rz, iz] = z;
+      auto h = eve::half(eve::as(rz));
+      auto w = eve::sqrt(h * (eve::abs(rz) + kyosu::abs[fast](z)));
+      auto t = eve::if_else(eve::is_eqz(w), eve::zero, h * iz / w);
+      return kyosu::if_else(eve::is_gez(rz), Z(w, t), Z(eve::abs(t), eve::signnz(iz) * w));
+    }
     else if constexpr (kyosu::concepts::complex<Z>)
     {
       if (eve::all(is_real(z)))
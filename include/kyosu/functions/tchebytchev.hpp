@@ -9,6 +9,8 @@
 #include <kyosu/details/callable.hpp>
 #include <kyosu/functions/hypergeometric.hpp>
 #include <kyosu/functions/cos.hpp>
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/clenshaw.hpp>
 
 namespace kyosu
 {
@@ -60,6 +62,38 @@ namespace kyosu
       return (*this)[eve::successor](complex(z), tn, tnm1);
     }
 
+    // Clenshaw evaluation of Tchebytchev series
+    template<concepts::cayley_dickson_like Z, eve::non_empty_product_type Data>
+    KYOSU_FORCEINLINE constexpr as_cayley_dickson_like_t<Z, coefficients<Data>> operator()(
+      Z z, coefficients<Data> const& c) const noexcept
+    {
+      return KYOSU_CALL(z, c);
+    }
+
+    template<concepts::cayley_dickson_like Z, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(std::span<Z, S1> zs,
+                                                coefficients<Data> const& c,
+                                                std::span<R, S2> rs) const noexcept
+    requires(std::same_as<R, as_cayley_dickson_like_t<std::remove_cv_t<Z>, coefficients<Data>>>)
+    {
+      KYOSU_CALL(zs, c, rs);
+    }
+
+    // Sequences of Tchebytchev polynomials
+    template<concepts::cayley_dickson_like Z, typename R, std::size_t S>
+    KYOSU_FORCEINLINE constexpr void operator()(Z z, std::span<R, S> ps) const noexcept
+    requires(std::same_as<R, Z>)
+    {
+      KYOSU_CALL(z, ps);
+    }
+
+    template<concepts::cayley_dickson_like Z, std::size_t S1, typename R, std::size_t S2>
+    KYOSU_FORCEINLINE constexpr void operator()(std::span<Z, S1> zs, std::span<R, S2> ps) const noexcept
+    requires(std::same_as<R, std::remove_cv_t<Z>>)
+    {
+      KYOSU_CALL(zs, ps);
+    }
+
     KYOSU_CALLABLE_OBJECT(tchebytchev_t, tchebytchev_);
   };
 
@@ -97,6 +131,14 @@ namespace kyosu
   //!      constexpr auto tchebytchev[successor]( kyosu::concepts::cayley_dickson auto z,
   //!                                                           kyosu::cayley_dickson auto tn,
   //!                                                           kyosu::cayley_dickson auto tnm1)            noexcept; // 4
+  //!
+  //!      // Series evaluation
+  //!      auto constexpr tchebytchev(kyosu::concepts::cayley_dickson_like auto z, auto coefs)              noexcept; // 5
+  //!      constexpr void tchebytchev(std::span<Z> zs, auto coefs, std::span<R> rs)                         noexcept; // 6
+  //!
+  //!      // Sequences
+  //!      constexpr void tchebytchev(kyosu::concepts::cayley_dickson_like auto z, std::span<R> ps)         noexcept; // 7
+  //!      constexpr void tchebytchev(std::span<Z> zs, std::span<R> ps)                                     noexcept; // 8
   //!   }
   //!   @endcode
   //!
@@ -105,6 +147,9 @@ namespace kyosu
   //!     * `n` :  [integral positive arguments](@ref eve::integral_value).
   //!              (note that negative values return a NaN)
   //!     * `x` :  [real floating argument](@ref eve::floating_value).
+  //!     * `coefs` : kyosu::coefficients of the series by increasing degree.
+  //!     * `zs`, `rs` : spans of input points and of output values.
+  //!     * `ps` : span receiving the values of the successive polynomials.
   //!
   //!    **Return value**
   //!
@@ -116,6 +161,15 @@ namespace kyosu
   //!         tnm1 = \f$T_{n-1}(z)\f$,
   //!         This call can be used to create a sequence of values evaluated at the same `z`
   //!         and for rising `n`.
+  //!      5. computes \f$\sum_{k=0}^{n-1} c_kT_k(z)\f$ (or \f$\sum c_kU_k(z)\f$ with `kind_2`) using
+  //!         the Clenshaw backward recurrence: \f$n\f$ fma instead of \f$n\f$ hypergeometric evaluations.
+  //!         For non commutative algebras, the coefficients are on the left of the polynomials.
+  //!         Unlike 1., real inputs lead to a real result.
+  //!      6. computes 5. at each element of `zs` and stores the results in `rs`.
+  //!      7. fills `ps` with \f$T_0(z), \dots, T_{m-1}(z)\f$ (\f$U_k\f$ with `kind_2`) where `m` is the size of `ps`,
+  //!         using the three term recurrence.
+  //!      8. fills the row-major matrix `ps` of `m = ps.size()/zs.size()` rows with \f$T_k(zs_j)\f$
+  //!         at row `k` and column `j`. The recurrence runs on SIMD chunks of points.
   //!
   //!  @groupheader{External references}
   //!   *  [Wikipedia: Chebyshev_polynomials]( https://en.wikipedia.org/wiki/Chebyshev_polynomials)
@@ -130,3 +184,54 @@ namespace kyosu
   //! @}
   //================================================================================================
 }
+
+namespace kyosu::_
+{
+  // T_k+1 = 2z T_k - T_k-1, with T_1 = z (U_1 = 2z)
+  template<typename U, typename Z, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr auto tchebytchev_recurrence(O const&, Z z) noexcept
+  {
+    auto twoz = U(2) * z;
+    auto alpha = [twoz](std::size_t) { return twoz; };
+    auto beta = [](std::size_t) { return U(-1); };
+    if constexpr (O::contains(kind_2)) return kumi::tuple{alpha, beta, twoz};
+    else return kumi::tuple{alpha, beta, z};
+  }
+
+  template<typename Z, eve::non_empty_product_type Data, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr auto tchebytchev_(KYOSU_DELAY(), O const& o, Z z, coefficients<Data> const& c) noexcept
+  {
+    using r_t = as_cayley_dickson_like_t<Z, coefficients<Data>>;
+    auto [alpha, beta, p1] = tchebytchev_recurrence<eve::underlying_type_t<r_t>>(o, z);
+    return clenshaw<r_t>(c, alpha, beta, p1);
+  }
+
+  template<typename Z, std::size_t S1, eve::non_empty_product_type Data, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void tchebytchev_(KYOSU_DELAY(),
+                                                O const& o,
+                                                std::span<Z, S1> zs,
+                                                coefficients<Data> const& c,
+                                                std::span<R, S2> rs) noexcept
+  {
+    bulk_apply(zs, rs, [&](auto z) { return tchebytchev[o](z, c); });
+  }
+
+  template<typename Z, typename R, std::size_t S, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void tchebytchev_(KYOSU_DELAY(), O const& o, Z z, std::span<R, S> ps) noexcept
+  {
+    auto [alpha, beta, p1] = tchebytchev_recurrence<eve::underlying_type_t<R>>(o, z);
+    forward_recurrence<R>(ps.size(), alpha, beta, p1, [&](std::size_t k, R const& v) { ps[k] = v; });
+  }
+
+  template<typename Z, std::size_t S1, typename R, std::size_t S2, eve::callable_options O>
+  KYOSU_FORCEINLINE constexpr void tchebytchev_(KYOSU_DELAY(),
+                                                O const& o,
+                                                std::span<Z, S1> zs,
+                                                std::span<R, S2> ps) noexcept
+  {
+    bulk_columns(zs, ps, [&](auto z, std::size_t n, auto store) {
+      auto [alpha, beta, p1] = tchebytchev_recurrence<eve::underlying_type_t<R>>(o, z);
+      forward_recurrence<decltype(z)>(n, alpha, beta, p1, store);
+    });
+  }
+}
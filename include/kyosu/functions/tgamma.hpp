@@ -7,6 +7,7 @@
 //======================================================================================================================
 #pragma once
 #include <kyosu/details/callable.hpp>
+#include <kyosu/functions/abs.hpp>
 #include <kyosu/functions/dec.hpp>
 #include <kyosu/functions/is_flint.hpp>
 #include <kyosu/functions/nearest.hpp>
@@ -15,7 +16,10 @@
 #include <kyosu/functions/exp.hpp>
 #include <kyosu/functions/log.hpp>
 #include <kyosu/functions/pow.hpp>
+#include <kyosu/functions/rec.hpp>
+#include <kyosu/functions/sqr.hpp>
 #include <kyosu/details/decorators.hpp>
+#include <array>
 
 namespace kyosu
 {
@@ -59,6 +63,10 @@ namespace kyosu
   //!
   //!     returns \f$\Gamma(z)\f$.
   //!
+  //!     For complex inputs, values with a negative real part are reflected and \f$\Gamma\f$ is computed by
+  //!     a Lanczos approximation folded in a single rational function for \f$|z| < 10\f$, and by the Stirling
+  //!     series otherwise. kyosu::bulk::tgamma processes ranges, computing reflected and direct values separately.
+  //!
   //!  @groupheader{External references}
   //!   *  [Wolfram MathWorld: Gamma Function](https://mathworld.wolfram.com/GammaFunction.html)
   //!   *  [Wikipedia: Gamma function](https://en.wikipedia.org/wiki/Gamma_function)
@@ -77,53 +85,113 @@ namespace kyosu
 
 namespace kyosu::_
 {
-  template<typename Z, eve::callable_options O> constexpr auto tgamma_(KYOSU_DELAY(), O const&, Z a0) noexcept
+  //===-------------------------------------------------------------------------------------------
+  //  Complex gamma kernel
+  //  Lanes with a negative real part are reflected: with w = -z, Γ(z) = -π / (z sin(πz) Γ(w)),
+  //  so that Γ(w) is only computed for real(w) >= 0:
+  //   * |w| < 10: Lanczos approximation g = 607/128 with 15 terms. The partial fractions
+  //     c0 + sum c_k / (w - 1 + k) are folded in a single rational function P(t) / Q(t) of
+  //     t = w + 2, the shift keeping the Horner evaluations well conditioned on the whole disc.
+  //     |w| < 1 is moved to w + 1 to stay away from the pole of Q at w = 0.
+  //   * |w| >= 10: Stirling series of log Γ with 8 Bernoulli terms.
+  //  The Lanes parameter tells if some, none or all the lanes are reflected, the two last cases
+  //  being used by kyosu::bulk::tgamma after splitting the inputs.
+  //===-------------------------------------------------------------------------------------------
+  enum class tgamma_lanes
   {
-    if constexpr (concepts::real<Z>) return eve::tgamma(a0);
-    else if constexpr (concepts::complex<Z>)
+    mixed,
+    direct,
+    reflected
+  };
+
+  template<typename Z> KYOSU_FORCEINLINE constexpr Z tgamma_lanczos(Z const& w) noexcept
+  {
+    using e_t = eve::element_type_t<as_real_type_t<Z>>;
+    // c0 + sum_{k=1}^{14} c_k / (x + k) = P(x + 3) / Q(x + 3), Q(t) = (t - 2)(t - 1)t...(t + 11)
+    constexpr std::array<e_t, 15> p = {
+      0.99999999999999711, 74.202504475911908, 2489.9641178784464, 50042.664635643356, 672500.70661176275,
+      6389230.4520277428,  44241611.026326261, 226797887.48423851, 865085501.75789917, 2444335079.8107343,
+      5039625963.172039,   7358606206.397131,  7200950695.1688929, 4232225491.9258275, 1128535591.2763426};
+    constexpr std::array<e_t, 15> q = {1,         63,        1729,       27027,      263263,
+                                       1630629,   6141707,   11252241,   -6050044,   -72864792,
+                                       -121693936, -19878768, 121337280, 79833600, 0};
+    auto t = w + e_t(2);
+    Z num(p[0]), den(q[0]);
+    for (std::size_t k = 1; k < p.size(); ++k)
     {
-      // 15 sig. digits for 0<=real(z)<=171
-      // coeffs should sum to about g*g/2+23/24
-      //
-      using r_t = eve::element_type_t<as_real_type_t<Z>>;
-      auto g = r_t(607) / r_t(128);
-      // best results when 4<=g<=5
-      constexpr int N = 15;
-      std::array<r_t, N> c = {0.99999999999999709182,    57.156235665862923517,     -59.597960355475491248,
-                              14.136097974741747174,     -0.49191381609762019978,   .33994649984811888699e-4,
-                              .46523628927048575665e-4,  -.98374475304879564677e-4, .15808870322491248884e-3,
-                              -.21026444172410488319e-3, .21743961811521264320e-3,  -.16431810653676389022e-3,
-                              .84418223983852743293e-4,  -.26190838401581408670e-4, .36899182659531622704e-5};
+      num = num * t + p[k];
+      den = den * t + q[k];
+    }
+    auto zh = w - eve::half(eve::as<e_t>());
+    auto zgh = zh + e_t(607) / e_t(128);
+    return e_t(2.5066282746310005024157652848110) * (num / den) * kyosu::exp(zh * kyosu::log(zgh) - zgh);
+  }
+
+  template<typename Z> KYOSU_FORCEINLINE constexpr Z tgamma_stirling(Z const& w) noexcept
+  {
+    using e_t = eve::element_type_t<as_real_type_t<Z>>;
+    // B_2k / (2k (2k - 1)) for k = 8 down to 1
+    constexpr std::array<e_t, 8> b = {-0.029550653594771242, 0.0064102564102564103, -0.0019175269175269176,
+                                      0.00084175084175084175, -0.00059523809523809524, 0.00079365079365079365,
+                                      -0.0027777777777777778, 0.083333333333333333};
+    auto rw = kyosu::rec(w);
+    auto rw2 = kyosu::sqr(rw);
+    Z s(b[0]);
+    for (std::size_t k = 1; k < b.size(); ++k) s = s * rw2 + b[k];
+    auto half_log_2pi = e_t(0.91893853320467274178032973640562);
+    return kyosu::exp((w - eve::half(eve::as<e_t>())) * kyosu::log(w) - w + half_log_2pi + s * rw);
+  }
+
+  // Γ(z) = -π / (z sin(πz) Γ(-z)), g being Γ(-z)
+  template<typename Z> KYOSU_FORCEINLINE constexpr Z tgamma_reflect(Z const& z, Z const& g) noexcept
+  {
+    using r_t = as_real_type_t<Z>;
+    auto r = rec(-eve::inv_pi(eve::as<r_t>()) * z * g * sinpi(z));
+    auto cnan = complex(eve::nan(eve::as<r_t>()), eve::inf(eve::as<r_t>()));
+    return if_else(is_real(z) && eve::is_flint(real(z)), cnan, r);
+  }
+
+  template<tgamma_lanes Lanes, typename Z> constexpr Z tgamma_kernel(Z const& a0) noexcept
+  {
+    using r_t = as_real_type_t<Z>;
+    using e_t = eve::element_type_t<r_t>;
+    auto o = eve::one(eve::as<e_t>());
 
-      //Num Recipes used g=5 with 7 terms
-      //for a less effective approximation
+    Z w = a0;
+    if constexpr (Lanes == tgamma_lanes::reflected) w = -a0;
+    else if constexpr (Lanes == tgamma_lanes::mixed) w = if_else(eve::is_negative(real(a0)), -a0, a0);
 
+    auto aw = kyosu::abs(w);
+    auto large = eve::is_greater_equal(aw, e_t(10));
+    Z f(0);
+    if (!eve::all(large))
+    {
+      auto tiny = eve::is_less(aw, o);
+      f = tgamma_lanczos(if_else(tiny, w + o, w));
+      if (eve::any(tiny)) f = if_else(tiny, f / w, f);
+    }
+    if (eve::any(large)) f = if_else(large, tgamma_stirling(w), f);
+    f = if_else(w == o || w == e_t(2), o, f);
+
+    //adjust for negative real parts
+    if constexpr (Lanes == tgamma_lanes::reflected) f = tgamma_reflect(a0, f);
+    else if constexpr (Lanes == tgamma_lanes::mixed)
+    {
       auto negra0 = eve::is_negative(real(a0));
-      auto z = if_else(negra0, -a0, a0);
-      z = kyosu::dec(z);
-      auto zh = z + eve::half(eve::as<r_t>());
-      auto zgh = zh + g;
-      //trick for avoiding FP overflow above z=141
-      auto zp = kyosu::pow(zgh, (zh * eve::half(eve::as<r_t>())));
-      auto ss = Z{};
-      for (int pp = N - 1; pp >= 1; --pp) { ss += c[pp] / (z + pp); }
-      auto sq2pi = r_t(2.5066282746310005024157652848110);
-      auto f = (sq2pi * (c[0] + ss)) * ((zp * exp(-zgh)) * zp);
-      auto o = eve::one(eve::as<r_t>());
-      f = if_else(is_eqz(z) || z == o, o, f);
-      //adjust for negative real parts
-      auto reala0 = is_real(a0);
-      if (eve::any(negra0))
-      {
-        f = if_else(negra0, rec(-eve::inv_pi(eve::as(real(a0))) * a0 * f * sinpi(a0)), f);
-        f = if_else(negra0 && reala0 && eve::is_flint(real(a0)),
-                    complex(eve::nan(eve::as(sq2pi)), eve::inf(eve::as(sq2pi))), f);
-      }
-      f = if_else(reala0, complex(eve::tgamma(real(a0))), f);
-      f = if_else(eve::is_nan(real(f)), complex(eve::nan(eve::as(sq2pi)), eve::inf(eve::as(sq2pi))), f);
-      f = if_else(is_eqz(a0), complex(eve::inf(eve::as(g)) * eve::signnz[eve::pedantic](real(a0))), f);
-      return f;
+      if (eve::any(negra0)) f = if_else(negra0, tgamma_reflect(a0, f), f);
     }
+
+    auto reala0 = is_real(a0);
+    if (eve::any(reala0)) f = if_else(reala0, complex(eve::tgamma(real(a0))), f);
+    f = if_else(eve::is_nan(real(f)), complex(eve::nan(eve::as<r_t>()), eve::inf(eve::as<r_t>())), f);
+    f = if_else(is_eqz(a0), complex(eve::inf(eve::as<r_t>()) * eve::signnz[eve::pedantic](real(a0))), f);
+    return f;
+  }
+
+  template<typename Z, eve::callable_options O> constexpr auto tgamma_(KYOSU_DELAY(), O const&, Z a0) noexcept
+  {
+    if constexpr (concepts::real<Z>) return eve::tgamma(a0);
+    else if constexpr (concepts::complex<Z>) return tgamma_kernel<tgamma_lanes::mixed>(a0);
     else { return cayley_extend(tgamma, a0); }
   }
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <kyosu/details/hyperg/hyp1_1.hpp>
+#include <kyosu/details/instrument.hpp>
 #include <kyosu/constants/fnan.hpp>
 #include <kyosu/functions/is_not_fnan.hpp>
 #include <kyosu/functions/is_not_flint.hpp>
@@ -62,6 +63,8 @@ namespace kyosu
   //!
   //!     Returns the value at z of the confluent hypergeometric function of the second kind
   //!
+  //!     `kyosu::prepare(kyosu::tricomi, a, b)` builds an evaluator for fixed scalar parameters.
+  //!
   //!  @groupheader{External references}
   //!   *  [DLMF: Kummer Functions](https://dlmf.nist.gov/13.2)
   //!   *  [Wolfram MathWorld:Confluent Hypergeometric Function of the Second Kind](https://mathworld.wolfram.com/ConfluentHypergeometricFunctionoftheSecondKind.html)
@@ -125,9 +128,14 @@ namespace kyosu::_
           auto t = fac * (daa - d1 - dn); //*(kyosu::digamma(aa+k)-kyosu::digamma(u_t(k+1))-kyosu::digamma(n+k));
           s += if_else(small, zero, t);
           small = kyosu::linfnorm[kyosu::flat](t) <= kyosu::linfnorm[kyosu::flat](s) * tol;
-          if (eve::all(small)) return s;
+          if (eve::all(small))
+          {
+            KYOSU_INSTRUMENT_ITERATIONS("tricomi", "logarithmic series", k);
+            return s;
+          }
           ak = kyosu::inc(ak);
         }
+        KYOSU_INSTRUMENT_ITERATIONS("tricomi", "logarithmic series", Maxit);
         return kyosu::fnan(eve::as(z));
       };
 
@@ -188,12 +196,15 @@ namespace kyosu::_
     auto notdone = kyosu::is_not_fnan(zzz);
     if (eve::any(notdone))
     {
+      KYOSU_INSTRUMENT_BRANCH("tricomi", "large z", notdone && zlarge);
       notdone = next_interval(br_large, notdone, zlarge, r, kyosu::rec(zzz));
       if (eve::any(notdone))
       {
+        KYOSU_INSTRUMENT_BRANCH("tricomi", "b positive integer", notdone && bpflint);
         notdone = next_interval(br_bpflint, notdone, bpflint, r, zzz);
         if (eve::any(notdone))
         {
+          KYOSU_INSTRUMENT_BRANCH("tricomi", "other b", notdone);
           if (eve::any(notdone)) { last_interval(br_else, notdone, r, zzz); }
         }
       }
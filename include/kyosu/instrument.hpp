@@ -0,0 +1,239 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <utility>
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Counters of an instrumentation point, a branch or a loop
+  //  Branch : evaluations of the dispatch, hits (at least one lane takes the branch), lanes
+  //           taking it and width (cardinal of the hits), so that lanes / width is the occupancy.
+  //  Loop   : runs, total and largest number of iterations, histogram of bit_width(iterations).
+  //===-------------------------------------------------------------------------------------------
+  struct instrument_counters
+  {
+    std::uint64_t evaluations = 0, hits = 0, lanes = 0, width = 0;
+    std::uint64_t runs = 0, total = 0, max = 0;
+    std::array<std::uint64_t, 65> histogram{};
+
+    void merge(instrument_counters const& o) noexcept
+    {
+      evaluations += o.evaluations;
+      hits += o.hits;
+      lanes += o.lanes;
+      width += o.width;
+      runs += o.runs;
+      total += o.total;
+      max = std::max(max, o.max);
+      for (std::size_t b = 0; b < histogram.size(); ++b) histogram[b] += o.histogram[b];
+    }
+  };
+
+  // the names are string literals: the views stay valid
+  using instrument_table = std::map<std::pair<std::string_view, std::string_view>, instrument_counters>;
+
+  // counters of the threads that have exited
+  struct instrument_global
+  {
+    std::mutex mutex;
+    instrument_table table;
+  };
+
+  inline instrument_global& instrument_totals()
+  {
+    static instrument_global g;
+    return g;
+  }
+
+  // counters of the calling thread, added to the totals when it exits
+  struct instrument_local
+  {
+    instrument_table table;
+    ~instrument_local()
+    {
+      auto& g = instrument_totals();
+      std::lock_guard lock(g.mutex);
+      for (auto const& [k, c] : table) g.table[k].merge(c);
+    }
+  };
+
+  inline instrument_table& instrument_thread() noexcept
+  {
+    thread_local instrument_local l;
+    return l.table;
+  }
+
+  inline void instrument_json_string(std::ostream& os, std::string_view s)
+  {
+    os << '"';
+    for (char c : s)
+    {
+      if (c == '"' || c == '\\') os << '\\';
+      os << c;
+    }
+    os << '"';
+  }
+}
+
+namespace kyosu::instrument
+{
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var instrument
+  //!   @brief Opt-in counters of the branches and loops of the iterative functions
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/instrument.hpp>
+  //!   @endcode
+  //!
+  //!   When `KYOSU_INSTRUMENT` is defined before any kyosu header is included, the dispatch points and the loops
+  //!   of the iterative functions (continued fractions, hypergeometric series, Carlson duplications...) record:
+  //!
+  //!     * for each branch, the number of evaluations of the dispatch, the number of hits (calls where at least one
+  //!       lane takes the branch) and the lanes taking it, whose ratio to the cardinal of the hits is the lane
+  //!       occupancy of the branch,
+  //!     * for each loop, the number of runs, the total and largest number of iterations and a histogram, bin b
+  //!       counting the runs of \f$2^{b-1}\f$ to \f$2^b - 1\f$ iterations.
+  //!
+  //!   The counters are thread-local and added to the global ones when their thread exits. Otherwise the
+  //!   instrumentation points expand to nothing, this header is not included by kyosu/kyosu.hpp and the functions
+  //!   below find no counters.
+  //!
+  //!   All the translation units linked together must agree on `KYOSU_INSTRUMENT`: the instrumented inline
+  //!   functions differ from the plain ones, and mixing both is an ODR violation.
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu::instrument
+  //!   {
+  //!      void dump(std::ostream& os); // 1
+  //!      void reset();                // 2
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Return value**
+  //!
+  //!     1. writes to `os` as JSON the counters of the exited threads and of the calling one,
+  //!     2. clears them.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @code
+  //!   #define KYOSU_INSTRUMENT
+  //!   #include <kyosu/kyosu.hpp>
+  //!   // ... calls to kyosu::faddeeva, kyosu::kummer ...
+  //!   kyosu::instrument::dump(std::cout);
+  //!   @endcode
+  //! @}
+  //====================================================================================================================
+  inline void dump(std::ostream& os)
+  {
+    _::instrument_table t;
+    {
+      auto& g = _::instrument_totals();
+      std::lock_guard lock(g.mutex);
+      t = g.table;
+    }
+    for (auto const& [k, c] : _::instrument_thread()) t[k].merge(c);
+
+    auto site = [&](auto const& k) {
+      os << "    {\"function\": ";
+      _::instrument_json_string(os, k.first);
+      os << ", \"name\": ";
+      _::instrument_json_string(os, k.second);
+    };
+    os << "{\n  \"branches\": [";
+    char const* sep = "\n";
+    for (auto const& [k, c] : t)
+    {
+      if (c.evaluations == 0) continue;
+      os << sep;
+      site(k);
+      os << ", \"evaluations\": " << c.evaluations << ", \"hits\": " << c.hits << ", \"lanes\": " << c.lanes
+         << ", \"width\": " << c.width
+         << ", \"occupancy\": " << (c.width ? double(c.lanes) / double(c.width) : 0.0) << "}";
+      sep = ",\n";
+    }
+    os << "\n  ],\n  \"loops\": [";
+    sep = "\n";
+    for (auto const& [k, c] : t)
+    {
+      if (c.runs == 0) continue;
+      os << sep;
+      site(k);
+      os << ", \"runs\": " << c.runs << ", \"total\": " << c.total << ", \"max\": " << c.max
+         << ", \"mean\": " << double(c.total) / double(c.runs) << ", \"histogram\": [";
+      std::size_t last = c.histogram.size();
+      while (last > 1 && c.histogram[last - 1] == 0) --last;
+      for (std::size_t b = 0; b < last; ++b) os << (b ? ", " : "") << c.histogram[b];
+      os << "]}";
+      sep = ",\n";
+    }
+    os << "\n  ]\n}\n";
+  }
+
+  inline void reset()
+  {
+    {
+      auto& g = _::instrument_totals();
+      std::lock_guard lock(g.mutex);
+      g.table.clear();
+    }
+    _::instrument_thread().clear();
+  }
+
+  /// Records that the dispatch `branch` of `function` was evaluated, `mask` holding the lanes taking it
+  template<typename M> void record_branch(std::string_view function, std::string_view branch, M const& mask)
+  {
+    std::uint64_t lanes, width;
+    if constexpr (std::same_as<M, bool>)
+    {
+      lanes = mask;
+      width = 1;
+    }
+    else
+    {
+      lanes = eve::count_true(mask);
+      width = eve::cardinal_v<M>;
+    }
+    auto& c = _::instrument_thread()[{function, branch}];
+    ++c.evaluations;
+    if (lanes)
+    {
+      ++c.hits;
+      c.lanes += lanes;
+      c.width += width;
+    }
+  }
+
+  /// Records a run of `n` iterations of the loop `loop` of `function`
+  inline void record_iterations(std::string_view function, std::string_view loop, std::uint64_t n)
+  {
+    auto& c = _::instrument_thread()[{function, loop}];
+    ++c.runs;
+    c.total += n;
+    c.max = std::max(c.max, n);
+    ++c.histogram[std::bit_width(n)];
+  }
+}
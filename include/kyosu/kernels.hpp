@@ -0,0 +1,119 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/types.hpp>
+#include <span>
+
+#if defined(_WIN32)
+#  if defined(KYOSU_KERNELS_BUILD)
+#    define KYOSU_KERNELS_API __declspec(dllexport)
+#  else
+#    define KYOSU_KERNELS_API __declspec(dllimport)
+#  endif
+#else
+#  define KYOSU_KERNELS_API __attribute__((visibility("default")))
+#endif
+
+// functions compiled in kyosu_kernels, for spans of complex_t<float> and complex_t<double>
+#define KYOSU_KERNELS_FUNCTIONS(X)                                                                                     \
+  X(exp)                                                                                                               \
+  X(log)                                                                                                               \
+  X(sqrt)                                                                                                              \
+  X(sin)                                                                                                               \
+  X(cos)                                                                                                               \
+  X(tan)                                                                                                               \
+  X(sinh)                                                                                                              \
+  X(cosh)                                                                                                              \
+  X(tanh)                                                                                                              \
+  X(asin)                                                                                                              \
+  X(acos)                                                                                                              \
+  X(atan)                                                                                                              \
+  X(erf)                                                                                                               \
+  X(tgamma)                                                                                                            \
+  X(digamma)
+
+namespace kyosu::kernels
+{
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var kernels
+  //!   @brief Precompiled span kernels of the main functions, dispatched at run time on the instruction set of the CPU
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/kernels.hpp>
+  //!   @endcode
+  //!
+  //!   The header only declares the entry points: they are compiled in the `kyosu_kernels` library, built when the
+  //!   project is configured with `KYOSU_BUILD_KERNELS=ON`. On x86-64 with GCC or Clang the library holds one
+  //!   instantiation of each entry point per instruction set (SSE4.2, AVX2 + FMA, AVX-512) in addition to the
+  //!   baseline one, and the best one supported by the CPU is selected on the first call. A single binary thus runs
+  //!   everywhere and uses the widest registers available.
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu::kernels
+  //!   {
+  //!      void exp(std::span<complex_t<T> const> in, std::span<complex_t<T>> out) noexcept; // 1
+  //!      // ... and likewise log, sqrt, sin, cos, tan, sinh, cosh, tanh, asin, acos, atan, erf, tgamma, digamma
+  //!
+  //!      isa  current() noexcept;                                                        // 2
+  //!      isa  best() noexcept;                                                           // 3
+  //!      bool select(isa i) noexcept;                                                    // 4
+  //!      char const* name(isa i) noexcept;                                               // 5
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `in`, `out`: spans of `complex_t<float>` or `complex_t<double>`.
+  //!     * `i`: an instruction set.
+  //!
+  //!   **Return value**
+  //!
+  //!     1. `out[i] = f(in[i])` for i less than the smallest of the sizes, f being the kyosu function of the same name.
+  //!     2. the instruction set used by the kernels,
+  //!     3. the widest instruction set supported by both the CPU and the library,
+  //!     4. uses `i` for the next calls if it is supported, and returns whether it is,
+  //!     5. the name of `i`.
+  //!
+  //!     The environment variable `KYOSU_ISA` (`generic`, `sse4`, `avx2` or `avx512`) caps the instruction set
+  //!     selected at startup.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @code
+  //!   std::vector<kyosu::complex_t<float>> zs(n), rs(n);
+  //!   kyosu::kernels::tgamma(zs, rs);
+  //!   std::cout << "computed with " << kyosu::kernels::name(kyosu::kernels::current()) << std::endl;
+  //!   @endcode
+  //! @}
+  //====================================================================================================================
+  enum class isa : int
+  {
+    generic,
+    sse4,
+    avx2,
+    avx512
+  };
+
+  KYOSU_KERNELS_API isa current() noexcept;
+  KYOSU_KERNELS_API isa best() noexcept;
+  KYOSU_KERNELS_API bool select(isa i) noexcept;
+  KYOSU_KERNELS_API char const* name(isa i) noexcept;
+
+#define KYOSU_KERNELS_DECLARE(F)                                                                                       \
+  KYOSU_KERNELS_API void F(std::span<complex_t<float> const> in, std::span<complex_t<float>> out) noexcept;            \
+  KYOSU_KERNELS_API void F(std::span<complex_t<double> const> in, std::span<complex_t<double>> out) noexcept;
+  KYOSU_KERNELS_FUNCTIONS(KYOSU_KERNELS_DECLARE)
+#undef KYOSU_KERNELS_DECLARE
+}
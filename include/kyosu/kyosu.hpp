@@ -13,3 +13,10 @@ namespace kyosu {}
 #include <kyosu/types.hpp>
 #include <kyosu/functions.hpp>
 #include <kyosu/constants.hpp>
+#include <kyosu/bulk.hpp>
+#include <kyosu/fft.hpp>
+#include <kyosu/qft.hpp>
+#include <kyosu/matrix.hpp>
+#include <kyosu/prepare.hpp>
+#include <kyosu/bessel_plan.hpp>
+#include <kyosu/tabulate.hpp>
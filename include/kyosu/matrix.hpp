@@ -0,0 +1,291 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/functions/abs.hpp>
+#include <kyosu/functions/conj.hpp>
+#include <kyosu/functions/if_else.hpp>
+#include <kyosu/functions/rec.hpp>
+#include <kyosu/functions/sqr_abs.hpp>
+#include <kyosu/types/cayley_dickson.hpp>
+#include <array>
+#include <cstddef>
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @class matrix
+  //! @brief N x N matrix of reals or Cayley-Dickson values, meant for small sizes (2 to 8)
+  //!
+  //! The elements are stored by rows. If Z is a SIMD type, as `kyosu::complex_t<eve::wide<float>>`, each lane holds
+  //! an independent matrix and all the operations, pivoting included, are run on the whole batch at once.
+  //!
+  //! The products and solvers keep the order of the factors and work for quaternions: vectors are columns
+  //! multiplied on the right. kyosu::det is only defined for commutative element types.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/matrix.cpp}
+  //====================================================================================================================
+  template<concepts::cayley_dickson_like Z, std::size_t N>
+  requires(N > 0)
+  struct matrix
+  {
+    using value_type = Z;
+    using column_type = std::array<Z, N>;
+    static constexpr std::size_t static_size = N;
+
+    std::array<std::array<Z, N>, N> rows;
+
+    constexpr Z& operator()(std::size_t i, std::size_t j) noexcept { return rows[i][j]; }
+    constexpr Z const& operator()(std::size_t i, std::size_t j) const noexcept { return rows[i][j]; }
+
+    /// Matrix with all its elements equal to zero
+    static constexpr matrix zero() noexcept
+    {
+      matrix r;
+      for (auto& row : r.rows) row.fill(Z(0));
+      return r;
+    }
+
+    /// Identity matrix
+    static constexpr matrix identity() noexcept
+    {
+      matrix r = zero();
+      for (std::size_t i = 0; i < N; ++i) r.rows[i][i] = Z(1);
+      return r;
+    }
+
+    friend constexpr matrix operator+(matrix a, matrix const& b) noexcept
+    {
+      for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t j = 0; j < N; ++j) a(i, j) += b(i, j);
+      return a;
+    }
+
+    friend constexpr matrix operator-(matrix a, matrix const& b) noexcept
+    {
+      for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t j = 0; j < N; ++j) a(i, j) -= b(i, j);
+      return a;
+    }
+
+    friend constexpr matrix operator*(matrix const& a, matrix const& b) noexcept
+    {
+      matrix r;
+      for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t j = 0; j < N; ++j)
+        {
+          Z s = a(i, 0) * b(0, j);
+          for (std::size_t k = 1; k < N; ++k) s += a(i, k) * b(k, j);
+          r(i, j) = s;
+        }
+      return r;
+    }
+
+    friend constexpr column_type operator*(matrix const& a, column_type const& x) noexcept
+    {
+      column_type r;
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        Z s = a(i, 0) * x[0];
+        for (std::size_t k = 1; k < N; ++k) s += a(i, k) * x[k];
+        r[i] = s;
+      }
+      return r;
+    }
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+}
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Gaussian elimination with partial pivoting of a and of the M columns of b.
+  //  Rows are exchanged lane by lane: row r replaces the pivot row k in the lanes where it has a
+  //  larger modulus, so that after the pass over r the pivot is the column maximum of each lane.
+  //  Row operations multiply on the left, which keeps a x = b valid for quaternions. Returns the
+  //  sign of the row permutation.
+  //===-------------------------------------------------------------------------------------------
+  template<typename Z, std::size_t N, std::size_t M>
+  constexpr auto gauss_eliminate(matrix<Z, N>& a, std::array<std::array<Z, M>, N>& b) noexcept
+  {
+    using r_t = as_real_type_t<Z>;
+    r_t sign(1);
+    auto exchange = [](auto const& m, Z& x, Z& y) {
+      Z t = x;
+      x = kyosu::if_else(m, y, x);
+      y = kyosu::if_else(m, t, y);
+    };
+
+    for (std::size_t k = 0; k < N; ++k)
+    {
+      for (std::size_t r = k + 1; r < N; ++r)
+      {
+        auto m = eve::is_greater(kyosu::sqr_abs(a(r, k)), kyosu::sqr_abs(a(k, k)));
+        if (eve::any(m))
+        {
+          for (std::size_t j = k; j < N; ++j) exchange(m, a(k, j), a(r, j));
+          for (std::size_t j = 0; j < M; ++j) exchange(m, b[k][j], b[r][j]);
+          sign = eve::if_else(m, -sign, sign);
+        }
+      }
+
+      auto inv = kyosu::rec(a(k, k));
+      for (std::size_t r = k + 1; r < N; ++r)
+      {
+        auto l = a(r, k) * inv;
+        for (std::size_t j = k + 1; j < N; ++j) a(r, j) -= l * a(k, j);
+        for (std::size_t j = 0; j < M; ++j) b[r][j] -= l * b[k][j];
+        a(r, k) = Z(0);
+      }
+    }
+    return sign;
+  }
+
+  // solution of u x = b, u upper triangular, in place in b
+  template<typename Z, std::size_t N, std::size_t M>
+  constexpr void back_substitute(matrix<Z, N> const& u, std::array<std::array<Z, M>, N>& b) noexcept
+  {
+    for (std::size_t i = N; i-- > 0;)
+    {
+      auto inv = kyosu::rec(u(i, i));
+      for (std::size_t j = 0; j < M; ++j)
+      {
+        Z s = b[i][j];
+        for (std::size_t c = i + 1; c < N; ++c) s -= u(i, c) * b[c][j];
+        b[i][j] = inv * s;
+      }
+    }
+  }
+
+  //===-------------------------------------------------------------------------------------------
+  //  Householder QR: the column x = a(k.., k) is mapped to alpha e1, alpha = -u |x| with u the
+  //  phase of x_k, by H = I - tau v v^*, v = x - alpha e1 and tau = 2 / |v|^2 = 1 / (|x|^2 + |x||x_k|).
+  //  H y = y - v (tau v^* y) is applied to the remaining columns and to b, in that order of the
+  //  factors for quaternions. b then holds Q^* b and a the triangular factor R.
+  //===-------------------------------------------------------------------------------------------
+  template<typename Z, std::size_t N, std::size_t M>
+  constexpr void householder(matrix<Z, N>& a, std::array<std::array<Z, M>, N>& b) noexcept
+  {
+    using r_t = as_real_type_t<Z>;
+    for (std::size_t k = 0; k < N; ++k)
+    {
+      r_t n2 = kyosu::sqr_abs(a(k, k));
+      for (std::size_t i = k + 1; i < N; ++i) n2 += kyosu::sqr_abs(a(i, k));
+      auto nx = eve::sqrt(n2);
+      auto ak = a(k, k);
+      auto mk = kyosu::abs(ak);
+      Z u = kyosu::if_else(eve::is_eqz(mk), Z(1), ak / mk);
+      Z alpha = -u * nx;
+      auto tau = eve::if_else(eve::is_eqz(nx), eve::zero, eve::rec(n2 + nx * mk));
+
+      auto reflect = [&](auto get) {
+        Z s = kyosu::conj(ak - alpha) * get(k);
+        for (std::size_t i = k + 1; i < N; ++i) s += kyosu::conj(a(i, k)) * get(i);
+        s = s * tau;
+        get(k) -= (ak - alpha) * s;
+        for (std::size_t i = k + 1; i < N; ++i) get(i) -= a(i, k) * s;
+      };
+      for (std::size_t j = k + 1; j < N; ++j) reflect([&](std::size_t i) -> Z& { return a(i, j); });
+      for (std::size_t j = 0; j < M; ++j) reflect([&](std::size_t i) -> Z& { return b[i][j]; });
+
+      a(k, k) = alpha;
+      for (std::size_t i = k + 1; i < N; ++i) a(i, k) = Z(0);
+    }
+  }
+
+  template<typename Z, std::size_t N> constexpr auto as_columns(std::array<Z, N> const& x) noexcept
+  {
+    std::array<std::array<Z, 1>, N> b;
+    for (std::size_t i = 0; i < N; ++i) b[i][0] = x[i];
+    return b;
+  }
+
+  template<typename Z, std::size_t N> constexpr auto from_columns(std::array<std::array<Z, 1>, N> const& b) noexcept
+  {
+    std::array<Z, N> x;
+    for (std::size_t i = 0; i < N; ++i) x[i] = b[i][0];
+    return x;
+  }
+}
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //! @brief Determinant of a matrix of reals or complex values, by Gaussian elimination with partial pivoting
+  template<typename Z, std::size_t N>
+  requires(concepts::complex_like<Z>)
+  constexpr Z det(matrix<Z, N> a) noexcept
+  {
+    std::array<std::array<Z, 0>, N> none;
+    auto sign = _::gauss_eliminate(a, none);
+    Z d = a(0, 0);
+    for (std::size_t i = 1; i < N; ++i) d *= a(i, i);
+    return d * sign;
+  }
+
+  //! @brief Solution x of a x = b by LU decomposition with partial pivoting
+  template<typename Z, std::size_t N>
+  constexpr std::array<Z, N> lu_solve(matrix<Z, N> a, std::array<Z, N> const& b) noexcept
+  {
+    auto x = _::as_columns(b);
+    _::gauss_eliminate(a, x);
+    _::back_substitute(a, x);
+    return _::from_columns(x);
+  }
+
+  //! @brief Solution x of a x = b, b and x being matrices, by LU decomposition with partial pivoting
+  template<typename Z, std::size_t N>
+  constexpr matrix<Z, N> lu_solve(matrix<Z, N> a, matrix<Z, N> b) noexcept
+  {
+    _::gauss_eliminate(a, b.rows);
+    _::back_substitute(a, b.rows);
+    return b;
+  }
+
+  //! @brief Inverse of a matrix, by LU decomposition with partial pivoting
+  template<typename Z, std::size_t N> constexpr matrix<Z, N> inverse(matrix<Z, N> const& a) noexcept
+  {
+    return lu_solve(a, matrix<Z, N>::identity());
+  }
+
+  //! @brief Solution x of a x = b by Householder QR decomposition, slower than kyosu::lu_solve but more stable
+  template<typename Z, std::size_t N>
+  constexpr std::array<Z, N> qr_solve(matrix<Z, N> a, std::array<Z, N> const& b) noexcept
+  {
+    auto x = _::as_columns(b);
+    _::householder(a, x);
+    _::back_substitute(a, x);
+    return _::from_columns(x);
+  }
+
+  //! @brief Solution x of a x = b, b and x being matrices, by Householder QR decomposition
+  template<typename Z, std::size_t N>
+  constexpr matrix<Z, N> qr_solve(matrix<Z, N> a, matrix<Z, N> b) noexcept
+  {
+    _::householder(a, b.rows);
+    _::back_substitute(a, b.rows);
+    return b;
+  }
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+}
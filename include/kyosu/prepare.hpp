@@ -0,0 +1,291 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/details/hyperg/prepared.hpp>
+#include <kyosu/functions/hypergeometric.hpp>
+#include <kyosu/functions/kummer.hpp>
+#include <kyosu/functions/tricomi.hpp>
+#include <algorithm>
+#include <span>
+#include <utility>
+
+namespace kyosu::_
+{
+  // selects the poles of hypergeometric[regularized] for a prepared_kummer
+  struct hypergeometric_rule
+  {
+  };
+}
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @class prepared_hypergeometric
+  //! @brief \f${}_2F_1(a, b; c; z)\f$ for fixed scalar parameters, built by kyosu::prepare
+  //!
+  //! The tests on the parameters and the transformation they select (a <-> b swap or Euler transformation) are
+  //! resolved once. Each call then only chooses, lane by lane, the series and the argument to use.
+  //! The results are those of kyosu::hypergeometric.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/prepare.cpp}
+  //====================================================================================================================
+  template<eve::floating_scalar_value T> class prepared_hypergeometric
+  {
+  public:
+    using parameter_type = complex_t<T>;
+
+    prepared_hypergeometric(parameter_type a, parameter_type b, parameter_type c, bool regularized = false)
+      : fac_(1), regularized_(regularized)
+    {
+      if (regularized)
+      {
+        //if c is a negative integer the value is computed by continuity.
+        c = if_else(_::is_negint(c), eve::next(real(c)), c);
+        fac_ = tgamma_inv(c);
+      }
+      q_ = _::hyp2_1_prepare(a, b, c);
+    }
+
+    /// Value at z, scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> operator()(Z z) const noexcept
+    {
+      using r_t = complexify_t<Z>;
+      auto q = _::hyp2_1_splat<r_t>(q_);
+      return _::hyp2_1_run(q.c, _::hyp2_1_resolve(q, _::hyp2_1_cut(r_t(z)))) * r_t(fac_);
+    }
+
+    /// Values at the elements of zs, stored in rs, the points being grouped by series
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void operator()(std::span<Z, S1> zs, std::span<R, S2> rs) const
+    {
+      _::hyp2_1_batch(_::hyp2_1_splat<eve::wide<R>>(q_), zs, rs);
+      if (regularized_)
+        for (std::size_t i = 0; i < std::min(zs.size(), rs.size()); ++i) rs[i] *= fac_;
+    }
+
+  private:
+    _::hyp2_1_params<parameter_type> q_;
+    parameter_type fac_;
+    bool regularized_;
+  };
+
+  //====================================================================================================================
+  //! @class prepared_kummer
+  //! @brief \f${}_1F_1(a; b; z)\f$ for fixed scalar parameters, built by kyosu::prepare
+  //!
+  //! The branch (pole, polynomial or series) and the ratios of the consecutive terms of the series are computed once.
+  //! The results are those of kyosu::kummer, or of kyosu::kummer[kyosu::regularized] for the regularized function.
+  //! As kyosu::kummer[kyosu::regularized], the regularized function is computed by continuity at the real integers
+  //! b <= 0; when prepared from kyosu::hypergeometric[kyosu::regularized], only at the negative ones, as that
+  //! function does.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/prepare.cpp}
+  //====================================================================================================================
+  template<eve::floating_scalar_value T> class prepared_kummer
+  {
+  public:
+    using parameter_type = complex_t<T>;
+
+    prepared_kummer(parameter_type a, parameter_type b, bool regularized = false) : fac_(1)
+    {
+      init(a, b, regularized, true);
+    }
+
+    /// Regularized function with the rule of kyosu::hypergeometric[kyosu::regularized], used by kyosu::prepare
+    prepared_kummer(_::hypergeometric_rule, parameter_type a, parameter_type b) : fac_(1)
+    {
+      init(a, b, true, false);
+    }
+
+    /// Value at z, scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> operator()(Z z) const noexcept
+    {
+      using r_t = complexify_t<Z>;
+      return _::hyp1_1_run(q_, r_t(z)) * r_t(fac_);
+    }
+
+    /// Values at the elements of zs, stored in rs
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void operator()(std::span<Z, S1> zs, std::span<R, S2> rs) const noexcept
+    {
+      _::bulk_apply(zs, rs, [&](auto z) { return (*this)(z); });
+    }
+
+  private:
+    // the poles b of the regularized function, b <= 0 or b < 0 without zero_pole, are moved to their successor
+    void init(parameter_type a, parameter_type b, bool regularized, bool zero_pole)
+    {
+      if (regularized)
+      {
+        auto r = kyosu::real(b);
+        auto isnegint = kyosu::is_real(b) && eve::is_flint(r) && (zero_pole ? eve::is_lez(r) : eve::is_ltz(r));
+        b = if_else(isnegint, eve::next(r), b);
+        fac_ = kyosu::tgamma_inv(b);
+      }
+      q_ = _::hyp1_1_prepare(a, b);
+    }
+
+    _::hyp1_1_params<parameter_type> q_;
+    parameter_type fac_;
+  };
+
+  //====================================================================================================================
+  //! @class prepared_tricomi
+  //! @brief \f$U(a, b, z)\f$ for fixed scalar parameters, built by kyosu::prepare
+  //!
+  //! The gamma factors, the digamma seeds and the ratios of the terms of the logarithmic expansion (b positive
+  //! integer) or the two prepared \f${}_1F_1\f$ (other b), and the ratios of the terms of the expansion at
+  //! infinity are computed once. The results are those of kyosu::tricomi, except that the expansion at infinity
+  //! (|z| > 50) stops after 500 terms where kyosu::tricomi sums until convergence.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/prepare.cpp}
+  //====================================================================================================================
+  template<eve::floating_scalar_value T> class prepared_tricomi
+  {
+  public:
+    using parameter_type = complex_t<T>;
+
+    prepared_tricomi(parameter_type a, parameter_type b) : q_(_::tricomi_prepare(a, b)) {}
+
+    /// Value at z, scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> operator()(Z z) const noexcept
+    {
+      return _::tricomi_run(q_, complexify_t<Z>(z));
+    }
+
+    /// Values at the elements of zs, stored in rs
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void operator()(std::span<Z, S1> zs, std::span<R, S2> rs) const noexcept
+    {
+      _::bulk_apply(zs, rs, [&](auto z) { return (*this)(z); });
+    }
+
+  private:
+    _::tricomi_params<parameter_type> q_;
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+}
+
+namespace kyosu::_
+{
+  template<typename... Ts>
+  using prepared_value_t = eve::underlying_type_t<decltype((std::declval<Ts>() + ...))>;
+
+  template<typename T, typename P> KYOSU_FORCEINLINE complex_t<T> prepared_parameter(P p) noexcept
+  {
+    if constexpr (concepts::complex<P>) return complex_t<T>(T(real(p)), T(imag(p)));
+    else return complex_t<T>(T(p));
+  }
+}
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var prepare
+  //!   @brief Builds an evaluator of a hypergeometric or confluent function for fixed scalar parameters
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/prepare.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu
+  //!   {
+  //!      auto prepare(hypergeometric_t f, kumi::tuple<A, B> a, kumi::tuple<C> c); // 1
+  //!      auto prepare(hypergeometric_t f, kumi::tuple<A> a, kumi::tuple<B> b);    // 2
+  //!      auto prepare(kummer_t f, auto a, auto b);                                // 2
+  //!      auto prepare(tricomi_t f, auto a, auto b);                               // 3
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `f`: kyosu::hypergeometric, kyosu::kummer or kyosu::tricomi, possibly with the kyosu::regularized option
+  //!       for the first two.
+  //!     * `a`, `b`, `c`: real or complex scalar parameters.
+  //!
+  //!   **Return value**
+  //!
+  //!     1. a kyosu::prepared_hypergeometric computing \f${}_2F_1(a_0, a_1; c_0; z)\f$,
+  //!     2. a kyosu::prepared_kummer computing \f${}_1F_1(a; b; z)\f$,
+  //!     3. a kyosu::prepared_tricomi computing \f$U(a, b, z)\f$.
+  //!
+  //!     The evaluators are called with a scalar or SIMD, real or complex z of the floating type of the parameters,
+  //!     or with two spans `zs` and `rs`, as `e(zs, rs)`. They can be used by several threads at once.
+  //!
+  //!   @groupheader{Example}
+  //!   @godbolt{doc/prepare.cpp}
+  //! @}
+  //====================================================================================================================
+  template<typename O, eve::sized_product_type<2> T1, eve::sized_product_type<1> T2>
+  requires(eve::floating_scalar_value<_::prepared_value_t<kumi::element_t<0, T1>, kumi::element_t<1, T1>,
+                                                         kumi::element_t<0, T2>>>)
+  auto prepare(hypergeometric_t<O> const&, T1 a, T2 c)
+  {
+    using e_t = _::prepared_value_t<kumi::element_t<0, T1>, kumi::element_t<1, T1>, kumi::element_t<0, T2>>;
+    auto p = [](auto x) { return _::prepared_parameter<e_t>(x); };
+    return prepared_hypergeometric<e_t>(p(kumi::get<0>(a)), p(kumi::get<1>(a)), p(kumi::get<0>(c)),
+                                        O::contains(kyosu::regularized));
+  }
+
+  template<typename O, eve::sized_product_type<1> T1, eve::sized_product_type<1> T2>
+  requires(eve::floating_scalar_value<_::prepared_value_t<kumi::element_t<0, T1>, kumi::element_t<0, T2>>>)
+  auto prepare(hypergeometric_t<O> const&, T1 a, T2 b)
+  {
+    using e_t = _::prepared_value_t<kumi::element_t<0, T1>, kumi::element_t<0, T2>>;
+    auto p = [](auto x) { return _::prepared_parameter<e_t>(x); };
+    if constexpr (O::contains(kyosu::regularized))
+      return prepared_kummer<e_t>(_::hypergeometric_rule{}, p(kumi::get<0>(a)), p(kumi::get<0>(b)));
+    else return prepared_kummer<e_t>(p(kumi::get<0>(a)), p(kumi::get<0>(b)));
+  }
+
+  template<typename O, typename T1, typename T2>
+  requires(eve::floating_scalar_value<_::prepared_value_t<T1, T2>>)
+  auto prepare(kummer_t<O> const&, T1 a, T2 b)
+  {
+    using e_t = _::prepared_value_t<T1, T2>;
+    return prepared_kummer<e_t>(_::prepared_parameter<e_t>(a), _::prepared_parameter<e_t>(b),
+                                O::contains(kyosu::regularized));
+  }
+
+  template<typename O, typename T1, typename T2>
+  requires(eve::floating_scalar_value<_::prepared_value_t<T1, T2>>)
+  auto prepare(tricomi_t<O> const&, T1 a, T2 b)
+  {
+    using e_t = _::prepared_value_t<T1, T2>;
+    return prepared_tricomi<e_t>(_::prepared_parameter<e_t>(a), _::prepared_parameter<e_t>(b));
+  }
+}
@@ -0,0 +1,169 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/qft.hpp>
+#include <kyosu/fft.hpp>
+#include <kyosu/types/soa.hpp>
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @brief Side of the exponential kernels of a quaternion Fourier transform (see kyosu::qft_plan)
+  //====================================================================================================================
+  enum class qft_side
+  {
+    left,
+    right,
+    two_sided
+  };
+
+  //====================================================================================================================
+  //! @class qft_plan
+  //! @brief Precomputed quaternion Fourier transform of signals of size n or of rows x cols images
+  //!
+  //! With \f$\mu_1\f$, \f$\mu_2\f$ pure quaternions (normalized by the plan) and
+  //! \f$\theta_{uv} = 2\pi(um/\mathrm{rows} + vn/\mathrm{cols})\f$, the forward transforms of an image \f$f\f$ are
+  //!   * left: \f$F_{uv} = \sum_{m,n} e^{-\mu_1\theta_{uv}} f_{mn}\f$,
+  //!   * right: \f$F_{uv} = \sum_{m,n} f_{mn} e^{-\mu_2\theta_{uv}}\f$,
+  //!   * two sided: \f$F_{uv} = \sum_{m,n} e^{-2\pi\mu_1 um/\mathrm{rows}} f_{mn} e^{-2\pi\mu_2 vn/\mathrm{cols}}\f$,
+  //!
+  //! and the inverse transforms, normalized by \f$1/(\mathrm{rows}\,\mathrm{cols})\f$, invert them. Signals are
+  //! images of one row, both axes being then \f$\mu\f$: the two sided transform is the right one.
+  //!
+  //! Each quaternion is split in two symplectic parts lying in the complex plane of the axis, which are transformed
+  //! by batched kyosu::fft_plan runs on the planes of the kyosu::soa_view<T, 4> data. The axes \f$i\f$ and \f$j\f$
+  //! use the planes directly, other axes add a rotation of the imaginary planes before and after the transforms.
+  //! Columns are transformed on transposed copies of the planes.
+  //!
+  //! The `batch` parameter transforms `batch` consecutive signals or images. In and out views of out-of-place
+  //! transforms must either be the same or not overlap.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/qft.cpp}
+  //====================================================================================================================
+  template<eve::floating_scalar_value T> class qft_plan
+  {
+  public:
+    using view_type = soa_view<T, 4>;
+    using const_view_type = soa_view<T const, 4>;
+
+    qft_plan() = default;
+
+    /// Plan for signals of size n with the axis mu
+    qft_plan(qft_side side, std::size_t n, quaternion_t<T> const& mu = quaternion_t<T>(0, 1, 0, 0))
+      : qft_plan(side, 1, n, mu, mu)
+    {
+    }
+
+    /// Plan for rows x cols images, stored row by row, with the axis mu1 on the left and mu2 on the right
+    qft_plan(qft_side side, std::size_t rows, std::size_t cols,
+             quaternion_t<T> const& mu1 = quaternion_t<T>(0, 1, 0, 0),
+             quaternion_t<T> const& mu2 = quaternion_t<T>(0, 0, 1, 0))
+      : side_(side), rows_(rows), cols_(cols), row_plan_(cols), col_plan_(rows), left_(frame(mu1)),
+        right_(frame(mu2))
+    {
+    }
+
+    std::size_t size() const noexcept { return rows_ * cols_; }
+    qft_side side() const noexcept { return side_; }
+
+    /// Out-of-place forward transforms
+    void forward(const_view_type in, view_type out, std::size_t batch = 1) const { transform<false>(in, out, batch); }
+
+    /// Out-of-place inverse transforms
+    void inverse(const_view_type in, view_type out, std::size_t batch = 1) const { transform<true>(in, out, batch); }
+
+    /// In-place forward transforms
+    void forward(view_type data, std::size_t batch = 1) const { transform<false>(data, data, batch); }
+
+    /// In-place inverse transforms
+    void inverse(view_type data, std::size_t batch = 1) const { transform<true>(data, data, batch); }
+
+  private:
+    static _::qft_frame<T> frame(quaternion_t<T> const& mu)
+    {
+      return {double(kumi::get<1>(mu)), double(kumi::get<2>(mu)), double(kumi::get<3>(mu))};
+    }
+
+    // one sided transforms of the count consecutive signals of in, of the size of plan
+    template<bool Inv>
+    void pass(fft_plan<T> const& plan, _::qft_frame<T> const& f, bool right, const_view_type in, view_type out,
+              std::size_t count) const
+    {
+      std::size_t const n = plan.size() * count;
+      std::array<unsigned int, 4> c{0, 1, 2, 3};
+      if (f.permutation) c = {0, 1 + f.perm[0], 1 + f.perm[1], 1 + f.perm[2]};
+      else
+      {
+        if (out.planes[0] != in.planes[0]) std::copy_n(in.planes[0], n, out.planes[0]);
+        _::qft_rotate<false>(f.m, {in.planes[1], in.planes[2], in.planes[3]},
+                             {out.planes[1], out.planes[2], out.planes[3]}, n);
+        in = out;
+      }
+      if (right) std::swap(c[2], c[3]);
+
+      for (unsigned int h = 0; h < 4; h += 2)
+      {
+        soa_view<T, 2> y{{out.planes[c[h]], out.planes[c[h + 1]]}, n};
+        if (in.planes[c[h]] == out.planes[c[h]])
+        {
+          if constexpr (Inv) plan.inverse(y, count);
+          else plan.forward(y, count);
+        }
+        else
+        {
+          soa_view<T const, 2> x{{in.planes[c[h]], in.planes[c[h + 1]]}, n};
+          if constexpr (Inv) plan.inverse(x, y, count);
+          else plan.forward(x, y, count);
+        }
+      }
+
+      if (!f.permutation)
+        _::qft_rotate<true>(f.m, {out.planes[1], out.planes[2], out.planes[3]},
+                            {out.planes[1], out.planes[2], out.planes[3]}, n);
+    }
+
+    template<bool Inv> void transform(const_view_type in, view_type out, std::size_t batch) const
+    {
+      // along the rows, then along the columns: left and right kernels commute
+      bool const row_right = side_ != qft_side::left;
+      pass<Inv>(row_plan_, row_right ? right_ : left_, row_right, in, out, rows_ * batch);
+      if (rows_ == 1) return;
+
+      bool const col_right = side_ == qft_side::right;
+      std::size_t const area = rows_ * cols_;
+      soa_buffer<T, 4> work(area);
+      auto w = work.view();
+      for (std::size_t b = 0; b < batch; ++b)
+      {
+        auto img = out.subview(b * area, area);
+        for (unsigned int k = 0; k < 4; ++k) _::qft_transpose(img.planes[k], w.planes[k], rows_, cols_);
+        pass<Inv>(col_plan_, col_right ? right_ : left_, col_right, w, w, cols_);
+        for (unsigned int k = 0; k < 4; ++k) _::qft_transpose(w.planes[k], img.planes[k], cols_, rows_);
+      }
+    }
+
+    qft_side side_ = qft_side::left;
+    std::size_t rows_ = 0, cols_ = 0;
+    fft_plan<T> row_plan_, col_plan_;
+    _::qft_frame<T> left_, right_;
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+}
@@ -0,0 +1,405 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/types/soa.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  SoA file layout
+  //  A 64 bytes header, in the byte order of the writer, then the N planes of `count` components,
+  //  each starting on a multiple of `alignment` bytes (a power of 2, at least 64) and padded to it.
+  //===-------------------------------------------------------------------------------------------
+  struct soa_file_header
+  {
+    char magic[8];           // "KYOSUSOA"
+    std::uint32_t version;   // 1
+    std::uint32_t endian;    // 0x01020304
+    std::uint32_t type;      // storage type, see soa_file_type
+    std::uint32_t size;      // sizeof of the storage type
+    std::uint32_t dimension; // N
+    std::uint32_t reserved;
+    std::uint64_t count;     // number of values
+    std::uint64_t alignment; // of the planes, in bytes
+    std::uint64_t offset;    // of the first plane, in bytes
+    std::uint64_t stride;    // between two planes, in bytes
+  };
+  static_assert(sizeof(soa_file_header) == 64);
+
+  inline constexpr char soa_file_magic[8] = {'K', 'Y', 'O', 'S', 'U', 'S', 'O', 'A'};
+  inline constexpr std::uint32_t soa_file_version = 1;
+  inline constexpr std::uint32_t soa_file_endian = 0x01020304;
+
+  template<typename S> constexpr std::uint32_t soa_file_type() noexcept
+  {
+    if constexpr (std::same_as<S, float16>) return 0;
+    else if constexpr (std::same_as<S, bfloat16>) return 1;
+    else if constexpr (std::same_as<S, float>) return 2;
+    else return 3;
+  }
+
+  template<typename S, unsigned int N>
+  soa_file_header soa_file_layout(std::uint64_t count, std::uint64_t alignment) noexcept
+  {
+    alignment = std::bit_ceil(std::max<std::uint64_t>(alignment, 64));
+    auto up = [alignment](std::uint64_t n) { return (n + alignment - 1) / alignment * alignment; };
+    soa_file_header h{{},    soa_file_version, soa_file_endian, soa_file_type<S>(), sizeof(S), N, 0, count,
+                      alignment, up(sizeof(soa_file_header)), up(count * sizeof(S))};
+    std::memcpy(h.magic, soa_file_magic, sizeof(h.magic));
+    return h;
+  }
+
+  inline std::uint64_t soa_file_bytes(soa_file_header const& h) noexcept
+  {
+    return h.offset + h.dimension * h.stride;
+  }
+
+  template<typename S, unsigned int N> bool soa_file_check(soa_file_header const& h, std::uint64_t bytes) noexcept
+  {
+    if (std::memcmp(h.magic, soa_file_magic, sizeof(h.magic)) != 0 || h.version != soa_file_version ||
+        h.endian != soa_file_endian || h.type != soa_file_type<S>() || h.size != sizeof(S) || h.dimension != N ||
+        !std::has_single_bit(h.alignment) || h.alignment > (std::uint64_t(1) << 30))
+      return false;
+    auto const l = soa_file_layout<S, N>(h.count, h.alignment);
+    return h.alignment == l.alignment && h.offset == l.offset && h.stride == l.stride &&
+           h.count <= bytes / sizeof(S) && soa_file_bytes(h) <= bytes;
+  }
+}
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @class mapped_soa
+  //! @brief Memory-mapped file holding `count` Cayley-Dickson values of dimension N (reals if N is 1) as N planes of S
+  //!
+  //! The file starts with a 64 bytes header recording the storage type, N, the count and the alignment of the
+  //! planes, followed by the planes, each of them starting on a multiple of the alignment (4096 bytes by default).
+  //! Its view() is a kyosu::soa_view over the mapped pages, so that the bulk functions process the file in place,
+  //! without copy, the operating system loading the pages on demand: files larger than the memory are processed
+  //! at the speed of the disk. As for kyosu::soa_view, S is const qualified to map a file read only.
+  //!
+  //! Files are written in the byte order of the machine and are rejected by open() on a machine of the other byte
+  //! order. The header is not included by `kyosu/kyosu.hpp` as it includes the headers of the operating system.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/soa_file.cpp}
+  //====================================================================================================================
+  template<concepts::storage S, unsigned int N>
+  requires(N == 1 || (N > 1 && std::has_single_bit(N)))
+  class mapped_soa
+  {
+  public:
+    using view_type = soa_view<S, N>;
+    using value_type = typename view_type::value_type;
+    static constexpr bool writable = !std::is_const_v<S>;
+
+    mapped_soa(mapped_soa&& o) noexcept
+      : base_(std::exchange(o.base_, nullptr)), bytes_(o.bytes_), header_(o.header_)
+    {
+    }
+
+    mapped_soa& operator=(mapped_soa&& o) noexcept
+    {
+      if (this != &o)
+      {
+        unmap();
+        base_ = std::exchange(o.base_, nullptr);
+        bytes_ = o.bytes_;
+        header_ = o.header_;
+      }
+      return *this;
+    }
+
+    ~mapped_soa() { unmap(); }
+
+    /// Maps an existing file, or nothing if it cannot be mapped or does not hold values of this type
+    static std::optional<mapped_soa> open(char const* path)
+    {
+      mapped_soa m;
+      if (!m.map(path, false, 0)) return std::nullopt;
+      _::soa_file_header h;
+      if (m.bytes_ < sizeof(h)) return std::nullopt;
+      std::memcpy(&h, m.base_, sizeof(h));
+      if (!_::soa_file_check<storage_type, N>(h, m.bytes_)) return std::nullopt;
+      m.header_ = h;
+      return m;
+    }
+
+    /// Creates a file of n zeros
+    static std::optional<mapped_soa> create(char const* path, std::size_t n, std::size_t alignment = 4096)
+    requires(writable)
+    {
+      mapped_soa m;
+      auto h = _::soa_file_layout<storage_type, N>(n, alignment);
+      if (!m.map(path, true, _::soa_file_bytes(h))) return std::nullopt;
+      std::memcpy(m.base_, &h, sizeof(h));
+      m.header_ = h;
+      return m;
+    }
+
+    /// Number of values
+    std::size_t size() const noexcept { return std::size_t(header_.count); }
+
+    /// Alignment of the planes in the file, in bytes
+    std::size_t alignment() const noexcept { return std::size_t(header_.alignment); }
+
+    /// View of the values
+    view_type view() const noexcept
+    {
+      view_type v{{}, size()};
+      auto p = static_cast<unsigned char*>(base_) + header_.offset;
+      for (unsigned int k = 0; k < N; ++k) v.planes[k] = reinterpret_cast<S*>(p + k * header_.stride);
+      return v;
+    }
+
+    value_type operator[](std::size_t i) const noexcept { return view()[i]; }
+
+  private:
+    using storage_type = std::remove_cv_t<S>;
+
+    mapped_soa() = default;
+
+#if defined(_WIN32)
+    bool map(char const* path, bool create, std::uint64_t bytes)
+    {
+      DWORD access = writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ;
+      HANDLE f = CreateFileA(path, access, FILE_SHARE_READ, nullptr, create ? CREATE_ALWAYS : OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (f == INVALID_HANDLE_VALUE) return false;
+      LARGE_INTEGER size;
+      if (create)
+      {
+        size.QuadPart = LONGLONG(bytes);
+        if (!SetFilePointerEx(f, size, nullptr, FILE_BEGIN) || !SetEndOfFile(f)) return CloseHandle(f), false;
+      }
+      else if (!GetFileSizeEx(f, &size)) return CloseHandle(f), false;
+      bytes_ = std::uint64_t(size.QuadPart);
+      if (bytes_ == 0) return CloseHandle(f), false;
+      HANDLE m = CreateFileMappingA(f, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+      CloseHandle(f);
+      if (!m) return false;
+      base_ = MapViewOfFile(m, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+      CloseHandle(m);
+      return base_ != nullptr;
+    }
+
+    void unmap() noexcept
+    {
+      if (base_) UnmapViewOfFile(base_);
+      base_ = nullptr;
+    }
+#else
+    bool map(char const* path, bool create, std::uint64_t bytes)
+    {
+      int flags = writable ? O_RDWR : O_RDONLY;
+      if (create) flags |= O_CREAT | O_TRUNC;
+      int fd = ::open(path, flags, 0644);
+      if (fd < 0) return false;
+      if (create && ::ftruncate(fd, off_t(bytes)) != 0) return ::close(fd), false;
+      struct stat st;
+      if (::fstat(fd, &st) != 0 || st.st_size == 0) return ::close(fd), false;
+      bytes_ = std::uint64_t(st.st_size);
+      void* p = ::mmap(nullptr, bytes_, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (p == MAP_FAILED) return false;
+      // the bulk functions read the planes in order
+      ::madvise(p, bytes_, MADV_SEQUENTIAL);
+      base_ = p;
+      return true;
+    }
+
+    void unmap() noexcept
+    {
+      if (base_) ::munmap(base_, bytes_);
+      base_ = nullptr;
+    }
+#endif
+
+    void* base_ = nullptr;
+    std::uint64_t bytes_ = 0;
+    _::soa_file_header header_{};
+  };
+
+  //====================================================================================================================
+  //! @class soa_writer
+  //! @brief Writes `count` Cayley-Dickson values of dimension N (reals if N is 1) as a file read by kyosu::mapped_soa
+  //!
+  //! The values are appended in order, in one or several calls, and gathered in a buffer of `chunk` values per plane
+  //! which is written to the N planes of the file when full. The memory used does not depend on the size of the
+  //! file. Values which are not written are zeros.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/soa_file.cpp}
+  //====================================================================================================================
+  template<concepts::storage S, unsigned int N>
+  requires(!std::is_const_v<S> && (N == 1 || (N > 1 && std::has_single_bit(N))))
+  class soa_writer
+  {
+  public:
+    using value_type = typename soa_view<S, N>::value_type;
+
+    /// Writer of a file of count values whose planes are aligned on `alignment` bytes
+    soa_writer(char const* path, std::size_t count, std::size_t alignment = 4096, std::size_t chunk = 1 << 16)
+      : os_(path, std::ios::binary | std::ios::trunc)
+      , header_(_::soa_file_layout<S, N>(count, alignment))
+      , chunk_(std::max<std::size_t>(chunk, 1))
+      , buffer_(N * chunk_)
+    {
+      os_.write(reinterpret_cast<char const*>(&header_), sizeof(header_));
+      // sets the size of the file
+      auto const bytes = _::soa_file_bytes(header_);
+      os_.seekp(std::streamoff(bytes - 1));
+      os_.put('\0');
+    }
+
+    soa_writer(soa_writer&&) = default;
+
+    /// Closes the file of this writer, writing its pending values, before taking over the one of o
+    soa_writer& operator=(soa_writer&& o)
+    {
+      if (this != &o)
+      {
+        close();
+        os_ = std::move(o.os_);
+        header_ = o.header_;
+        chunk_ = o.chunk_;
+        buffer_ = std::move(o.buffer_);
+        written_ = std::exchange(o.written_, 0);
+        pending_ = std::exchange(o.pending_, 0);
+        failed_ = o.failed_;
+      }
+      return *this;
+    }
+
+    ~soa_writer() { close(); }
+
+    /// Appends the elements of zs, as many as there is room for
+    template<typename Z, std::size_t E>
+    requires(std::same_as<std::remove_cv_t<Z>, value_type>)
+    soa_writer& write(std::span<Z, E> zs)
+    {
+      append(zs.size(), [&](std::size_t i, std::size_t n) { _::bulk_apply(zs.subspan(i, n), buffer(), copy); });
+      return *this;
+    }
+
+    /// Appends the elements of a view of the same storage
+    soa_writer& write(soa_view<S const, N> zs)
+    {
+      append(zs.size(), [&](std::size_t i, std::size_t n) {
+        for (unsigned int k = 0; k < N; ++k) std::copy_n(zs.planes[k] + i, n, buffer().planes[k]);
+      });
+      return *this;
+    }
+
+    /// Appends z
+    soa_writer& push(value_type const& z)
+    {
+      append(1, [&](std::size_t, std::size_t) { buffer().set(0, z); });
+      return *this;
+    }
+
+    /// Number of values written
+    std::size_t size() const noexcept { return written_ + pending_; }
+
+    /// False after a failure of the stream or an attempt to write more than count values
+    explicit operator bool() const noexcept { return !failed_ && bool(os_); }
+
+    /// Writes the pending values and closes the file, returns true if everything was written
+    bool close()
+    {
+      if (!os_.is_open()) return bool(*this);
+      flush();
+      os_.close();
+      return !failed_ && !os_.fail();
+    }
+
+  private:
+    static constexpr auto copy = [](auto z) { return z; };
+
+    // room for n values at the end of the buffer
+    soa_view<S, N> buffer() noexcept
+    {
+      soa_view<S, N> v{{}, chunk_ - pending_};
+      for (unsigned int k = 0; k < N; ++k) v.planes[k] = buffer_.data() + k * chunk_ + pending_;
+      return v;
+    }
+
+    // fill(i, n) copies the n elements of the source starting at i at the end of the buffer
+    template<typename F> void append(std::size_t count, F fill)
+    {
+      if (size() + count > header_.count)
+      {
+        failed_ = true;
+        count = std::size_t(header_.count) - size();
+      }
+      for (std::size_t i = 0; i < count;)
+      {
+        auto n = std::min(count - i, chunk_ - pending_);
+        fill(i, n);
+        pending_ += n;
+        i += n;
+        if (pending_ == chunk_) flush();
+      }
+    }
+
+    void flush()
+    {
+      if (pending_ == 0) return;
+      for (unsigned int k = 0; k < N; ++k)
+      {
+        os_.seekp(std::streamoff(header_.offset + k * header_.stride + written_ * sizeof(S)));
+        os_.write(reinterpret_cast<char const*>(buffer_.data() + k * chunk_), std::streamsize(pending_ * sizeof(S)));
+      }
+      written_ += pending_;
+      pending_ = 0;
+    }
+
+    std::ofstream os_;
+    _::soa_file_header header_;
+    std::size_t chunk_;
+    std::vector<S> buffer_;
+    std::size_t written_ = 0, pending_ = 0;
+    bool failed_ = false;
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+}
@@ -0,0 +1,399 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/details/bulk.hpp>
+#include <kyosu/functions/abs.hpp>
+#include <kyosu/functions/if_else.hpp>
+#include <kyosu/functions/to_complex.hpp>
+#include <kyosu/types/cayley_dickson.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <vector>
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @class tabulated_function
+  //! @brief Interpolation table of a complex function over a rectangle of the complex plane
+  //!
+  //! The rectangle is split in a uniform grid of patches. On each patch the function is interpolated by a tensor
+  //! product of Chebyshev polynomials of degree d (8 by default) at the Chebyshev points of the first kind. The
+  //! grid is refined by halving the patches until the error measured at a 5x5 uniform grid of sample points of every
+  //! patch is below the requested tolerance, or until the number of patches would exceed a maximum. The error of a
+  //! sample is \f$|p - f| / (1 + |f|)\f$, an absolute error for small values and a relative one for large values.
+  //!
+  //! The coefficients are stored as planes: the coefficient (i, j) of all the patches is contiguous, so that a SIMD
+  //! lookup fetches the coefficients of all its lanes by one gather per coefficient whatever their patches. The
+  //! values outside of the rectangle are NaN.
+  //!
+  //! Tables can be saved to and loaded from binary streams, in the byte order of the machine, to skip the
+  //! tabulation. A table can be used by several threads at once.
+  //!
+  //! @groupheader{Example}
+  //! @godbolt{doc/tabulate.cpp}
+  //====================================================================================================================
+  template<eve::floating_scalar_value T> class tabulated_function
+  {
+  public:
+    using value_type = complex_t<T>;
+    static constexpr std::size_t max_degree = 16;
+
+    /// Empty table, whose values are NaN
+    tabulated_function() = default;
+
+    /// Table of f over the rectangle of opposite corners lo and hi
+    template<typename F>
+    tabulated_function(F f, value_type lo, value_type hi, T tolerance, std::size_t degree = 8,
+                       std::size_t max_patches = std::size_t(1) << 16)
+      : x0_(eve::min(real(lo), real(hi)))
+      , x1_(eve::max(real(lo), real(hi)))
+      , y0_(eve::min(imag(lo), imag(hi)))
+      , y1_(eve::max(imag(lo), imag(hi)))
+      , tol_(tolerance)
+      , degree_(std::min(degree, max_degree))
+    {
+      EVE_ASSERT(x1_ > x0_ && y1_ > y0_, "the rectangle must not be empty");
+      // patches about square
+      auto w = x1_ - x0_, h = y1_ - y0_;
+      nx_ = std::size_t(eve::max(T(1), eve::nearest(w / h)));
+      ny_ = std::size_t(eve::max(T(1), eve::nearest(h / w)));
+      while (true)
+      {
+        build(f);
+        verify(f);
+        if (accurate() || 4 * nx_ * ny_ > max_patches) break;
+        nx_ *= 2;
+        ny_ *= 2;
+      }
+    }
+
+    /// Value at z, scalar or SIMD, real or complex
+    template<concepts::complex_like Z>
+    requires(std::same_as<eve::underlying_type_t<Z>, T>)
+    complexify_t<Z> operator()(Z z) const noexcept
+    {
+      using c_t = complexify_t<Z>;
+      using r_t = as_real_type_t<c_t>;
+      c_t cz(z);
+      if (patches() == 0) return kyosu::complex(eve::nan(eve::as<r_t>()), eve::nan(eve::as<r_t>()));
+
+      // position in patch units, lanes outside of the rectangle are set to 0
+      auto u = (real(cz) - x0_) * T(nx_) / (x1_ - x0_);
+      auto v = (imag(cz) - y0_) * T(ny_) / (y1_ - y0_);
+      auto inside = eve::is_greater_equal(u, T(0)) && eve::is_less_equal(u, T(nx_)) &&
+                    eve::is_greater_equal(v, T(0)) && eve::is_less_equal(v, T(ny_));
+      u = eve::if_else(inside, u, eve::zero);
+      v = eve::if_else(inside, v, eve::zero);
+      auto iu = eve::min(eve::floor(u), T(nx_ - 1));
+      auto iv = eve::min(eve::floor(v), T(ny_ - 1));
+      auto s = 2 * (u - iu) - 1;
+      auto t = 2 * (v - iv) - 1;
+      auto p = eve::fma(iv, T(nx_), iu);
+
+      auto [re, im] = [&]() {
+        if constexpr (eve::scalar_value<r_t>) return evaluate(std::size_t(p), s, t);
+        else
+        {
+          using i_t = eve::as_integer_t<r_t>;
+          return evaluate(eve::convert(p, eve::as<eve::element_type_t<i_t>>()), s, t);
+        }
+      }();
+      auto nan = eve::nan(eve::as<r_t>());
+      return kyosu::complex(eve::if_else(inside, re, nan), eve::if_else(inside, im, nan));
+    }
+
+    /// Values at the elements of zs, stored in rs
+    template<concepts::complex_like Z, std::size_t S1, typename R, std::size_t S2>
+    requires(std::same_as<R, complexify_t<std::remove_cv_t<Z>>> && std::same_as<eve::underlying_type_t<Z>, T>)
+    void operator()(std::span<Z, S1> zs, std::span<R, S2> rs) const noexcept
+    {
+      _::bulk_apply(zs, rs, [&](auto z) { return (*this)(z); });
+    }
+
+    /// Largest error measured at the sample points
+    T error() const noexcept { return err_; }
+
+    /// Requested tolerance
+    T tolerance() const noexcept { return tol_; }
+
+    /// True if the measured error is below the tolerance
+    bool accurate() const noexcept { return err_ <= tol_; }
+
+    /// Degree of the polynomials in each direction
+    std::size_t degree() const noexcept { return degree_; }
+
+    /// Number of patches
+    std::size_t patches() const noexcept { return nx_ * ny_; }
+
+    /// Corners of the rectangle
+    value_type lower() const noexcept { return value_type(x0_, y0_); }
+    value_type upper() const noexcept { return value_type(x1_, y1_); }
+
+    /// Writes the table to os
+    void save(std::ostream& os) const
+    {
+      header h{{}, version, std::uint32_t(sizeof(T)), std::uint32_t(degree_), 0, nx_, ny_};
+      std::memcpy(h.magic, magic, sizeof(h.magic));
+      os.write(reinterpret_cast<char const*>(&h), sizeof(h));
+      T const bounds[6] = {x0_, x1_, y0_, y1_, tol_, err_};
+      os.write(reinterpret_cast<char const*>(bounds), sizeof(bounds));
+      os.write(reinterpret_cast<char const*>(re_.data()), std::streamsize(re_.size() * sizeof(T)));
+      os.write(reinterpret_cast<char const*>(im_.data()), std::streamsize(im_.size() * sizeof(T)));
+    }
+
+    /// Reads a table written by save, or nothing if the stream does not hold a table of T
+    static std::optional<tabulated_function> load(std::istream& is)
+    {
+      header h;
+      if (!is.read(reinterpret_cast<char*>(&h), sizeof(h))) return std::nullopt;
+      if (std::memcmp(h.magic, magic, sizeof(h.magic)) != 0 || h.version != version || h.size != sizeof(T) ||
+          h.degree > max_degree || h.nx == 0 || h.ny == 0 || h.nx > max_side || h.ny > max_side)
+        return std::nullopt;
+
+      tabulated_function r;
+      T bounds[6];
+      if (!is.read(reinterpret_cast<char*>(bounds), sizeof(bounds))) return std::nullopt;
+      r.x0_ = bounds[0];
+      r.x1_ = bounds[1];
+      r.y0_ = bounds[2];
+      r.y1_ = bounds[3];
+      r.tol_ = bounds[4];
+      r.err_ = bounds[5];
+      r.degree_ = h.degree;
+      r.nx_ = std::size_t(h.nx);
+      r.ny_ = std::size_t(h.ny);
+
+      // the header must not make us allocate more than the stream holds
+      std::uint64_t const k = std::uint64_t(h.degree + 1) * (h.degree + 1);
+      std::uint64_t const limit = std::uint64_t(std::numeric_limits<std::streamsize>::max()) / (2 * sizeof(T));
+      if (h.nx > limit / k || h.ny > limit / (k * h.nx)) return std::nullopt;
+      std::uint64_t const n = k * h.nx * h.ny;
+      if (auto left = remaining(is); left && *left / (2 * sizeof(T)) < n) return std::nullopt;
+      if (!read_values(is, r.re_, n) || !read_values(is, r.im_, n)) return std::nullopt;
+      return r;
+    }
+
+  private:
+    static constexpr char magic[8] = {'K', 'Y', 'O', 'S', 'U', 'T', 'A', 'B'};
+    static constexpr std::uint32_t version = 1;
+    static constexpr std::uint64_t max_side = std::uint64_t(1) << 24;
+
+    // bytes left in a seekable stream
+    static std::optional<std::uint64_t> remaining(std::istream& is)
+    {
+      auto const pos = is.tellg();
+      if (pos == std::istream::pos_type(-1) || !is.seekg(0, std::ios_base::end)) return std::nullopt;
+      auto const end = is.tellg();
+      is.seekg(pos);
+      if (end == std::istream::pos_type(-1) || end < pos) return std::nullopt;
+      return std::uint64_t(end - pos);
+    }
+
+    // reads n values by pieces, so that the storage only grows with the data actually read
+    static bool read_values(std::istream& is, std::vector<T>& v, std::uint64_t n)
+    {
+      constexpr std::uint64_t piece = std::uint64_t(1) << 16;
+      v.clear();
+      for (std::uint64_t i = 0; i < n; i += piece)
+      {
+        auto const m = std::min(piece, n - i);
+        v.resize(std::size_t(i + m));
+        if (!is.read(reinterpret_cast<char*>(v.data() + i), std::streamsize(m * sizeof(T)))) return false;
+      }
+      return true;
+    }
+
+    struct header
+    {
+      char magic[8];
+      std::uint32_t version, size, degree, reserved;
+      std::uint64_t nx, ny;
+    };
+
+    // point of relative coordinates (a, b) in [-1, 1]^2 of the patch (ix, iy)
+    value_type point(std::size_t ix, std::size_t iy, T a, T b) const noexcept
+    {
+      auto hx = (x1_ - x0_) / T(nx_);
+      auto hy = (y1_ - y0_) / T(ny_);
+      return value_type(x0_ + (T(ix) + (a + 1) / 2) * hx, y0_ + (T(iy) + (b + 1) / 2) * hy);
+    }
+
+    // Chebyshev coefficients of the interpolants at the Chebyshev points of the first kind
+    template<typename F> void build(F& f)
+    {
+      std::size_t const n = degree_ + 1;
+      std::size_t const np = patches();
+      std::vector<T> nodes(n), tm(n * n);
+      for (std::size_t a = 0; a < n; ++a) nodes[a] = eve::cospi((T(a) + T(0.5)) / T(n));
+      for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t a = 0; a < n; ++a) tm[i * n + a] = eve::cospi(T(i) * (T(a) + T(0.5)) / T(n));
+
+      std::vector<value_type> zs(np * n * n), fs(zs.size());
+      for (std::size_t iy = 0; iy < ny_; ++iy)
+        for (std::size_t ix = 0; ix < nx_; ++ix)
+          for (std::size_t a = 0; a < n; ++a)
+            for (std::size_t b = 0; b < n; ++b)
+              zs[((iy * nx_ + ix) * n + a) * n + b] = point(ix, iy, nodes[a], nodes[b]);
+      _::bulk_apply(std::span(zs), std::span(fs), f);
+
+      re_.assign(n * n * np, T(0));
+      im_.assign(n * n * np, T(0));
+      std::vector<value_type> g(n * n);
+      for (std::size_t p = 0; p < np; ++p)
+      {
+        value_type const* fp = fs.data() + p * n * n;
+        // transform along the real direction, then along the imaginary one
+        for (std::size_t i = 0; i < n; ++i)
+          for (std::size_t b = 0; b < n; ++b)
+          {
+            value_type s(0);
+            for (std::size_t a = 0; a < n; ++a) s += tm[i * n + a] * fp[a * n + b];
+            g[i * n + b] = s;
+          }
+        for (std::size_t i = 0; i < n; ++i)
+          for (std::size_t j = 0; j < n; ++j)
+          {
+            value_type s(0);
+            for (std::size_t b = 0; b < n; ++b) s += tm[j * n + b] * g[i * n + b];
+            s *= T(4) / T(n * n) * (i == 0 ? T(0.5) : T(1)) * (j == 0 ? T(0.5) : T(1));
+            re_[(i * n + j) * np + p] = real(s);
+            im_[(i * n + j) * np + p] = imag(s);
+          }
+      }
+    }
+
+    // largest error at a 5x5 uniform grid of each patch
+    template<typename F> void verify(F& f)
+    {
+      constexpr std::size_t m = 5;
+      auto grid = [](std::size_t a) { return T(-1) + T(2 * a) / T(m - 1); };
+      std::vector<value_type> zs(patches() * m * m), fs(zs.size()), ps(zs.size());
+      for (std::size_t iy = 0; iy < ny_; ++iy)
+        for (std::size_t ix = 0; ix < nx_; ++ix)
+          for (std::size_t a = 0; a < m; ++a)
+            for (std::size_t b = 0; b < m; ++b)
+              zs[((iy * nx_ + ix) * m + a) * m + b] = point(ix, iy, grid(a), grid(b));
+      _::bulk_apply(std::span(zs), std::span(fs), f);
+      (*this)(std::span(zs), std::span(ps));
+
+      err_ = T(0);
+      for (std::size_t k = 0; k < zs.size(); ++k)
+      {
+        auto e = kyosu::abs(ps[k] - fs[k]) / (1 + kyosu::abs(fs[k]));
+        err_ = eve::is_nan(e) ? eve::inf(eve::as<T>()) : eve::max(err_, e);
+      }
+    }
+
+    // sum of c_ij T_i(s) T_j(t) over the patches p of the lanes
+    template<typename I, typename V> auto evaluate(I p, V s, V t) const noexcept
+    {
+      std::size_t const n = degree_ + 1;
+      std::size_t const np = patches();
+      auto coef = [&](std::vector<T> const& c, std::size_t k) {
+        if constexpr (eve::scalar_value<V>) return c[k * np + p];
+        else return eve::gather(c.data() + k * np, p);
+      };
+
+      std::array<V, max_degree + 1> tt;
+      tt[0] = V(1);
+      if (n > 1) tt[1] = t;
+      for (std::size_t j = 2; j < n; ++j) tt[j] = eve::fms(2 * t, tt[j - 1], tt[j - 2]);
+
+      // rows r_i = sum_j c_ij T_j(t), then Clenshaw in s
+      V b1r(0), b2r(0), b1i(0), b2i(0);
+      for (std::size_t i = n; i-- > 0;)
+      {
+        V rr(0), ri(0);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+          rr = eve::fma(coef(re_, i * n + j), tt[j], rr);
+          ri = eve::fma(coef(im_, i * n + j), tt[j], ri);
+        }
+        if (i == 0) return kumi::tuple{eve::fma(s, b1r, rr - b2r), eve::fma(s, b1i, ri - b2i)};
+        auto br = eve::fma(2 * s, b1r, rr - b2r);
+        auto bi = eve::fma(2 * s, b1i, ri - b2i);
+        b2r = b1r;
+        b1r = br;
+        b2i = b1i;
+        b1i = bi;
+      }
+      return kumi::tuple{b1r, b1i};
+    }
+
+    T x0_{}, x1_{}, y0_{}, y1_{};
+    T tol_{}, err_ = eve::inf(eve::as<T>());
+    std::size_t degree_ = 0, nx_ = 0, ny_ = 0;
+    std::vector<T> re_, im_; // plane (i, j) of the coefficients of T_i(s) T_j(t) of all the patches
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @addtogroup functions
+  //! @{
+  //!   @var tabulate
+  //!   @brief Builds an interpolation table of a complex function over a rectangle of the complex plane
+  //!
+  //!   @groupheader{Header file}
+  //!
+  //!   @code
+  //!   #include <kyosu/tabulate.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace kyosu
+  //!   {
+  //!      template<typename F, typename T>
+  //!      tabulated_function<T> tabulate(F f, complex_t<T> lo, complex_t<T> hi, T tolerance,
+  //!                                     std::size_t degree = 8, std::size_t max_patches = 65536);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!     * `f`: callable accepting `complex_t<T>` and `eve::wide<complex_t<T>>` values, as the kyosu functions.
+  //!     * `lo`, `hi`: opposite corners of the rectangle.
+  //!     * `tolerance`: largest error accepted, in the sense of kyosu::tabulated_function.
+  //!     * `degree`: degree of the Chebyshev interpolants of the patches in each direction, at most 16.
+  //!     * `max_patches`: largest number of patches of the table.
+  //!
+  //!   **Return value**
+  //!
+  //!     A kyosu::tabulated_function, whose `accurate()` member tells whether the tolerance was met.
+  //!
+  //!   @groupheader{Example}
+  //!   @godbolt{doc/tabulate.cpp}
+  //! @}
+  //====================================================================================================================
+  template<typename F, eve::floating_scalar_value T>
+  tabulated_function<T> tabulate(F f, complex_t<T> lo, complex_t<T> hi, T tolerance, std::size_t degree = 8,
+                                 std::size_t max_patches = std::size_t(1) << 16)
+  {
+    return tabulated_function<T>(f, lo, hi, tolerance, degree, max_patches);
+  }
+}
@@ -15,3 +15,4 @@
 #include <kyosu/types/quaternion.hpp>
 #include <kyosu/types/octonion.hpp>
 #include <kyosu/types/literals.hpp>
+#include <kyosu/types/soa.hpp>
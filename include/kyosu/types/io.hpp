@@ -8,7 +8,14 @@
 #pragma once
 
 #include <eve/module/core.hpp>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <span>
 #include <string>
+#include <string_view>
+#include <system_error>
 
 namespace kyosu
 {
@@ -43,3 +50,203 @@ namespace kyosu
   //! @}
   //====================================================================================================================
 }
+
+namespace kyosu::_
+{
+  //===-------------------------------------------------------------------------------------------
+  //  Character conversions
+  //  Units are those of operator<<: none for the real part, i, j, k, l, li, lj, lk up to the
+  //  octonions and z1, z2, ... above them, the real part being written z0 there.
+  //===-------------------------------------------------------------------------------------------
+  inline constexpr std::string_view chars_units[8] = {"", "i", "j", "k", "l", "li", "lj", "lk"};
+
+  inline char* chars_put(char* first, char* last, std::string_view s) noexcept
+  {
+    if (std::size_t(last - first) < s.size()) return nullptr;
+    for (char c : s) *first++ = c;
+    return first;
+  }
+
+  template<unsigned int N> char* chars_unit(char* first, char* last, std::size_t i) noexcept
+  {
+    if constexpr (N < 16) return chars_put(first, last, chars_units[i]);
+    else
+    {
+      first = chars_put(first, last, "z");
+      if (!first) return nullptr;
+      auto [p, ec] = std::to_chars(first, last, i);
+      return ec == std::errc{} ? p : nullptr;
+    }
+  }
+
+  // index of the unit starting at first, N if there is none, -1 if it is not one of CD<T, N>
+  template<unsigned int N> int chars_parse_unit(char const*& first, char const* last) noexcept
+  {
+    if (first == last) return N;
+    if (*first == 'z')
+    {
+      unsigned int i = 0;
+      auto [p, ec] = std::from_chars(first + 1, last, i);
+      if (ec != std::errc{} || i >= N) return -1;
+      first = p;
+      return int(i);
+    }
+    for (int i = 7; i > 0; --i)
+    {
+      auto u = chars_units[i];
+      if (std::size_t(last - first) >= u.size() && std::string_view(first, u.size()) == u)
+      {
+        if (i >= int(N)) return -1;
+        first += u.size();
+        return i;
+      }
+    }
+    return N;
+  }
+
+  inline char const* chars_skip_blanks(char const* first, char const* last) noexcept
+  {
+    while (first != last && (*first == ' ' || *first == '\t')) ++first;
+    return first;
+  }
+
+#if defined(__cpp_lib_to_chars)
+  // z read from [first, last[; with split, a term repeating a unit whose sign is attached to its number, as in
+  // "1 -2", is not part of z but starts the next value
+  template<eve::floating_scalar_value T, unsigned int N>
+  std::from_chars_result chars_parse(char const* first, char const* last, cayley_dickson<T, N>& z,
+                                     std::chars_format fmt, bool split) noexcept
+  {
+    std::array<T, N> c{};
+    std::array<bool, N> seen{};
+    auto const failed = std::from_chars_result{first, std::errc::invalid_argument};
+    char const* p = chars_skip_blanks(first, last);
+    if (p != last && *p == '+') ++p;
+    for (bool head = true;; head = false)
+    {
+      T sgn(1);
+      char const* q = p;
+      bool attached = false;
+      if (!head)
+      {
+        // another term follows if an operator does
+        q = chars_skip_blanks(p, last);
+        if (q == last || (*q != '+' && *q != '-')) break;
+        sgn = *q == '-' ? T(-1) : T(1);
+        attached = q + 1 != last && q[1] != ' ' && q[1] != '\t';
+        q = chars_skip_blanks(q + 1, last);
+      }
+      T v{};
+      auto [r, ec] = std::from_chars(q, last, v, fmt);
+      if (ec == std::errc::result_out_of_range) return {first, ec};
+      if (ec != std::errc{}) return failed;
+      int u = chars_parse_unit<N>(r, last);
+      if (u < 0) return failed;
+      std::size_t i = u == int(N) ? 0 : std::size_t(u);
+      if (seen[i] && split && attached) break;
+      if (seen[i]) return failed;
+      seen[i] = true;
+      c[i] = sgn * v;
+      p = r;
+    }
+    kumi::for_each_index([&](auto i, auto& v) { v = c[i]; }, z);
+    return {p, std::errc{}};
+  }
+#endif
+}
+
+namespace kyosu
+{
+#if defined(__cpp_lib_to_chars)
+  //====================================================================================================================
+  //! @name Character Conversions
+  //! @related cayley_dickson
+  //!
+  //! These conversions rely on the floating-point std::to_chars and std::from_chars and are only provided when the
+  //! standard library has them, i.e. defines `__cpp_lib_to_chars`: libstdc++ 11 and MSVC do, older libc++ does not.
+  //! @{
+  //====================================================================================================================
+
+  /// Result of the conversions of spans of Cayley-Dickson values, count being the number of values converted
+  template<typename Char> struct chars_result
+  {
+    Char* ptr;
+    std::errc ec;
+    std::size_t count;
+  };
+
+  /// Writes z in [first, last[ as `a + bi + cj + dk` in the format fmt, in the shortest form if no precision is given
+  template<eve::floating_scalar_value T, unsigned int N, typename... P>
+  requires(sizeof...(P) <= 1)
+  std::to_chars_result to_chars(char* first, char* last, cayley_dickson<T, N> const& z,
+                                std::chars_format fmt = std::chars_format::general, P... precision) noexcept
+  {
+    std::array<T, N> c;
+    kumi::for_each_index([&](auto i, auto v) { c[i] = v; }, z);
+    auto const failed = std::to_chars_result{last, std::errc::value_too_large};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      auto v = c[i];
+      if (i > 0)
+      {
+        first = _::chars_put(first, last, std::signbit(v) ? " - " : " + ");
+        if (!first) return failed;
+        v = std::abs(v);
+      }
+      auto [p, ec] = std::to_chars(first, last, v, fmt, precision...);
+      if (ec != std::errc{}) return failed;
+      first = (i > 0 || N >= 16) ? _::chars_unit<N>(p, last, i) : p;
+      if (!first) return failed;
+    }
+    return {first, std::errc{}};
+  }
+
+  /// Reads z from [first, last[ as written by to_chars or operator<<, the missing parts being zero
+  template<eve::floating_scalar_value T, unsigned int N>
+  std::from_chars_result from_chars(char const* first, char const* last, cayley_dickson<T, N>& z,
+                                    std::chars_format fmt = std::chars_format::general) noexcept
+  {
+    return _::chars_parse(first, last, z, fmt, false);
+  }
+
+  /// Writes the elements of zs in [first, last[, each of them followed by sep
+  template<typename Z, std::size_t S>
+  requires(concepts::scalar_cayley_dickson<std::remove_cv_t<Z>>)
+  chars_result<char> to_chars(char* first, char* last, std::span<Z, S> zs, char sep = '\n',
+                              std::chars_format fmt = std::chars_format::general) noexcept
+  {
+    for (std::size_t k = 0; k < zs.size(); ++k)
+    {
+      auto [p, ec] = to_chars(first, last, zs[k], fmt);
+      if (ec != std::errc{} || p == last) return {first, std::errc::value_too_large, k};
+      *p = sep;
+      first = p + 1;
+    }
+    return {first, std::errc{}, zs.size()};
+  }
+
+  /// Reads values separated by blanks, line breaks or sep from [first, last[ into zs, up to its size. A term
+  /// repeating a unit of the value before it and whose sign is attached to its number starts a new value:
+  /// "1 -2 +3i" holds 1, -2 + 3i, while "1 - 2" is a malformed value.
+  template<concepts::scalar_cayley_dickson Z, std::size_t S>
+  chars_result<char const> from_chars(char const* first, char const* last, std::span<Z, S> zs, char sep = '\n',
+                                      std::chars_format fmt = std::chars_format::general) noexcept
+  {
+    auto separator = [sep](char c) { return c == sep || c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+    std::size_t k = 0;
+    for (; k < zs.size(); ++k)
+    {
+      while (first != last && separator(*first)) ++first;
+      if (first == last) break;
+      auto [p, ec] = _::chars_parse(first, last, zs[k], fmt, true);
+      if (ec != std::errc{}) return {first, ec, k};
+      first = p;
+    }
+    return {first, std::errc{}, k};
+  }
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+#endif
+}
@@ -0,0 +1,253 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/types/cayley_dickson.hpp>
+#include <kyosu/details/half.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kyosu
+{
+  //====================================================================================================================
+  //! @addtogroup types
+  //! @{
+  //====================================================================================================================
+
+  //====================================================================================================================
+  //! @brief IEEE 754 binary16 storage type
+  //!
+  //! kyosu::float16 only stores values: it is widened to `float` when loaded from a kyosu::soa_view and the `float`
+  //! results are narrowed back to it, rounding to nearest even, when stored.
+  //====================================================================================================================
+  enum class float16 : std::uint16_t
+  {
+  };
+
+  //====================================================================================================================
+  //! @brief bfloat16 storage type (the 16 upper bits of a binary32 value)
+  //!
+  //! Like kyosu::float16, kyosu::bfloat16 only stores values which are processed as `float`.
+  //====================================================================================================================
+  enum class bfloat16 : std::uint16_t
+  {
+  };
+
+  //! @brief Converts a kyosu::float16 to `float`
+  inline float to_float(float16 h) noexcept
+  {
+    return std::bit_cast<float>(_::half_to_float_bits(std::uint32_t(static_cast<std::uint16_t>(h))));
+  }
+
+  //! @brief Converts a kyosu::bfloat16 to `float`
+  inline float to_float(bfloat16 h) noexcept
+  {
+    return std::bit_cast<float>(_::bfloat_to_float_bits(std::uint32_t(static_cast<std::uint16_t>(h))));
+  }
+
+  //! @brief Rounds a `float` to the nearest kyosu::float16 or kyosu::bfloat16
+  template<typename S> S from_float(float f) noexcept
+  {
+    auto u = std::bit_cast<std::uint32_t>(f);
+    if constexpr (std::same_as<S, float16>) return S(std::uint16_t(_::float_to_half_bits(u)));
+    else return S(std::uint16_t(_::float_to_bfloat_bits(u)));
+  }
+
+  namespace concepts
+  {
+    /// 16 bits storage only types
+    template<typename T>
+    concept storage_16 = std::same_as<std::remove_cv_t<T>, float16> || std::same_as<std::remove_cv_t<T>, bfloat16>;
+
+    /// Types of the components stored in a kyosu::soa_view
+    template<typename T>
+    concept storage = eve::floating_scalar_value<std::remove_cv_t<T>> || storage_16<T>;
+  }
+
+  //====================================================================================================================
+  //! @brief Type of the computations on values stored as S: `float` for the 16 bits types, S itself otherwise.
+  //====================================================================================================================
+  template<concepts::storage S> struct compute_type
+  {
+    using type = std::remove_cv_t<S>;
+  };
+
+  template<concepts::storage_16 S> struct compute_type<S>
+  {
+    using type = float;
+  };
+
+  template<concepts::storage S> using compute_type_t = typename compute_type<S>::type;
+
+  //====================================================================================================================
+  //! @class soa_view
+  //! @brief Non owning view over `count` Cayley-Dickson values of dimension N (reals if N is 1) stored as N planes.
+  //!
+  //! Plane k holds the k-th component of all the values. The components may be stored as kyosu::float16 or
+  //! kyosu::bfloat16, the values being then seen as `float` based Cayley-Dickson values: element accesses and
+  //! the bulk functions of kyosu::bulk widen them when loading and narrow them when storing.
+  //! S is const qualified for read-only views.
+  //====================================================================================================================
+  template<concepts::storage S, unsigned int N>
+  requires(N == 1 || (N > 1 && std::has_single_bit(N)))
+  struct soa_view
+  {
+    using storage_type = S;
+    using real_type = compute_type_t<S>;
+    using value_type = std::conditional_t<N == 1, real_type, cayley_dickson<real_type, N>>;
+    static constexpr unsigned int static_dimension = N;
+
+    std::array<S*, N> planes;
+    std::size_t count;
+
+    constexpr std::size_t size() const noexcept { return count; }
+    constexpr bool empty() const noexcept { return count == 0; }
+
+    /// Widened value of the element i
+    value_type operator[](std::size_t i) const noexcept
+    {
+      auto at = [&](unsigned int k) { return load(planes[k][i]); };
+      if constexpr (N == 1) return at(0);
+      else
+        return [&]<std::size_t... K>(std::index_sequence<K...>) {
+          return value_type{at(K)...};
+        }(std::make_index_sequence<N>{});
+    }
+
+    /// Stores v, narrowed to the storage type, as the element i
+    void set(std::size_t i, value_type const& v) const noexcept
+    requires(!std::is_const_v<S>)
+    {
+      if constexpr (N == 1) planes[0][i] = store(v);
+      else
+        [&]<std::size_t... K>(std::index_sequence<K...>) {
+          ((planes[K][i] = store(kumi::get<K>(v))), ...);
+        }(std::make_index_sequence<N>{});
+    }
+
+    /// View of the n elements starting at the element offset
+    constexpr soa_view subview(std::size_t offset, std::size_t n) const noexcept
+    {
+      soa_view r{planes, n};
+      for (auto& p : r.planes) p += offset;
+      return r;
+    }
+
+    /// Read-only view of the same elements
+    constexpr operator soa_view<S const, N>() const noexcept
+    requires(!std::is_const_v<S>)
+    {
+      soa_view<S const, N> r{{}, count};
+      for (unsigned int k = 0; k < N; ++k) r.planes[k] = planes[k];
+      return r;
+    }
+
+  private:
+    static real_type load(S s) noexcept
+    {
+      if constexpr (concepts::storage_16<S>) return to_float(s);
+      else return s;
+    }
+
+    static std::remove_cv_t<S> store(real_type v) noexcept
+    {
+      if constexpr (concepts::storage_16<S>) return from_float<std::remove_cv_t<S>>(v);
+      else return v;
+    }
+  };
+
+  //====================================================================================================================
+  //! @class soa_buffer
+  //! @brief Owning storage of `n` Cayley-Dickson values of dimension N as N planes of S
+  //!
+  //! Each plane starts on a 64 bytes boundary of the buffer. The values are accessed and processed through view().
+  //====================================================================================================================
+  template<concepts::storage S, unsigned int N>
+  requires(!std::is_const_v<S>)
+  class soa_buffer
+  {
+  public:
+    using view_type = soa_view<S, N>;
+    using value_type = typename view_type::value_type;
+
+    soa_buffer() = default;
+
+    /// Buffer of n zeros
+    explicit soa_buffer(std::size_t n) : count_(n), stride_(padded(n)), data_(N * stride_ + align_) {}
+
+    /// Copies are made plane by plane: the alignment shift of the planes depends on the allocation
+    soa_buffer(soa_buffer const& o) : soa_buffer(o.count_)
+    {
+      auto src = o.view();
+      auto dst = view();
+      for (unsigned int k = 0; k < N; ++k) std::copy_n(src.planes[k], count_, dst.planes[k]);
+    }
+
+    soa_buffer& operator=(soa_buffer const& o)
+    {
+      if (this != &o) *this = soa_buffer(o);
+      return *this;
+    }
+
+    /// Moves keep the allocation, hence the planes, and leave o empty
+    soa_buffer(soa_buffer&& o) noexcept
+        : count_(std::exchange(o.count_, 0)), stride_(std::exchange(o.stride_, 0)), data_(std::move(o.data_))
+    {
+    }
+
+    soa_buffer& operator=(soa_buffer&& o) noexcept
+    {
+      if (this != &o)
+      {
+        count_ = std::exchange(o.count_, 0);
+        stride_ = std::exchange(o.stride_, 0);
+        data_ = std::move(o.data_);
+      }
+      return *this;
+    }
+
+    std::size_t size() const noexcept { return count_; }
+
+    view_type view() noexcept
+    {
+      view_type v{{}, count_};
+      for (unsigned int k = 0; k < N; ++k) v.planes[k] = base() + k * stride_;
+      return v;
+    }
+
+    soa_view<S const, N> view() const noexcept { return const_cast<soa_buffer&>(*this).view(); }
+
+    value_type operator[](std::size_t i) const noexcept { return view()[i]; }
+    void set(std::size_t i, value_type const& v) noexcept { view().set(i, v); }
+
+  private:
+    static constexpr std::size_t align_ = 64 / sizeof(S);
+    static constexpr std::size_t padded(std::size_t n) noexcept { return (n + align_ - 1) / align_ * align_; }
+
+    S* base() noexcept
+    {
+      auto p = reinterpret_cast<std::uintptr_t>(data_.data());
+      auto shift = ((64 - p % 64) % 64) / sizeof(S);
+      return data_.data() + shift;
+    }
+
+    std::size_t count_ = 0;
+    std::size_t stride_ = 0;
+    std::vector<S> data_;
+  };
+
+  //====================================================================================================================
+  //! @}
+  //====================================================================================================================
+}
@@ -0,0 +1,42 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+//  Instantiations of kyosu_compiled for the element type KYOSU_COMPILED_T, this file being compiled once for float
+//  and once for double.
+//======================================================================================================================
+#include <kyosu/compiled.hpp>
+#include <kyosu/functions.hpp>
+
+namespace kyosu::compiled
+{
+#define KYOSU_COMPILED_DEFINE(F)                                                                                       \
+  template<concepts::cayley_dickson Z> Z F(Z const& z) noexcept                                                        \
+  {                                                                                                                    \
+    return kyosu::F(z);                                                                                                \
+  }
+  KYOSU_COMPILED_FUNCTIONS(KYOSU_COMPILED_DEFINE)
+#undef KYOSU_COMPILED_DEFINE
+
+  template<concepts::complex Z>
+  Z hypergeometric(Z const& z,
+                   kumi::tuple<complex_t<eve::underlying_type_t<Z>>, complex_t<eve::underlying_type_t<Z>>> const& ab,
+                   kumi::tuple<complex_t<eve::underlying_type_t<Z>>> const& c) noexcept
+  {
+    return kyosu::hypergeometric(z, ab, c);
+  }
+
+#define KYOSU_COMPILED_INSTANTIATE(F, Z) template Z F<Z>(Z const&) noexcept;
+#define KYOSU_COMPILED_INSTANTIATE_ALL(F) KYOSU_COMPILED_TYPES(KYOSU_COMPILED_INSTANTIATE, F, KYOSU_COMPILED_T)
+  KYOSU_COMPILED_FUNCTIONS(KYOSU_COMPILED_INSTANTIATE_ALL)
+#undef KYOSU_COMPILED_INSTANTIATE_ALL
+#undef KYOSU_COMPILED_INSTANTIATE
+
+  using c_t = complex_t<KYOSU_COMPILED_T>;
+  template c_t hypergeometric(c_t const&, kumi::tuple<c_t, c_t> const&, kumi::tuple<c_t> const&) noexcept;
+  template eve::wide<c_t> hypergeometric(eve::wide<c_t> const&, kumi::tuple<c_t, c_t> const&,
+                                         kumi::tuple<c_t> const&) noexcept;
+}
@@ -0,0 +1,131 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include "table.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <string_view>
+
+KYOSU_KERNELS_TABLE_DECLARE(generic)
+#if defined(KYOSU_KERNELS_HAS_sse4)
+KYOSU_KERNELS_TABLE_DECLARE(sse4)
+#endif
+#if defined(KYOSU_KERNELS_HAS_avx2)
+KYOSU_KERNELS_TABLE_DECLARE(avx2)
+#endif
+#if defined(KYOSU_KERNELS_HAS_avx512)
+KYOSU_KERNELS_TABLE_DECLARE(avx512)
+#endif
+
+namespace kyosu::kernels::_
+{
+  // instruction sets supported by the CPU, from CPUID
+  bool cpu_supports(isa i) noexcept
+  {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    switch (i)
+    {
+      case isa::generic: return true;
+      case isa::sse4: return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+      case isa::avx2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("bmi") &&
+               __builtin_cpu_supports("bmi2");
+      case isa::avx512:
+        return cpu_supports(isa::avx2) && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd") &&
+               __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq") &&
+               __builtin_cpu_supports("avx512bw");
+    }
+    return false;
+#else
+    return i == isa::generic;
+#endif
+  }
+
+  // entries of i, or nullptr if i is not compiled in the library
+  table const* entries(isa i) noexcept
+  {
+    switch (i)
+    {
+      case isa::generic: return kyosu_kernels_table_generic();
+#if defined(KYOSU_KERNELS_HAS_sse4)
+      case isa::sse4: return kyosu_kernels_table_sse4();
+#endif
+#if defined(KYOSU_KERNELS_HAS_avx2)
+      case isa::avx2: return kyosu_kernels_table_avx2();
+#endif
+#if defined(KYOSU_KERNELS_HAS_avx512)
+      case isa::avx512: return kyosu_kernels_table_avx512();
+#endif
+      default: return nullptr;
+    }
+  }
+
+  bool usable(isa i) noexcept { return entries(i) && cpu_supports(i); }
+
+  isa startup() noexcept
+  {
+    auto i = best();
+    if (char const* e = std::getenv("KYOSU_ISA"))
+    {
+      for (auto c : {isa::generic, isa::sse4, isa::avx2, isa::avx512})
+        if (std::string_view(e) == name(c) && int(c) < int(i)) i = c;
+    }
+    return i;
+  }
+
+  std::atomic<isa>& selected() noexcept
+  {
+    static std::atomic<isa> s{startup()};
+    return s;
+  }
+
+  table const& active() noexcept { return *entries(selected().load(std::memory_order_relaxed)); }
+}
+
+namespace kyosu::kernels
+{
+  isa best() noexcept
+  {
+    for (auto i : {isa::avx512, isa::avx2, isa::sse4})
+      if (_::usable(i)) return i;
+    return isa::generic;
+  }
+
+  isa current() noexcept { return _::selected().load(std::memory_order_relaxed); }
+
+  bool select(isa i) noexcept
+  {
+    if (!_::usable(i)) return false;
+    _::selected().store(i, std::memory_order_relaxed);
+    return true;
+  }
+
+  char const* name(isa i) noexcept
+  {
+    switch (i)
+    {
+      case isa::generic: return "generic";
+      case isa::sse4: return "sse4";
+      case isa::avx2: return "avx2";
+      case isa::avx512: return "avx512";
+    }
+    return "unknown";
+  }
+
+#define KYOSU_KERNELS_FORWARD(F)                                                                                       \
+  void F(std::span<complex_t<float> const> in, std::span<complex_t<float>> out) noexcept                               \
+  {                                                                                                                    \
+    _::active().F##_f(in, out);                                                                                        \
+  }                                                                                                                    \
+  void F(std::span<complex_t<double> const> in, std::span<complex_t<double>> out) noexcept                             \
+  {                                                                                                                    \
+    _::active().F##_d(in, out);                                                                                        \
+  }
+  KYOSU_KERNELS_FUNCTIONS(KYOSU_KERNELS_FORWARD)
+#undef KYOSU_KERNELS_FORWARD
+}
@@ -0,0 +1,38 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#pragma once
+
+#include <kyosu/kernels.hpp>
+
+namespace kyosu::kernels::_
+{
+  template<typename T> using in_t = std::span<complex_t<T> const>;
+  template<typename T> using out_t = std::span<complex_t<T>>;
+
+  //===-------------------------------------------------------------------------------------------
+  //  Entry points of one instruction set
+  //  Each variant is built in its own shared library with hidden visibility, so that the inline
+  //  functions of kyosu and EVE it instantiates are never merged with those of another variant:
+  //  code compiled for AVX-512 can not be picked by the linker for the SSE4 path.
+  //===-------------------------------------------------------------------------------------------
+  struct table
+  {
+#define KYOSU_KERNELS_ENTRY(F)                                                                                         \
+  void (*F##_f)(in_t<float>, out_t<float>) noexcept;                                                                   \
+  void (*F##_d)(in_t<double>, out_t<double>) noexcept;
+    KYOSU_KERNELS_FUNCTIONS(KYOSU_KERNELS_ENTRY)
+#undef KYOSU_KERNELS_ENTRY
+  };
+}
+
+// kyosu_kernels_table_<isa>(), the only symbol exported by a variant
+#define KYOSU_KERNELS_TABLE_NAME(ISA) KYOSU_KERNELS_TABLE_NAME_(ISA)
+#define KYOSU_KERNELS_TABLE_NAME_(ISA) kyosu_kernels_table_##ISA
+
+#define KYOSU_KERNELS_TABLE_DECLARE(ISA)                                                                               \
+  extern "C" KYOSU_KERNELS_API kyosu::kernels::_::table const* KYOSU_KERNELS_TABLE_NAME(ISA)() noexcept;
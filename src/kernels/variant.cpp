@@ -0,0 +1,40 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+//  Entry points of kyosu_kernels for the instruction set KYOSU_KERNELS_ISA, this file being compiled once per
+//  instruction set with the corresponding flags. It must not hold objects with dynamic initialization: the variants
+//  are loaded on every CPU, and only the code of the selected one may run.
+//======================================================================================================================
+#include "table.hpp"
+#include <kyosu/bulk.hpp>
+#include <kyosu/functions.hpp>
+
+namespace
+{
+#define KYOSU_KERNELS_DEFINE(F)                                                                                        \
+  void F##_f(kyosu::kernels::_::in_t<float> in, kyosu::kernels::_::out_t<float> out) noexcept                         \
+  {                                                                                                                    \
+    kyosu::bulk::transform(in, out, [](auto z) { return kyosu::F(z); });                                               \
+  }                                                                                                                    \
+  void F##_d(kyosu::kernels::_::in_t<double> in, kyosu::kernels::_::out_t<double> out) noexcept                       \
+  {                                                                                                                    \
+    kyosu::bulk::transform(in, out, [](auto z) { return kyosu::F(z); });                                               \
+  }
+  KYOSU_KERNELS_FUNCTIONS(KYOSU_KERNELS_DEFINE)
+#undef KYOSU_KERNELS_DEFINE
+
+#define KYOSU_KERNELS_INIT(F) F##_f, F##_d,
+  constexpr kyosu::kernels::_::table entries{KYOSU_KERNELS_FUNCTIONS(KYOSU_KERNELS_INIT)};
+#undef KYOSU_KERNELS_INIT
+}
+
+KYOSU_KERNELS_TABLE_DECLARE(KYOSU_KERNELS_ISA)
+
+kyosu::kernels::_::table const* KYOSU_KERNELS_TABLE_NAME(KYOSU_KERNELS_ISA)() noexcept
+{
+  return &entries;
+}
@@ -0,0 +1,61 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+
+#include <benchmark.hpp>
+#include <kyosu/kyosu.hpp>
+
+TTS_CASE_TPL("Benchmark complex bessel functions for large arguments", float, double)
+<typename T>(tts::type<T>)
+{
+  using type = kyosu::complex_t<T>;
+
+  // |z| in [20, 1e4], in the regime of the Hankel expansions
+  auto rnd_kyosu = [&]() { return type{::tts::random_value<T>(20, 10000), ::tts::random_value<T>(-20, 20)}; };
+  auto j3 = [](auto z) { return kyosu::bessel_j(3, z); };
+  auto y3 = [](auto z) { return kyosu::bessel_y(3, z); };
+  auto j52 = [](auto z) { return kyosu::bessel_j(T(2.5), z); };
+  auto h1 = [](auto z) { return kyosu::bessel_h(1, z); };
+
+  kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> bessel, |z| in [20, 1e4]");
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar bessel_j(3, z)", j3, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide bessel_j(3, z)", j3, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar bessel_y(3, z)", y3, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide bessel_y(3, z)", y3, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar bessel_j(2.5, z)", j52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide bessel_j(2.5, z)", j52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar bessel_h(1, z)", h1, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide bessel_h(1, z)", h1, rnd_kyosu);
+
+  TTS_PASS("Benchmarks - SUCCESS");
+};
+
+TTS_CASE_TPL("Benchmark bessel_plan against the bessel functions", float, double)
+<typename T>(tts::type<T>)
+{
+  using type = kyosu::complex_t<T>;
+
+  // radii of a radial basis: fractional order, small and large arguments
+  auto rnd_kyosu = [&]() { return type{::tts::random_value<T>(0, 60), ::tts::random_value<T>(-1, 1)}; };
+  kyosu::bessel_plan<T> p(T(2.5));
+  auto j52 = [](auto z) { return kyosu::bessel_j(T(2.5), z); };
+  auto pj52 = [&p](auto z) { return p.j(z); };
+  auto k52 = [](auto z) { return kyosu::bessel_k(T(2.5), z); };
+  auto pk52 = [&p](auto z) { return p.k(z); };
+
+  kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> bessel_plan(2.5), |z| in [0, 60]");
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar bessel_j(2.5, z)", j52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide bessel_j(2.5, z)", j52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar bessel_plan::j", pj52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide bessel_plan::j", pj52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar bessel_k(2.5, z)", k52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide bessel_k(2.5, z)", k52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar bessel_plan::k", pk52, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide bessel_plan::k", pk52, rnd_kyosu);
+
+  TTS_PASS("Benchmarks - SUCCESS");
+};
@@ -0,0 +1,41 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+
+#include <benchmark.hpp>
+#include <kyosu/kyosu.hpp>
+#include <complex>
+
+TTS_CASE_TPL("Benchmark complex compensated arithmetic", float, double)
+<typename T>(tts::type<T>)
+{
+  using type = kyosu::complex_t<T>;
+
+  auto rnd_kyosu = [&]() { return type{::tts::random_value<T>(-10, 10), ::tts::random_value<T>(-10, 10)}; };
+  auto dot4 = [](auto a, auto b, auto c, auto d) { return kyosu::dot(a, b, c, d); };
+  auto kdot4 = [](auto a, auto b, auto c, auto d) { return kyosu::dot[eve::kahan](a, b, c, d); };
+  auto add4 = [](auto a, auto b, auto c, auto d) { return kyosu::add(a, b, c, d); };
+  auto kadd4 = [](auto a, auto b, auto c, auto d) { return kyosu::add[eve::kahan](a, b, c, d); };
+  auto hor = [](auto x, auto a, auto b, auto c) { return kyosu::horner(x, a, b, c, a, b, c, a); };
+  auto khor = [](auto x, auto a, auto b, auto c) { return kyosu::horner[eve::kahan](x, a, b, c, a, b, c, a); };
+  auto dv = [](auto a, auto b) { return kyosu::div(a, b); };
+  auto kdv = [](auto a, auto b) { return kyosu::div[eve::kahan](a, b); };
+
+  {
+    kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> regular vs kahan");
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::add", add4, rnd_kyosu, rnd_kyosu, rnd_kyosu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::add[kahan]", kadd4, rnd_kyosu, rnd_kyosu, rnd_kyosu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::dot", dot4, rnd_kyosu, rnd_kyosu, rnd_kyosu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::dot[kahan]", kdot4, rnd_kyosu, rnd_kyosu, rnd_kyosu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::horner", hor, rnd_kyosu, rnd_kyosu, rnd_kyosu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::horner[kahan]", khor, rnd_kyosu, rnd_kyosu, rnd_kyosu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::div", dv, rnd_kyosu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::div[kahan]", kdv, rnd_kyosu, rnd_kyosu);
+  }
+
+  TTS_PASS("Benchmarks - SUCCESS");
+};
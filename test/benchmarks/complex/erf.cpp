@@ -23,5 +23,15 @@ TTS_CASE_TPL("Benchmark complex erf", float, double)
     TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide", kyosu::erf, rnd_kyosu);
   }
 
+  // purely imaginary inputs spread over the Taylor, tabulated and continued fraction intervals,
+  // so that the lanes of a wide fall in different pieces of the table
+  auto rnd_axis = [&]() { return type{T(0), ::tts::random_value<T>(-60, 60)}; };
+
+  {
+    kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> erf on the imaginary axis");
+    TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar ", kyosu::erf, rnd_axis);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide", kyosu::erf, rnd_axis);
+  }
+
   TTS_PASS("Benchmarks - SUCCESS");
 };
@@ -0,0 +1,118 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+
+#include <benchmark.hpp>
+#include <kyosu/kyosu.hpp>
+#include <complex>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+  // O(n^2) DFT
+  template<typename T> void naive_dft(std::vector<std::complex<T>> const& x, std::vector<std::complex<T>>& y)
+  {
+    auto n = x.size();
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      std::complex<T> s(0);
+      for (std::size_t j = 0; j < n; ++j)
+        s += x[j] * std::polar(T(1), T(-2 * std::numbers::pi * double((j * k) % n) / double(n)));
+      y[k] = s;
+    }
+  }
+
+  // textbook recursive radix-2 Cooley-Tukey on std::complex, as a scalar reference
+  template<typename T> void reference_fft(std::complex<T>* x, std::size_t n, std::complex<T>* tmp)
+  {
+    if (n == 1) return;
+    auto h = n / 2;
+    for (std::size_t j = 0; j < h; ++j)
+    {
+      tmp[j] = x[2 * j];
+      tmp[h + j] = x[2 * j + 1];
+    }
+    reference_fft(tmp, h, x);
+    reference_fft(tmp + h, h, x);
+    for (std::size_t k = 0; k < h; ++k)
+    {
+      auto t = std::polar(T(1), T(-2 * std::numbers::pi * double(k) / double(n))) * tmp[h + k];
+      x[k] = tmp[k] + t;
+      x[h + k] = tmp[k] - t;
+    }
+  }
+}
+
+TTS_CASE_TPL("Benchmark complex FFT", float, double)
+<typename T>(tts::type<T>)
+{
+  auto zero = []() { return T(0); };
+  for (std::size_t n : {256, 4096})
+  {
+    std::vector<std::complex<T>> x(n), y(n), tmp(n);
+    kyosu::soa_buffer<T, 2> in(n), out(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      x[i] = {::tts::random_value<T>(-1, 1), ::tts::random_value<T>(-1, 1)};
+      in.set(i, kyosu::complex(x[i].real(), x[i].imag()));
+    }
+    kyosu::fft_plan<T> plan(n);
+
+    auto dft = [&](auto) {
+      naive_dft(x, y);
+      return y[1].real();
+    };
+    auto ref = [&](auto) {
+      y = x;
+      reference_fft(y.data(), n, tmp.data());
+      return y[1].real();
+    };
+    auto fwd = [&](auto) {
+      plan.forward(in.view(), out.view());
+      return out.view().planes[0][1];
+    };
+    auto inplace = [&](auto) {
+      plan.forward(out.view());
+      return out.view().planes[0][1];
+    };
+
+    tts::text title{"complex<%s> FFT of size %d", tts::as_text(tts::typename_<T>).data(), int(n)};
+    kyosu::bench::benchmark _(title, 200);
+    if (n <= 256) TTS_RUN_BENCHMARK_TPL(_, T, "naive DFT", dft, zero);
+    TTS_RUN_BENCHMARK_TPL(_, T, "reference radix-2 FFT", ref, zero);
+    TTS_RUN_BENCHMARK_TPL(_, T, "kyosu::fft_plan::forward", fwd, zero);
+    TTS_RUN_BENCHMARK_TPL(_, T, "kyosu::fft_plan::forward in place", inplace, zero);
+  }
+
+  {
+    std::size_t const n = 64, batch = 64;
+    kyosu::soa_buffer<T, 2> in(n * batch), out(n * batch);
+    for (std::size_t i = 0; i < n * batch; ++i)
+      in.set(i, kyosu::complex(::tts::random_value<T>(-1, 1), ::tts::random_value<T>(-1, 1)));
+    kyosu::fft_plan<T> plan(n);
+    std::vector<T> r(2 * n * batch);
+    for (auto& v : r) v = ::tts::random_value<T>(-1, 1);
+    kyosu::real_fft_plan<T> rplan(2 * n);
+    kyosu::soa_buffer<T, 2> spectra((n + 1) * batch);
+
+    auto batched = [&](auto) {
+      plan.forward(in.view(), out.view(), batch);
+      return out.view().planes[0][1];
+    };
+    auto real = [&](auto) {
+      rplan.forward(r, spectra.view(), batch);
+      return spectra.view().planes[0][1];
+    };
+
+    kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> batched FFT", 200);
+    TTS_RUN_BENCHMARK_TPL(_, T, "64 complex FFT of size 64", batched, zero);
+    TTS_RUN_BENCHMARK_TPL(_, T, "64 real FFT of size 128", real, zero);
+  }
+
+  TTS_PASS("Benchmarks - SUCCESS");
+};
@@ -23,5 +23,16 @@ TTS_CASE_TPL("Benchmark complex kummer", float, double)
     TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide", kyosu::kummer, rnd_kyosu, rnd_kyosu, rnd_kyosu);
   }
 
+  {
+    // fixed parameters
+    auto f = [](auto z) { return kyosu::kummer(z, T(1.5), T(2.25)); };
+    auto p = kyosu::prepare(kyosu::kummer, T(1.5), T(2.25));
+    kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> kummer(z, 1.5, 2.25)");
+    TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar ", f, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide", f, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar prepared", p, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide prepared", p, rnd_kyosu);
+  }
+
   TTS_PASS("Benchmarks - SUCCESS");
 };
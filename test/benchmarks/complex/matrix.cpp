@@ -0,0 +1,50 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+
+#include <benchmark.hpp>
+#include <kyosu/kyosu.hpp>
+
+TTS_CASE_TPL("Benchmark 4x4 complex matrices", float, double)
+<typename T>(tts::type<T>)
+{
+  using type = kyosu::complex_t<T>;
+
+  auto rnd_kyosu = [&]() { return type{::tts::random_value<T>(-10, 10), ::tts::random_value<T>(-10, 10)}; };
+  // 4 x 4 matrix built from one value, plus a right hand side
+  auto system = [](auto z) {
+    using z_t = decltype(z);
+    kyosu::matrix<z_t, 4> a;
+    for (std::size_t i = 0; i < 4; ++i)
+      for (std::size_t j = 0; j < 4; ++j) a(i, j) = z * z_t(i + 1) - z_t(j) + (i == j ? z_t(8) : z_t(0));
+    return kumi::tuple{a, std::array<z_t, 4>{z, z_t(1), -z, z_t(2)}};
+  };
+  auto lu = [&](auto z) {
+    auto [a, b] = system(z);
+    return kyosu::lu_solve(a, b)[0];
+  };
+  auto qr = [&](auto z) {
+    auto [a, b] = system(z);
+    return kyosu::qr_solve(a, b)[0];
+  };
+  auto det = [&](auto z) { return kyosu::det(kumi::get<0>(system(z))); };
+  auto inv = [&](auto z) { return kyosu::inverse(kumi::get<0>(system(z)))(0, 0); };
+
+  {
+    kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> 4x4 matrices");
+    TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::lu_solve scalar", lu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::lu_solve wide", lu, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::qr_solve scalar", qr, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::qr_solve wide", qr, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::det scalar", det, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::det wide", det, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::inverse scalar", inv, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::inverse wide", inv, rnd_kyosu);
+  }
+
+  TTS_PASS("Benchmarks - SUCCESS");
+};
@@ -0,0 +1,89 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+
+#include <benchmark.hpp>
+#include <kyosu/kyosu.hpp>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+  // O(n^2) left quaternion DFT along the axis i
+  template<typename T>
+  void naive_qdft(std::vector<kyosu::quaternion_t<T>> const& x, std::vector<kyosu::quaternion_t<T>>& y)
+  {
+    auto n = x.size();
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      kyosu::quaternion_t<T> s(0);
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        auto t = T(-2 * std::numbers::pi * double((j * k) % n) / double(n));
+        s += kyosu::quaternion_t<T>(eve::cos(t), eve::sin(t)) * x[j];
+      }
+      y[k] = s;
+    }
+  }
+}
+
+TTS_CASE_TPL("Benchmark quaternion FFT", float, double)
+<typename T>(tts::type<T>)
+{
+  using q_t = kyosu::quaternion_t<T>;
+  auto zero = []() { return T(0); };
+  auto rand = []() { return ::tts::random_value<T>(-1, 1); };
+
+  {
+    std::size_t const n = 256;
+    std::vector<q_t> x(n), y(n);
+    kyosu::soa_buffer<T, 4> in(n), out(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      x[i] = q_t(rand(), rand(), rand(), rand());
+      in.set(i, x[i]);
+    }
+    kyosu::qft_plan<T> left(kyosu::qft_side::left, n);
+    kyosu::qft_plan<T> lum(kyosu::qft_side::right, n, q_t(0, 1, 1, 1));
+
+    auto dft = [&](auto) {
+      naive_qdft(x, y);
+      return kyosu::real(y[1]);
+    };
+    auto fwd = [&](auto) {
+      left.forward(in.view(), out.view());
+      return out.view().planes[0][1];
+    };
+    auto axis = [&](auto) {
+      lum.forward(in.view(), out.view());
+      return out.view().planes[0][1];
+    };
+
+    tts::text title{"quaternion<%s> FFT of size %d", tts::as_text(tts::typename_<T>).data(), int(n)};
+    kyosu::bench::benchmark _(title, 200);
+    TTS_RUN_BENCHMARK_TPL(_, T, "naive quaternion DFT", dft, zero);
+    TTS_RUN_BENCHMARK_TPL(_, T, "kyosu::qft_plan left, axis i", fwd, zero);
+    TTS_RUN_BENCHMARK_TPL(_, T, "kyosu::qft_plan right, axis (i+j+k)/sqrt(3)", axis, zero);
+  }
+
+  {
+    std::size_t const rows = 64, cols = 64;
+    kyosu::soa_buffer<T, 4> img(rows * cols);
+    for (std::size_t i = 0; i < rows * cols; ++i) img.set(i, q_t(0, rand(), rand(), rand()));
+    kyosu::qft_plan<T> plan(kyosu::qft_side::two_sided, rows, cols);
+
+    auto two = [&](auto) {
+      plan.forward(img.view());
+      return img.view().planes[0][1];
+    };
+
+    kyosu::bench::benchmark _("quaternion<" + tts::as_text(tts::typename_<T>) + "> image FFT", 200);
+    TTS_RUN_BENCHMARK_TPL(_, T, "two sided QFT of a 64 x 64 image", two, zero);
+  }
+
+  TTS_PASS("Benchmarks - SUCCESS");
+};
@@ -0,0 +1,45 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+
+#include <benchmark.hpp>
+#include <kyosu/kyosu.hpp>
+
+TTS_CASE_TPL("Benchmark complex polynomial roots", float, double)
+<typename T>(tts::type<T>)
+{
+  using type = kyosu::complex_t<T>;
+
+  auto rnd_kyosu = [&]() { return type{::tts::random_value<T>(-10, 10), ::tts::random_value<T>(-10, 10)}; };
+  auto degree8 = [](auto a) {
+    using z_t = decltype(a);
+    auto c = kyosu::coefficients{z_t(1), a, z_t(2), a * a, z_t(-1), a, z_t(3), -a, z_t(0.5)};
+    return kumi::get<0>(kyosu::roots(c))[0];
+  };
+
+  {
+    kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> roots of degree 8");
+    TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar ", degree8, rnd_kyosu);
+    TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide", degree8, rnd_kyosu);
+  }
+
+  {
+    std::size_t const n = 16, count = 4096;
+    kyosu::soa_buffer<T, 2> coefs((n + 1) * count), zs(n * count);
+    for (std::size_t i = 0; i < (n + 1) * count; ++i) coefs.set(i, rnd_kyosu());
+    auto zero = []() { return T(0); };
+    auto batch = [&](auto) {
+      kyosu::bulk::roots(n, coefs, zs);
+      return zs.view().planes[0][1];
+    };
+
+    kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> batched roots", 20);
+    TTS_RUN_BENCHMARK_TPL(_, T, "kyosu::bulk::roots, 4096 polynomials of degree 16", batch, zero);
+  }
+
+  TTS_PASS("Benchmarks - SUCCESS");
+};
@@ -0,0 +1,29 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+
+#include <benchmark.hpp>
+#include <kyosu/kyosu.hpp>
+
+TTS_CASE_TPL("Benchmark tabulated faddeeva against faddeeva", float, double)
+<typename T>(tts::type<T>)
+{
+  using type = kyosu::complex_t<T>;
+
+  auto rnd_kyosu = [&]() { return type{::tts::random_value<T>(-4, 4), ::tts::random_value<T>(-1, 3)}; };
+  auto t = kyosu::tabulate(kyosu::faddeeva, type(-4, -1), type(4, 3), 100 * eve::eps(eve::as<T>()));
+  auto w = [](auto z) { return kyosu::faddeeva(z); };
+  auto tw = [&t](auto z) { return t(z); };
+
+  kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> faddeeva over [-4, 4] x [-1, 3]");
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar faddeeva(z)", w, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide faddeeva(z)", w, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, type, "kyosu::scalar tabulated faddeeva(z)", tw, rnd_kyosu);
+  TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide tabulated faddeeva(z)", tw, rnd_kyosu);
+
+  TTS_PASS("Benchmarks - SUCCESS");
+};
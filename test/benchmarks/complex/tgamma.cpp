@@ -9,6 +9,7 @@
 #include <benchmark.hpp>
 #include <kyosu/kyosu.hpp>
 #include <complex>
+#include <vector>
 
 TTS_CASE_TPL("Benchmark complex tgamma", float, double)
 <typename T>(tts::type<T>)
@@ -23,5 +24,19 @@ TTS_CASE_TPL("Benchmark complex tgamma", float, double)
     TTS_RUN_BENCHMARK_TPL(_, eve::wide<type>, "kyosu::wide", kyosu::tgamma, rnd_kyosu);
   }
 
+  {
+    std::size_t const n = 65536;
+    std::vector<type> in(n), out(n);
+    for (auto& z : in) z = rnd_kyosu();
+    auto zero = []() { return T(0); };
+    auto batch = [&](auto) {
+      kyosu::bulk::tgamma(in, out);
+      return kyosu::real(out[1]);
+    };
+
+    kyosu::bench::benchmark _("complex<" + tts::as_text(tts::typename_<T>) + "> batched tgamma", 20);
+    TTS_RUN_BENCHMARK_TPL(_, T, "kyosu::bulk::tgamma, 65536 values", batch, zero);
+  }
+
   TTS_PASS("Benchmarks - SUCCESS");
 };
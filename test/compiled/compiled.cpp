@@ -0,0 +1,35 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/compiled.hpp>
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+
+TTS_CASE_TPL("Check kyosu::compiled instantiations", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  using q_t = kyosu::quaternion_t<T>;
+  using r_t = eve::wide<T>;
+
+  auto z = c_t(T(0.75), T(-1.25));
+  auto q = q_t(T(0.5), T(-0.25), T(1), T(0.75));
+  auto wz = kyosu::complex(r_t([](auto i, auto) { return T(0.25) * T(i + 1); }), r_t(T(-0.5)));
+
+  TTS_RELATIVE_EQUAL(kyosu::compiled::exp(z), kyosu::exp(z), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::compiled::tgamma(z), kyosu::tgamma(z), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::compiled::digamma(z), kyosu::digamma(z), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::compiled::atan(q), kyosu::atan(q), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::compiled::sqrt(q), kyosu::sqrt(q), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::compiled::erf(wz), kyosu::erf(wz), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::compiled::log(wz), kyosu::log(wz), tts::prec<T>());
+
+  auto ab = kumi::tuple{c_t(T(0.5)), c_t(T(1.25))};
+  auto c = kumi::tuple{c_t(T(2.5))};
+  TTS_RELATIVE_EQUAL(kyosu::compiled::hypergeometric(z, ab, c), kyosu::hypergeometric(z, ab, c), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::compiled::hypergeometric(wz, ab, c), kyosu::hypergeometric(wz, ab, c), tts::prec<T>());
+};
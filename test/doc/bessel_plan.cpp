@@ -0,0 +1,26 @@
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+#include <vector>
+
+int main()
+{
+  using c_t = kyosu::complex_t<double>;
+
+  // order 2.5 evaluated at many points
+  kyosu::bessel_plan<double> p(2.5);
+  std::cout << "p.j(1+2i)            = " << p.j(c_t(1, 2)) << std::endl;
+  std::cout << "bessel_j(2.5, 1+2i)  = " << kyosu::bessel_j(2.5, c_t(1, 2)) << std::endl;
+  std::cout << "p.k(1+2i)            = " << p.k(c_t(1, 2)) << std::endl;
+  std::cout << "bessel_k(2.5, 1+2i)  = " << kyosu::bessel_k(2.5, c_t(1, 2)) << std::endl;
+
+  std::vector<double> rs{0.5, 1.0, 5.0, 40.0};
+  std::vector<c_t> ys(rs.size());
+  p.y(std::span(rs), std::span(ys));
+  for (std::size_t i = 0; i < rs.size(); ++i) std::cout << "p.y(" << rs[i] << ") = " << ys[i] << std::endl;
+
+  kyosu::bessel_plan<float> q(-1.25f);
+  eve::wide<float, eve::fixed<4>> x{0.5f, 1.0f, 2.0f, 30.0f};
+  std::cout << "q.i(x)               = " << q.i(x) << std::endl;
+  std::cout << "q.h1(x)              = " << q.h1(x) << std::endl;
+  return 0;
+}
@@ -0,0 +1,19 @@
+#include <eve/wide.hpp>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+#include <vector>
+
+int main()
+{
+  std::vector<kyosu::complex_t<float>> zs{{1.0f, 2.0f}, {-0.5f, 0.25f}, {3.0f, -1.0f}, {0.0f, 1.5f}, {2.0f, 2.0f}};
+
+  // complex values stored as two planes of binary16 numbers
+  kyosu::soa_buffer<kyosu::float16, 2> h(zs.size()), eh(zs.size());
+  kyosu::bulk::copy(zs, h);
+  kyosu::bulk::transform(h, eh, [](auto z) { return kyosu::exp(z); });
+
+  std::vector<kyosu::complex_t<float>> rs(zs.size());
+  kyosu::bulk::copy(eh, rs);
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    std::cout << "exp(" << h[i] << ") = " << rs[i] << " (float: " << kyosu::exp(zs[i]) << ")" << std::endl;
+};
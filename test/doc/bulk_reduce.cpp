@@ -0,0 +1,18 @@
+#include <eve/wide.hpp>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+#include <vector>
+
+int main()
+{
+  std::vector<kyosu::complex_t<double>> zs(10000);
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = kyosu::exp_i(0.001 * i) / double(i + 1);
+
+  std::cout << "sum(zs)                  " << kyosu::bulk::sum(zs) << std::endl;
+  std::cout << "sum[reproducible](zs, 4) " << kyosu::bulk::sum[kyosu::reproducible](zs, 4) << std::endl;
+  std::cout << "dot(zs, zs)              " << kyosu::bulk::dot(zs, zs) << std::endl;
+  std::cout << "sum_sqr_abs(zs)          " << kyosu::bulk::sum_sqr_abs(zs) << std::endl;
+  std::cout << "lpnorm(3.0, zs)            " << kyosu::bulk::lpnorm(3, zs) << std::endl;
+  std::cout << "linfnorm(zs)             " << kyosu::bulk::linfnorm(zs) << std::endl;
+  std::cout << "maxabs[flat](zs)         " << kyosu::bulk::maxabs[kyosu::flat](zs) << std::endl;
+};
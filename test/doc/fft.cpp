@@ -0,0 +1,24 @@
+#include <eve/wide.hpp>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+#include <vector>
+
+int main()
+{
+  std::size_t const n = 12;
+  kyosu::soa_buffer<double, 2> x(n), X(n);
+  for (std::size_t i = 0; i < n; ++i) x.set(i, kyosu::exp_i(2 * 3.141592653589793 * 3 * i / n));
+
+  kyosu::fft_plan<double> plan(n);
+  plan.forward(x.view(), X.view());
+  for (std::size_t k = 0; k < n; ++k) std::cout << "X[" << k << "] = " << X[k] << std::endl;
+
+  plan.inverse(X.view());
+  std::cout << "x[1] = " << x[1] << ", inverse(X)[1] = " << X[1] << std::endl;
+
+  std::vector<double> r{1, 2, 3, 4, 3, 2, 1, 0};
+  kyosu::real_fft_plan<double> rplan(r.size());
+  kyosu::soa_buffer<double, 2> R(rplan.spectrum_size());
+  rplan.forward(r, R.view());
+  for (std::size_t k = 0; k < R.size(); ++k) std::cout << "R[" << k << "] = " << R[k] << std::endl;
+}
@@ -24,4 +24,6 @@ int main()
   std::cout << "-> gegenbauer(3.0, 2.0, xd)                  = " << kyosu::gegenbauer(3.0, 2.0, xd) << '\n';
   std::cout << "-> gegenbauer(n, l, 2.0)                     = " << kyosu::gegenbauer(n, l, 2.0) << '\n';
   std::cout << "-> gegenbauer(n, l, x)                       = " << kyosu::gegenbauer(n, l, x) << '\n';
+  kyosu::coefficients c{kyosu::complex(1.0, 2.0), 0.5, kyosu::complex(-1.0, 0.25)};
+  std::cout << "-> gegenbauer(2.0, xd, c)                    = " << kyosu::gegenbauer(2.0, xd, c) << '\n';
 }
@@ -26,4 +26,14 @@ int main()
   auto o3 = kyosu::cayley_dickson(a[12], a[13], a[14], a[15], a[4], a[5], a[6], a[7]);
   std::cout << "horner(x, o1, c2, a[2]) " << kyosu::horner(x, o1, c2, a[2]) << std::endl;
   std::cout << "horner(x, o1, o2, o3) " << kyosu::horner(x, o1, o2, o3) << std::endl;
+  std::cout << "horner[estrin](x1, c1, c2, c3, c1) " << kyosu::horner[kyosu::estrin](x1, c1, c2, c3, c1) << std::endl;
+  std::cout << "horner[second_order](x1, c1, c2, c3, c1) " << kyosu::horner[kyosu::second_order](x1, c1, c2, c3, c1)
+            << std::endl;
+
+  std::array<kyosu::complex_t<double>, 4> xs{x1, c1, c2, c3};
+  std::array<kyosu::complex_t<double>, 4> rs;
+  kyosu::horner(std::span(xs), kyosu::coefficients{c1, c2, c3}, std::span(rs));
+  std::cout << "horner(xs, {c1, c2, c3}) ";
+  for (auto r : rs) std::cout << r << "  ";
+  std::cout << std::endl;
 };
@@ -0,0 +1,26 @@
+// revision 1
+#include <eve/wide.hpp>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+
+int main()
+{
+  eve::wide xd{0.5, -1.5, 0.1, -1.0, 19.0, 25.0, 21.5, 10000.0};
+  eve::wide n{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+  double x(0.5);
+  kyosu::coefficients c{kyosu::complex(1.0, 2.0), 0.5, kyosu::complex(-1.0, 0.25)};
+
+  std::cout << "<- xd                                         = " << xd << '\n';
+  std::cout << "<- n                                          = " << n << '\n';
+  std::cout << "<- x                                          = " << x << '\n';
+  auto ln = kyosu::laguerre(n, x);
+  auto lnp1 = kyosu::laguerre(n + 1, x);
+  auto lnp2 = kyosu::laguerre(n + 2, x);
+  std::cout << "-> laguerre(n, x)                             = " << ln << '\n';
+  std::cout << "-> laguerre(n+1, x)                           = " << lnp1 << '\n';
+  std::cout << "-> laguerre(n+2, x)                           = " << lnp2 << '\n';
+  std::cout << "-> laguerre[eve::successor](n+1, x, lnp1, ln) = " << kyosu::laguerre(n + 1, x, lnp1, ln) << '\n';
+  std::cout << "-> laguerre[n > 3](n, xd)                     = " << kyosu::laguerre[n > 3](n, xd) << '\n';
+  std::cout << "-> laguerre(3.0, xd)                          = " << kyosu::laguerre(3.0, xd) << '\n';
+  std::cout << "-> laguerre(xd, c)                            = " << kyosu::laguerre(xd, c) << '\n';
+}
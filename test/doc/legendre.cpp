@@ -1,4 +1,5 @@
 // revision 1
+#include <array>
 #include <eve/wide.hpp>
 #include <iostream>
 #include <kyosu/kyosu.hpp>
@@ -25,4 +26,11 @@ int main()
   std::cout << "-> legendre(3.0, xd)                          = " << kyosu::legendre(3.0, xd) << '\n';
   std::cout << "-> legendre(n, 2.0)                           = " << kyosu::legendre(n, 2.0) << '\n';
   std::cout << "-> legendre(n, x)                             = " << kyosu::legendre(n, x) << '\n';
+  kyosu::coefficients c{kyosu::complex(1.0, 2.0), 0.5, kyosu::complex(-1.0, 0.25)};
+  std::cout << "-> legendre(xd, c)                            = " << kyosu::legendre(xd, c) << '\n';
+  std::array<kyosu::complex_t<double>, 6> ps;
+  kyosu::legendre(kyosu::complex(0.5, 0.25), std::span(ps));
+  std::cout << "-> legendre(complex(0.5, 0.25), ps)          : ";
+  for (auto p : ps) std::cout << p << ' ';
+  std::cout << '\n';
 }
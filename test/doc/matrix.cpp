@@ -0,0 +1,27 @@
+#include <eve/wide.hpp>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+
+int main()
+{
+  using c_t = kyosu::complex_t<double>;
+  kyosu::matrix<c_t, 2> a{{{{c_t(1, 1), c_t(2)}, {c_t(0, -1), c_t(3, 2)}}}};
+  std::array<c_t, 2> b{c_t(1), c_t(0, 1)};
+
+  std::cout << "det(a)          = " << kyosu::det(a) << std::endl;
+  auto x = kyosu::lu_solve(a, b);
+  std::cout << "lu_solve(a, b)  = " << x[0] << ", " << x[1] << std::endl;
+  x = kyosu::qr_solve(a, b);
+  std::cout << "qr_solve(a, b)  = " << x[0] << ", " << x[1] << std::endl;
+  auto i = kyosu::inverse(a) * a;
+  std::cout << "inverse(a) * a  = " << i(0, 0) << ", " << i(0, 1) << ", " << i(1, 0) << ", " << i(1, 1) << std::endl;
+
+  // four independent 2 x 2 systems, one per lane
+  using r_t = eve::wide<double, eve::fixed<4>>;
+  using w_t = kyosu::complex_t<r_t>;
+  kyosu::matrix<w_t, 2> m{{{{kyosu::complex(r_t{1, 0, 2, 1}, r_t(0)), w_t(c_t(1))},
+                            {w_t(c_t(1)), kyosu::complex(r_t{0, 1, 2, -1}, r_t{1, 0, 0, 1})}}}};
+  std::array<w_t, 2> y{w_t(c_t(1)), w_t(c_t(0, 1))};
+  std::cout << "det(m)          = " << kyosu::det(m) << std::endl;
+  std::cout << "lu_solve(m, y)  = " << kyosu::lu_solve(m, y)[0] << std::endl;
+}
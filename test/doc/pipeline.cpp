@@ -0,0 +1,33 @@
+#include <eve/wide.hpp>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+#include <vector>
+
+int main()
+{
+  std::vector<kyosu::complex_t<double>> zs{{0.5, 1.0}, {1.5, -0.5}, {-0.25, 2.0}, {2.0, 0.0}, {3.0, 1.5}};
+  std::vector<kyosu::complex_t<double>> rs(zs.size());
+  std::vector<double> ws{0.5, 1.0, 1.5, 2.0, 2.5};
+
+  // exp(-z²) in one pass, without the arrays of z² and -z²
+  kyosu::bulk::pipeline gauss{kyosu::sqr, kyosu::minus, kyosu::exp};
+  gauss(zs, rs);
+  std::cout << "---- exp(-z²)" << std::endl;
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    std::cout << "-> " << zs[i] << " : " << rs[i] << " (" << gauss(zs[i]) << ")" << std::endl;
+
+  // exp(-z²) erfcx(w) / Γ(z): several inputs, computed on two threads
+  auto f = [](auto z, auto w) { return kyosu::exp(-kyosu::sqr(z)) * kyosu::erfcx(w) / kyosu::tgamma(z); };
+  kyosu::bulk::pipeline p{f};
+  p(kyosu::bulk::zip(zs, ws), rs, 2);
+  std::cout << "---- exp(-z²) erfcx(w) / tgamma(z)" << std::endl;
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    std::cout << "-> " << zs[i] << ", " << ws[i] << " : " << rs[i] << " (" << f(zs[i], ws[i]) << ")" << std::endl;
+
+  // 1 / Γ(z): a stage applied to whole chunks of the range, here the batched tgamma
+  kyosu::bulk::pipeline rgamma{kyosu::bulk::ranged(kyosu::bulk::tgamma), kyosu::rec};
+  rgamma(zs, rs);
+  std::cout << "---- 1 / tgamma(z)" << std::endl;
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    std::cout << "-> " << zs[i] << " : " << rs[i] << " (" << kyosu::rec(kyosu::tgamma(zs[i])) << ")" << std::endl;
+}
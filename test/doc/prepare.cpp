@@ -0,0 +1,25 @@
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+#include <vector>
+
+int main()
+{
+  using c_t = kyosu::complex_t<double>;
+
+  // 2F1(0.5, 1.25; 2.5; z) evaluated at many points
+  auto f = kyosu::prepare(kyosu::hypergeometric, kumi::tuple{0.5, 1.25}, kumi::tuple{2.5});
+  std::cout << "f(0.25+0.1i)                = " << f(c_t(0.25, 0.1)) << std::endl;
+  std::cout << "hypergeometric(0.25+0.1i, ) = "
+            << kyosu::hypergeometric(c_t(0.25, 0.1), kumi::tuple{0.5, 1.25}, kumi::tuple{2.5}) << std::endl;
+
+  std::vector<c_t> zs{c_t(0.5, 0.5), c_t(-2, 1), c_t(3, 0)}, rs(3);
+  f(std::span(zs), std::span(rs));
+  for (std::size_t i = 0; i < zs.size(); ++i) std::cout << "f(" << zs[i] << ") = " << rs[i] << std::endl;
+
+  auto m = kyosu::prepare(kyosu::kummer, 1.5, 2.25);
+  auto u = kyosu::prepare(kyosu::tricomi, 1.5, 2.25);
+  eve::wide<double, eve::fixed<4>> x{0.5, 1.0, 2.0, 4.0};
+  std::cout << "kummer(x, 1.5, 2.25)        = " << m(x) << std::endl;
+  std::cout << "tricomi(x, 1.5, 2.25)       = " << u(x) << std::endl;
+  return 0;
+}
@@ -0,0 +1,30 @@
+#include <eve/wide.hpp>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+
+int main()
+{
+  using q_t = kyosu::quaternion_t<double>;
+  std::size_t const n = 8;
+  kyosu::soa_buffer<double, 4> x(n), X(n);
+  for (std::size_t i = 0; i < n; ++i) x.set(i, q_t(1.0 * i, 0.5, -1.0 * (i % 3), 0.25 * i));
+
+  // luminance axis of RGB color signals
+  q_t mu(0, 1, 1, 1);
+  for (auto side : {kyosu::qft_side::left, kyosu::qft_side::right})
+  {
+    kyosu::qft_plan<double> plan(side, n, mu);
+    plan.forward(x.view(), X.view());
+    std::cout << (side == kyosu::qft_side::left ? "left" : "right") << " transform:" << std::endl;
+    for (std::size_t k = 0; k < n; ++k) std::cout << "  X[" << k << "] = " << X[k] << std::endl;
+    plan.inverse(X.view());
+    std::cout << "  x[3] = " << x[3] << ", inverse(X)[3] = " << X[3] << std::endl;
+  }
+
+  // two sided transform of a 4 x 4 image
+  kyosu::soa_buffer<double, 4> img(16);
+  for (std::size_t i = 0; i < 16; ++i) img.set(i, q_t(0, (i % 4) / 4.0, (i / 4) / 4.0, 0.5));
+  kyosu::qft_plan<double> plan2(kyosu::qft_side::two_sided, 4, 4);
+  plan2.forward(img.view());
+  std::cout << "two sided F[0] = " << img[0] << ", F[5] = " << img[5] << std::endl;
+}
@@ -0,0 +1,28 @@
+#include <eve/wide.hpp>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+
+int main()
+{
+  using c_t = kyosu::complex_t<double>;
+
+  // (z - 1)(z + 2)(z - i)(z + i) = z^4 + z^3 - z^2 + z - 2
+  auto [zs, ok] = kyosu::roots(kyosu::coefficients{1.0, 1.0, -1.0, 1.0, -2.0});
+  std::cout << "converged: " << ok << std::endl;
+  for (auto z : zs) std::cout << "  " << z << std::endl;
+
+  // one polynomial z^2 - c per lane
+  using r_t = eve::wide<double, eve::fixed<4>>;
+  auto c = kyosu::complex(r_t{0, 1, 2, 3}, r_t(1));
+  auto [ws, wok] = kyosu::roots(kyosu::coefficients{r_t(1), r_t(0), -c});
+  std::cout << "sqrt(" << c << ") = " << ws[0] << ", " << ws[1] << " " << wok << std::endl;
+
+  // batch of 3 polynomials of degree 2 stored column by column
+  kyosu::soa_buffer<double, 2> coefs(3 * 3), rs(2 * 3);
+  double a[3][3] = {{1, 1, 1}, {-3, 0, 2}, {2, 4, 5}};
+  for (std::size_t i = 0; i < 3; ++i)
+    for (std::size_t p = 0; p < 3; ++p) coefs.set(i * 3 + p, c_t(a[i][p]));
+  auto failed = kyosu::bulk::roots(2, coefs, rs);
+  std::cout << "failed: " << failed << std::endl;
+  for (std::size_t p = 0; p < 3; ++p) std::cout << "  " << rs[p] << ", " << rs[3 + p] << std::endl;
+}
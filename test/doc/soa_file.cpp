@@ -0,0 +1,41 @@
+#include <filesystem>
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+#include <kyosu/soa_file.hpp>
+#include <vector>
+
+int main()
+{
+  using c_t = kyosu::complex_t<double>;
+  auto dir = std::filesystem::temp_directory_path();
+  auto in = (dir / "kyosu_doc_in.soa").string();
+  auto out = (dir / "kyosu_doc_out.soa").string();
+
+  // streaming writer: the values are appended in order, in as many calls as needed
+  {
+    kyosu::soa_writer<double, 2> w(in.c_str(), 1000);
+    std::vector<c_t> block(250);
+    for (int b = 0; b < 4; ++b)
+    {
+      for (int i = 0; i < 250; ++i) block[i] = c_t(0.001 * (250 * b + i), 1.0);
+      w.write(std::span(block));
+    }
+    std::cout << "written             = " << w.close() << std::endl;
+  }
+
+  // the input mapped read only, the output created and mapped read and write
+  auto zs = kyosu::mapped_soa<double const, 2>::open(in.c_str());
+  auto rs = kyosu::mapped_soa<double, 2>::create(out.c_str(), zs->size());
+  kyosu::bulk::transform(*zs, *rs, [](auto z) { return kyosu::exp(z); });
+  std::cout << "size                = " << rs->size() << std::endl;
+  std::cout << "exp((*zs)[500])     = " << kyosu::exp((*zs)[500]) << std::endl;
+  std::cout << "(*rs)[500]          = " << (*rs)[500] << std::endl;
+
+  // the type of the values is checked when mapping
+  std::cout << "as quaternions      = " << kyosu::mapped_soa<double const, 4>::open(in.c_str()).has_value()
+            << std::endl;
+
+  std::filesystem::remove(in);
+  std::filesystem::remove(out);
+  return 0;
+}
@@ -0,0 +1,29 @@
+#include <iostream>
+#include <kyosu/kyosu.hpp>
+#include <sstream>
+#include <vector>
+
+int main()
+{
+  using c_t = kyosu::complex_t<double>;
+
+  // the Faddeeva function over [-4, 4] x [-1, 3]
+  auto w = kyosu::tabulate(kyosu::faddeeva, c_t(-4, -1), c_t(4, 3), 1.0e-10);
+  std::cout << "patches             = " << w.patches() << std::endl;
+  std::cout << "error               = " << w.error() << std::endl;
+  std::cout << "w(1.5+0.5i)         = " << w(c_t(1.5, 0.5)) << std::endl;
+  std::cout << "faddeeva(1.5+0.5i)  = " << kyosu::faddeeva(c_t(1.5, 0.5)) << std::endl;
+  std::cout << "w(5+0.5i)           = " << w(c_t(5, 0.5)) << std::endl;
+
+  std::vector<double> xs{-3.5, -1.0, 0.0, 2.25};
+  std::vector<c_t> rs(xs.size());
+  w(std::span(xs), std::span(rs));
+  for (std::size_t i = 0; i < xs.size(); ++i) std::cout << "w(" << xs[i] << ") = " << rs[i] << std::endl;
+
+  // a table can be saved and reloaded instead of being recomputed
+  std::stringstream ss;
+  w.save(ss);
+  auto v = kyosu::tabulated_function<double>::load(ss);
+  std::cout << "reloaded v(1.5+0.5i) = " << (*v)(c_t(1.5, 0.5)) << std::endl;
+  return 0;
+}
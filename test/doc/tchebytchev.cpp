@@ -22,4 +22,6 @@ int main()
   std::cout << "-> tchebytchev(n, 2.0)                     = " << kyosu::tchebytchev(n, 2.0) << '\n';
   std::cout << "-> tchebytchev(n, x)                       = " << kyosu::tchebytchev(n, x) << '\n';
   std::cout << "-> tchebytchev[kind_2](n, xd)              = " << kyosu::tchebytchev[eve::kind_2](n, xd) << "\n\n";
+  kyosu::coefficients c{kyosu::complex(1.0, 2.0), 0.5, kyosu::complex(-1.0, 0.25)};
+  std::cout << "-> tchebytchev(xd, c)                      = " << kyosu::tchebytchev(xd, c) << '\n';
 }
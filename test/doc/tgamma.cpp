@@ -1,6 +1,7 @@
 #include <eve/wide.hpp>
 #include <iostream>
 #include <kyosu/kyosu.hpp>
+#include <vector>
 
 int main()
 {
@@ -16,4 +17,10 @@ int main()
             << "-> tgamma(zc)                  = " << kyosu::tgamma(zc) << std::endl
             << "-> tgamma(ref2)                = " << kyosu::tgamma(ref2) << std::endl
             << "-> Γ(ref2)                 = " << kyosu::Γ(ref2) << std::endl;
+
+  // batch mode: reflected (negative real part) and direct values are computed separately
+  std::vector<kyosu::complex_t<double>> zs{{3.0, 2.0}, {-2.5, 1.0}, {0.5, -4.0}, {-0.5, 20.0}, {25.0, 1.0}}, gs(5);
+  kyosu::bulk::tgamma(zs, gs);
+  std::cout << "---- bulk" << std::endl;
+  for (std::size_t i = 0; i < zs.size(); ++i) std::cout << "-> tgamma(" << zs[i] << ") = " << gs[i] << std::endl;
 }
@@ -0,0 +1,75 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <kyosu/instrument.hpp>
+#include <sstream>
+#include <string>
+#include <test.hpp>
+#include <thread>
+
+#if !defined(KYOSU_INSTRUMENT)
+#error "the instrumentation tests are compiled with KYOSU_INSTRUMENT"
+#endif
+
+namespace
+{
+  std::string counters()
+  {
+    std::ostringstream os;
+    kyosu::instrument::dump(os);
+    return os.str();
+  }
+
+  bool holds(std::string const& s, std::string const& what) { return s.find(what) != std::string::npos; }
+}
+
+TTS_CASE_TPL("Check kyosu::instrument branch counters", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  using r_t = eve::wide<T>;
+  kyosu::instrument::reset();
+  TTS_EXPECT(!holds(counters(), "faddeeva"));
+
+  // one scalar evaluation by continued fraction
+  [[maybe_unused]] auto w = kyosu::faddeeva(c_t(10, 1));
+  auto s = counters();
+  TTS_EXPECT(holds(s, "\"function\": \"faddeeva\", \"name\": \"real axis\", \"evaluations\": 1, \"hits\": 0"));
+  TTS_EXPECT(holds(s, "\"name\": \"continued fraction\", \"evaluations\": 1, \"hits\": 1, \"lanes\": 1, \"width\": 1"));
+
+  // lanes on the real axis, the others by continued fraction
+  auto z = kyosu::complex(r_t([](auto i, auto) { return T(10 + i); }),
+                          r_t([](auto i, auto) { return T(i % 2); }));
+  [[maybe_unused]] auto wz = kyosu::faddeeva(z);
+  constexpr auto n = r_t::size();
+  s = counters();
+  auto lanes = std::to_string(n / 2) + ", \"width\": " + std::to_string(n);
+  TTS_EXPECT(holds(s, "\"name\": \"real axis\", \"evaluations\": 2, \"hits\": 1, \"lanes\": " + lanes));
+  TTS_EXPECT(holds(s, "\"name\": \"continued fraction\", \"evaluations\": 2, \"hits\": 2, \"lanes\": " +
+                          std::to_string(1 + n / 2) + ", \"width\": " + std::to_string(1 + n)));
+
+  kyosu::instrument::reset();
+  TTS_EXPECT(!holds(counters(), "faddeeva"));
+};
+
+TTS_CASE_TPL("Check kyosu::instrument loop counters across threads", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  kyosu::instrument::reset();
+
+  auto rf = [] { return kyosu::ellint_rf(c_t(1, 2), c_t(2, -1), c_t(3, 0.5)); };
+  auto r = rf();
+  std::thread([&] { TTS_EQUAL(rf(), r); }).join();
+
+  // the counters of the exited thread are added to those of this one
+  auto s = counters();
+  TTS_EXPECT(holds(s, "\"function\": \"ellint_rf\", \"name\": \"duplication\", \"runs\": 2"));
+  TTS_EXPECT(holds(s, "\"loops\": ["));
+  kyosu::instrument::reset();
+};
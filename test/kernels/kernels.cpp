@@ -0,0 +1,48 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kernels.hpp>
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <string>
+#include <vector>
+
+TTS_CASE("Check kyosu::kernels dispatcher")
+{
+  using kyosu::kernels::isa;
+  TTS_EXPECT(kyosu::kernels::select(isa::generic));
+  TTS_EQUAL(kyosu::kernels::current(), isa::generic);
+  TTS_EXPECT(kyosu::kernels::select(kyosu::kernels::best()));
+  TTS_EQUAL(kyosu::kernels::current(), kyosu::kernels::best());
+  TTS_EQUAL(std::string(kyosu::kernels::name(isa::avx2)), std::string("avx2"));
+};
+
+TTS_CASE_TPL("Check kyosu::kernels on every supported instruction set", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  using kyosu::kernels::isa;
+
+  // not a multiple of any SIMD cardinal, so that the scalar tails are exercised
+  std::vector<c_t> zs(103), rs(zs.size());
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = c_t(T(-3) + T(0.061) * T(i), T(2) - T(0.037) * T(i));
+
+  for (auto i : {isa::generic, isa::sse4, isa::avx2, isa::avx512})
+  {
+    if (!kyosu::kernels::select(i)) continue;
+    kyosu::kernels::exp(zs, rs);
+    for (std::size_t k = 0; k < zs.size(); ++k)
+      TTS_RELATIVE_EQUAL(rs[k], kyosu::exp(zs[k]), tts::prec<T>()) << kyosu::kernels::name(i) << '\n';
+    kyosu::kernels::tgamma(zs, rs);
+    for (std::size_t k = 0; k < zs.size(); ++k)
+      TTS_RELATIVE_EQUAL(rs[k], kyosu::tgamma(zs[k]), tts::prec<T>()) << kyosu::kernels::name(i) << '\n';
+    kyosu::kernels::sqrt(std::span(zs).first(5), std::span(rs));
+    for (std::size_t k = 0; k < 5; ++k)
+      TTS_RELATIVE_EQUAL(rs[k], kyosu::sqrt(zs[k]), tts::prec<T>()) << kyosu::kernels::name(i) << '\n';
+  }
+  kyosu::kernels::select(kyosu::kernels::best());
+};
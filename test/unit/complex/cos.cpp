@@ -40,6 +40,7 @@ TTS_CASE_WITH("Check behavior of cos on wide", kyosu::simd_real_types, tts::rand
   using c_t = std::complex<eve::element_type_t<e_t>>;
   ke_t e([&](auto i, auto) { return cv(std::cos(c_t(a0.get(i), a1.get(i)))); });
   TTS_RELATIVE_EQUAL(kyosu::cos(ke_t{a0, a1}), e, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::cos[kyosu::fast](ke_t{a0, a1}), e, tts::prec<T>());
 };
 
 TTS_CASE_WITH("Check behavior of cos conditional on wide",
@@ -40,4 +40,5 @@ TTS_CASE_WITH("Check behavior of cosh on wide", kyosu::simd_real_types, tts::ran
   using c_t = std::complex<eve::element_type_t<e_t>>;
   ke_t e([&](auto i, auto) { return cv(std::cosh(c_t(a0.get(i), a1.get(i)))); });
   TTS_RELATIVE_EQUAL(kyosu::cosh(ke_t{a0, a1}), e, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::cosh[kyosu::fast](ke_t{a0, a1}), e, tts::prec<T>());
 };
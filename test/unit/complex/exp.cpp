@@ -40,6 +40,7 @@ TTS_CASE_WITH("Check behavior of exp on wide", kyosu::simd_real_types, tts::rand
   auto std_exp = [](auto x, auto y) { return cv(std::exp(c_t(x, y))); };
   ke_t e([&](auto i, auto) { return std_exp(a0.get(i), a1.get(i)); });
   TTS_RELATIVE_EQUAL(kyosu::exp(ke_t{a0, a1}), e, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::exp[kyosu::fast](ke_t{a0, a1}), e, tts::prec<T>());
 };
 
 TTS_CASE_TPL("Check corner cases of exp", kyosu::scalar_real_types)
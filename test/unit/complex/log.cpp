@@ -40,6 +40,7 @@ TTS_CASE_WITH("Check behavior of log on wide", kyosu::simd_real_types, tts::rand
   auto std_log = [](auto x, auto y) { return cv(std::log(c_t(x, y))); };
   ke_t e([&](auto i, auto) { return std_log(a0.get(i), a1.get(i)); });
   TTS_RELATIVE_EQUAL(kyosu::log(ke_t{a0, a1}), e, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::log[kyosu::fast](ke_t{a0, a1}), e, tts::prec<T>());
 };
 
 TTS_CASE_TPL("Check corner cases of log", kyosu::scalar_real_types)
@@ -40,4 +40,5 @@ TTS_CASE_WITH("Check behavior of sin on wide", kyosu::simd_real_types, tts::rand
   using c_t = std::complex<eve::element_type_t<e_t>>;
   ke_t e([&](auto i, auto) { return cv(std::sin(c_t(a0.get(i), a1.get(i)))); });
   TTS_RELATIVE_EQUAL(kyosu::sin(ke_t{a0, a1}), e, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::sin[kyosu::fast](ke_t{a0, a1}), e, tts::prec<T>());
 };
@@ -40,4 +40,5 @@ TTS_CASE_WITH("Check behavior of tanh on wide", kyosu::simd_real_types, tts::ran
   using c_t = std::complex<eve::element_type_t<e_t>>;
   ke_t e([&](auto i, auto) { return cv(std::tanh(c_t(a0.get(i), a1.get(i)))); });
   TTS_RELATIVE_EQUAL(kyosu::tanh(ke_t{a0, a1}), e, tts::prec<T>(4.0e-2, 1.0e-6));
+  TTS_RELATIVE_EQUAL(kyosu::tanh[kyosu::fast](ke_t{a0, a1}), e, tts::prec<T>(4.0e-2, 1.0e-6));
 };
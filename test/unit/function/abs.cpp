@@ -20,6 +20,7 @@ TTS_CASE_WITH("Check kyosu::abs over complex", kyosu::real_types, tts::randoms(-
   TTS_ULP_EQUAL(kyosu::abs(kyosu::complex(r, i)), eve::hypot[eve::pedantic](r, i), 0.5);
   TTS_ULP_EQUAL(kyosu::abs[kyosu::raw](kyosu::complex(r, i)), eve::hypot(r, i), 0.5);
   TTS_ULP_EQUAL(kyosu::abs[kyosu::flat](kyosu::complex(r, i)), eve::maxabs[eve::pedantic](r, i), 0.5);
+  TTS_ULP_EQUAL(kyosu::abs[kyosu::fast](kyosu::complex(r, i)), eve::hypot(r, i), 2.0);
 };
 
 TTS_CASE_WITH("Check kyosu::abs over quaternion",
@@ -35,6 +36,7 @@ TTS_CASE_WITH("Check kyosu::abs over quaternion",
   TTS_ULP_EQUAL(kyosu::abs(kyosu::quaternion(r, i, j, k)), eve::hypot[eve::pedantic](r, i, j, k), 0.5);
   TTS_ULP_EQUAL(kyosu::abs[kyosu::raw](kyosu::quaternion(r, i, j, k)), eve::hypot(r, i, j, k), 0.5);
   TTS_ULP_EQUAL(kyosu::abs[kyosu::flat](kyosu::quaternion(r, i, j, k)), eve::maxabs(r, i, j, k), 0.5);
+  TTS_ULP_EQUAL(kyosu::abs[kyosu::fast](kyosu::quaternion(r, i, j, k)), eve::hypot(r, i, j, k), 2.0);
 };
 
 TTS_CASE_WITH("Check kyosu::abs over octonion",
@@ -18,4 +18,5 @@ TTS_CASE_WITH("Check kyosu::arg over complex", kyosu::real_types, tts::randoms(-
 (auto r, auto i)
 {
   TTS_ULP_EQUAL(kyosu::arg(kyosu::complex(r, i)), eve::atan2[eve::pedantic](i, r), 0.5);
+  TTS_ULP_EQUAL(kyosu::arg[kyosu::fast](kyosu::complex(r, i)), eve::atan2[eve::pedantic](i, r), 2.0);
 };
@@ -152,3 +152,21 @@ TTS_CASE_TPL ( "Check kyosu::bessel_jr over real negative order"
     }
   }
 };
+
+TTS_CASE_TPL("Check kyosu::bessel_jr and bessel_yr for large arguments", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  std::array<T, 5> re{20, 35, 80, 250, 1000};
+  std::array<T, 5> im{0, -3, 5, 1, -2};
+  auto h = eve::half(eve::as<T>());
+  for (std::size_t j = 0; j < re.size(); ++j)
+  {
+    auto c = kyosu::complex(re[j], im[j]);
+    auto fac = kyosu::sqrt(2 * kyosu::rec(eve::pi(eve::as<T>()) * c));
+    TTS_RELATIVE_EQUAL(kyosu::bessel_j(h, c), fac * kyosu::sin(c), tts::prec<T>()) << c << '\n';
+    TTS_RELATIVE_EQUAL(kyosu::bessel_y(h, c), -fac * kyosu::cos(c), tts::prec<T>()) << c << '\n';
+    TTS_RELATIVE_EQUAL(kyosu::bessel_j(-h, c), fac * kyosu::cos(c), tts::prec<T>()) << c << '\n';
+    auto j32 = fac * (kyosu::sin(c) / c - kyosu::cos(c));
+    TTS_RELATIVE_EQUAL(kyosu::bessel_j(3 * h, c), j32, tts::prec<T>()) << c << '\n';
+  }
+};
@@ -80,3 +80,36 @@ TTS_CASE_TPL ( "Check kyosu::cyl_bessel_yn over real"
     }
   }
 };
+
+TTS_CASE_TPL("Check kyosu::bessel_yn for large arguments", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  std::array<T, 6> re{20, 35, 80, 250, 1000, -60};
+  std::array<T, 6> im{0, -3, 5, 1, -2, 4};
+  for (std::size_t j = 0; j < re.size(); ++j)
+  {
+    auto c = kyosu::complex(re[j], im[j]);
+    auto w = 2 * kyosu::rec(eve::pi(eve::as<T>()) * c);
+    for (int n = 0; n < 6; ++n)
+    {
+      auto wr = kyosu::bessel_j(n + 1, c) * kyosu::bessel_y(n, c) - kyosu::bessel_j(n, c) * kyosu::bessel_y(n + 1, c);
+      TTS_RELATIVE_EQUAL(wr, w, tts::prec<T>()) << n << " -- " << c << '\n';
+    }
+  }
+
+  // lanes on both sides of the threshold of the Hankel expansions
+  using r_t = eve::wide<T>;
+  auto z = kyosu::complex(r_t([](auto i, auto) { return i % 2 ? T(3 + i) : T(25 * (i + 1)); }),
+                          r_t([](auto i, auto) { return T(i % 3); }));
+  auto lane = [](auto w, std::size_t i) { return kyosu::complex(kyosu::real(w).get(i), kyosu::imag(w).get(i)); };
+  for (int n = 0; n < 4; ++n)
+  {
+    auto yz = kyosu::bessel_y(n, z);
+    auto jz = kyosu::bessel_j(n, z);
+    for (std::size_t i = 0; i < r_t::size(); ++i)
+    {
+      TTS_RELATIVE_EQUAL(lane(yz, i), kyosu::bessel_y(n, lane(z, i)), tts::prec<T>()) << n << " -- " << i << '\n';
+      TTS_RELATIVE_EQUAL(lane(jz, i), kyosu::bessel_j(n, lane(z, i)), tts::prec<T>()) << n << " -- " << i << '\n';
+    }
+  }
+};
@@ -71,3 +71,17 @@ TTS_CASE_WITH("Check kyosu::dot over quaternion",
   TTS_RELATIVE_EQUAL(d, kyosu::dot(kumi::make_tuple(q0, q1, q2, q3)), 1e-7);
   TTS_RELATIVE_EQUAL(d, kyosu::dot(kumi::make_tuple(q0, q1), kumi::make_tuple(q2, q3)), 1e-7);
 };
+
+TTS_CASE_TPL("Check kyosu::dot[kahan] on cancelling sums", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using type = kyosu::complex_t<T>;
+  T big = sizeof(T) == 8 ? T(1.0e16) : T(1.0e8);
+  auto o = type(1, 0);
+  auto c0 = type(big, 1);
+  auto c1 = type(1, big);
+  auto c2 = type(-big, -big);
+  TTS_EQUAL(kyosu::dot[eve::kahan](c0, c1, c2, o, o, o), type(1, 1));
+  TTS_EQUAL(kyosu::dot[eve::kahan](kumi::make_tuple(c0, c1, c2), kumi::make_tuple(o, o, o)), type(1, 1));
+  TTS_EQUAL(kyosu::add[eve::kahan](c0, c1, c2), type(1, 1));
+};
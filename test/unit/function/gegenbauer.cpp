@@ -21,3 +21,67 @@ TTS_CASE_WITH("Check behavior of gegenbauer on wide", kyosu::real_types, tts::be
     TTS_ULP_EQUAL(eve::gegenbauer(n, T(2.0), a0), kyosu::real(kyosu::gegenbauer(T(n), T(2.0), a0)), 4000);
   }
 };
+
+TTS_CASE_WITH("Check behavior of gegenbauer series",
+              kyosu::real_types,
+              tts::between(-1.0, 1.0),
+              tts::between(-1.0, 1.0),
+              tts::between(-1.0, 1.0),
+              tts::between(0.5, 2.0))
+<typename T>(T const& a0, T const& a1, T const& a2, T const& l)
+{
+  auto pr = tts::prec<T>(1.0e-3, 1.0e-7);
+  auto c0 = kyosu::complex(a1, a2);
+  auto c2 = kyosu::complex(l, a0);
+  auto c3 = kyosu::complex(T(0.5), a1);
+  kyosu::coefficients c{c0, a2, c2, c3};
+
+  auto z = kyosu::complex(a0, a1);
+  auto g1 = 2 * l * z;
+  auto g2 = 2 * l * (1 + l) * z * z - l;
+  auto g3 = (4 * l * (1 + l) * (2 + l) * z * z / 3 - 2 * l * (1 + l)) * z;
+  TTS_RELATIVE_EQUAL(kyosu::gegenbauer(l, z, c), c0 + a2 * g1 + c2 * g2 + c3 * g3, pr);
+
+  auto q = kyosu::quaternion(a0, a1, a2, l);
+  auto q0 = kyosu::quaternion(l, a2, a1, a0);
+  auto q1 = kyosu::quaternion(a1, a0, l, a2);
+  TTS_RELATIVE_EQUAL(kyosu::gegenbauer(l, q, kyosu::coefficients{q0, q1}), q0 + q1 * (2 * l * q), pr);
+};
+
+TTS_CASE_TPL("Check behavior of gegenbauer series over spans", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  kyosu::coefficients c{c_t(1, 2), T(-0.5), c_t(0.25, -1.5), c_t(2, 0.5), T(1), c_t(-1, 0.125)};
+
+  std::array<c_t, 29> zs;
+  std::array<c_t, 29> rs;
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = c_t(T(i) / 29 - T(0.5), T(0.25) - T(i) / 57);
+
+  kyosu::gegenbauer(T(1.5), std::span(zs), c, std::span(rs));
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    TTS_RELATIVE_EQUAL(rs[i], kyosu::gegenbauer(T(1.5), zs[i], c), tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check behavior of gegenbauer sequences", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  constexpr std::size_t np = 19;
+  constexpr std::size_t nd = 9;
+
+  std::array<c_t, np> zs;
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = c_t(T(i) / np - T(0.5), T(0.25) - T(i) / 37);
+
+  std::array<c_t, nd> ps;
+  kyosu::gegenbauer(T(1.5), zs[3], std::span(ps));
+  for (std::size_t k = 0; k < nd; ++k) TTS_RELATIVE_EQUAL(ps[k], kyosu::gegenbauer(T(k), T(1.5), zs[3]), tts::prec<T>(1.0e-3, 1.0e-7));
+
+  std::array<c_t, nd * np> m;
+  kyosu::gegenbauer(T(1.5), std::span(zs), std::span(m));
+  for (std::size_t j = 0; j < np; ++j)
+  {
+    kyosu::gegenbauer(T(1.5), zs[j], std::span(ps));
+    for (std::size_t k = 0; k < nd; ++k) TTS_RELATIVE_EQUAL(m[k * np + j], ps[k], tts::prec<T>());
+  }
+};
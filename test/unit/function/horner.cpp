@@ -91,3 +91,85 @@ TTS_CASE_WITH("Check kyosu::horner over quaternion",
   TTS_RELATIVE_EQUAL(kyosu::horner(x, a), (q0 * x + q1) * x + q2, tts::prec<T>());
   TTS_RELATIVE_EQUAL(kyosu::horner[eve::right](x, a), x * (x * q0 + q1) + q2, tts::prec<T>());
 };
+
+TTS_CASE_WITH("Check kyosu::horner[estrin] and kyosu::horner[second_order]",
+              kyosu::real_types,
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(0, 1),
+              tts::randoms(0, 1))
+<typename T>(T r0, T i0, T r1, T i1, T r2, T i2, T j2, T k2, T x0, T x1)
+{
+  using q_t = kyosu::quaternion_t<T>;
+  auto c0 = kyosu::complex(r0, i0);
+  auto c1 = kyosu::complex(r1, i1);
+  auto q2 = q_t(r2, i2, j2, k2);
+  auto q3 = q_t(i0, r1, j2, r0);
+  auto x = q_t(x0, x1, x0, x1);
+  auto xc = kyosu::complex(x0, x1);
+
+  auto ref_c = kyosu::horner(xc, c0, c1, r2, c1, c0, r0);
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::estrin](xc, c0, c1, r2, c1, c0, r0), ref_c, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::second_order](xc, c0, c1, r2, c1, c0, r0), ref_c, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::estrin](xc, c0, c1), c0 * xc + c1, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::second_order](xc, c0), c0, tts::prec<T>());
+
+  auto ref_r = kyosu::horner(x0, r0, r1, r2, i0, i1);
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::estrin](x0, r0, r1, r2, i0, i1), ref_r, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::second_order](x0, r0, r1, r2, i0, i1), ref_r, tts::prec<T>());
+
+  kyosu::coefficients a{q2, c0, q3, c1, r0};
+  auto ref_l = kyosu::horner(x, a);
+  auto ref_r4 = kyosu::horner[eve::right](x, a);
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::estrin](x, a), ref_l, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::second_order](x, a), ref_l, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::estrin][eve::right](x, a), ref_r4, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::horner[kyosu::second_order][eve::right](x, a), ref_r4, tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::reverse_horner[kyosu::estrin](x, r0, c1, q3, c0, q2), ref_l, tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check kyosu::horner over spans", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  kyosu::coefficients a{c_t(1, 2), c_t(-0.5, 1), T(3), c_t(0.25, -1.5), c_t(2, 0.5), c_t(-1, -1), T(0.5)};
+
+  std::array<c_t, 37> xs;
+  std::array<c_t, 37> rs;
+  for (std::size_t i = 0; i < xs.size(); ++i) xs[i] = c_t(T(i) / 37, T(1) - T(i) / 19);
+
+  kyosu::horner(std::span(xs), a, std::span(rs));
+  for (std::size_t i = 0; i < xs.size(); ++i) TTS_RELATIVE_EQUAL(rs[i], kyosu::horner(xs[i], a), tts::prec<T>());
+
+  kyosu::horner[kyosu::estrin](std::span<c_t const>(xs), a, std::span(rs));
+  for (std::size_t i = 0; i < xs.size(); ++i) TTS_RELATIVE_EQUAL(rs[i], kyosu::horner(xs[i], a), tts::prec<T>());
+
+  std::array<T, 21> ts;
+  std::array<c_t, 21> cs;
+  for (std::size_t i = 0; i < ts.size(); ++i) ts[i] = T(i) / 21 - T(0.5);
+  kyosu::horner(std::span(ts), a, std::span(cs));
+  for (std::size_t i = 0; i < ts.size(); ++i) TTS_RELATIVE_EQUAL(cs[i], kyosu::horner(ts[i], a), tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check kyosu::horner[kahan] near a multiple root", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  if constexpr (sizeof(T) == 8)
+  {
+    using c_t = kyosu::complex_t<T>;
+    // (x-1)^7 expanded: the plain scheme loses all significant digits close to 1
+    auto x = c_t(1.0009765625, 0.00048828125);
+    auto ref = kyosu::pow(x - T(1), 7);
+    auto c = kyosu::coefficients{T(1), T(-7), T(21), T(-35), T(35), T(-21), T(7), T(-1)};
+    TTS_RELATIVE_EQUAL(kyosu::horner[eve::kahan](x, c), ref, tts::prec<T>(1.0e-3, 1.0e-6));
+    TTS_RELATIVE_EQUAL(kyosu::horner[eve::kahan](x, T(1), T(-7), T(21), T(-35), T(35), T(-21), T(7), T(-1)), ref,
+                       tts::prec<T>(1.0e-3, 1.0e-6));
+  }
+  TTS_EQUAL(0, 0);
+};
@@ -80,3 +80,35 @@ TTS_CASE_TPL ( "Check hyper 2F1"
   }
   TTS_EQUAL(0, 0);
 };
+
+TTS_CASE_TPL("Check hyper 2F1 mixed lanes and batch", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  using w_t = eve::wide<c_t>;
+  auto a = kumi::tuple{T(0.25), T(1.5)};
+  auto b = kumi::tuple{T(2.75)};
+
+  // points spread over all the series of the 2F1 engine
+  std::array<c_t, 37> zs;
+  for (std::size_t i = 0; i < zs.size(); ++i)
+  {
+    auto rho = T(0.1) + T(i % 9) * T(0.35);
+    auto theta = T(i) * T(0.7);
+    zs[i] = c_t(rho * eve::cos(theta), rho * eve::sin(theta));
+  }
+
+  w_t z([&](auto i, auto) { return zs[i]; });
+  auto r = kyosu::hypergeometric(z, a, b);
+  for (std::ptrdiff_t i = 0; i < w_t::size(); ++i)
+    TTS_RELATIVE_EQUAL(r.get(i), kyosu::hypergeometric(zs[i], a, b), tts::prec<T>(1.0e-3, 1.0e-10));
+
+  std::array<c_t, 37> rs;
+  kyosu::hypergeometric(std::span(zs), a, b, std::span(rs));
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    TTS_RELATIVE_EQUAL(rs[i], kyosu::hypergeometric(zs[i], a, b), tts::prec<T>(1.0e-3, 1.0e-10));
+
+  kyosu::hypergeometric[kyosu::regularized](std::span(zs), a, b, std::span(rs));
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    TTS_RELATIVE_EQUAL(rs[i], kyosu::hypergeometric[kyosu::regularized](zs[i], a, b), tts::prec<T>(1.0e-3, 1.0e-10));
+};
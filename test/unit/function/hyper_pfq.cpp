@@ -0,0 +1,67 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <eve/wide.hpp>
+
+TTS_CASE_TPL("Check hyper pFq", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  if constexpr (sizeof(T) == 8)
+  {
+    auto pr = tts::prec<T>(4.0e-3, 1.0e-10);
+    using r_t = kyosu::complex_t<T>;
+    auto cinf = kyosu::cinf(eve::as<r_t>());
+    auto pi2 = eve::sqr(eve::pi(eve::as<T>()));
+
+    // 3F2(1, 1, 1; 2, 2; z) = Li2(z)/z
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(0.5, kumi::tuple{1.0, 1.0, 1.0}, kumi::tuple{2.0, 2.0}),
+                       r_t(1.164481052930025), pr);
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(-1.0, kumi::tuple{1.0, 1.0, 1.0}, kumi::tuple{2.0, 2.0}), r_t(pi2 / 12),
+                       pr);
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(-3.0, kumi::tuple{1.0, 1.0, 1.0}, kumi::tuple{2.0, 2.0}),
+                       r_t(0.6464584735889031), pr);
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(1.0, kumi::tuple{1.0, 1.0, 1.0}, kumi::tuple{2.0, 2.0}), r_t(pi2 / 6),
+                       tts::prec<T>(4.0e-3, 1.0e-6));
+
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(0.3, kumi::tuple{1.5, 2.0, 0.5}, kumi::tuple{3.0, 2.5, 1.25}),
+                       r_t(1.0506998885243344), pr);
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(-0.7, kumi::tuple{0.5, 1.0, 2.0, 0.25}, kumi::tuple{1.5, 3.0, 2.5}),
+                       r_t(0.9859160293357548), pr);
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(2.0, kumi::tuple{-3.0, 1.5, 2.0}, kumi::tuple{0.5, 2.5}),
+                       r_t(-6.3904761904761855), pr);
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(r_t(5.0, 1.0), kumi::tuple{1.0, 1.0}, kumi::tuple{3.0, 4.0, 5.0}),
+                       r_t(1.0904599115006803, 0.01976218493773964), pr);
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(-12.0, kumi::tuple{1.25, 0.5, -2.5}, kumi::tuple{3.5, 1.75, 2.0, 0.75}),
+                       r_t(4.060840963303494), pr);
+    TTS_EQUAL(kyosu::hypergeometric(0.5, kumi::tuple{1.0, 1.0, 1.0}, kumi::tuple{-2.0, 2.0}), cinf);
+    // the pole b = -3 is cancelled by a = -2: 1 + z/3 + z^2/9
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(0.5, kumi::tuple{-2.0, 1.0, 1.0}, kumi::tuple{-3.0, 2.0}),
+                       r_t(43.0 / 36.0), pr);
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric(2.0, kumi::tuple{-2.0, 1.0, 1.0}, kumi::tuple{-3.0, 2.0}),
+                       r_t(19.0 / 9.0), pr);
+
+    TTS_RELATIVE_EQUAL(kyosu::hypergeometric[kyosu::regularized](0.5, kumi::tuple{1.0, 1.0, 1.0}, kumi::tuple{2.0, 2.0}),
+                       r_t(1.164481052930025), pr);
+  }
+  TTS_EQUAL(0, 0);
+};
+
+TTS_CASE_TPL("Check hyper pFq on wide", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using r_t = kyosu::complex_t<T>;
+  using w_t = eve::wide<r_t>;
+  auto a = kumi::tuple{T(1), T(1), T(1)};
+  auto b = kumi::tuple{T(2), T(2)};
+
+  w_t z([](auto i, auto) { return r_t(T(-2) + T(i) * T(0.45), T(0.1) * T(i % 3)); });
+  auto r = kyosu::hypergeometric(z, a, b);
+  for (std::ptrdiff_t i = 0; i < w_t::size(); ++i)
+    TTS_RELATIVE_EQUAL(r.get(i), kyosu::hypergeometric(z.get(i), a, b), tts::prec<T>(1.0e-3, 1.0e-8));
+};
@@ -0,0 +1,100 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#include <eve/module/polynomial/regular/polynomial.hpp>
+
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+
+//==================================================================================================
+//== laguerre tests
+//==================================================================================================
+TTS_CASE_WITH("Check behavior of laguerre on wide", kyosu::real_types, tts::between(-1.0, 1.0))
+<typename T>(T const& a0)
+{
+  if constexpr (sizeof(eve::element_type_t<T>) == 8)
+  {
+    for (unsigned int n = 0; n < 6; ++n)
+    {
+      TTS_ULP_EQUAL(eve::laguerre(n, a0), kyosu::real(kyosu::laguerre(T(n), a0)), 2000);
+    }
+  }
+};
+
+TTS_CASE_WITH("Check behavior of successor(laguerre)", kyosu::real_types, tts::between(-1.0, 1.0))
+<typename T>(T const& a0)
+{
+  auto pr = tts::prec<T>(1.0e-3, 1.0e-7);
+  auto t3 = kyosu::laguerre(3.0, a0);
+  auto t4 = kyosu::laguerre(4.0, a0);
+  auto t5 = kyosu::laguerre(5.0, a0);
+  TTS_RELATIVE_EQUAL(kyosu::laguerre[eve::successor](4.0, a0, t4, t3), t5, pr);
+};
+
+TTS_CASE_WITH("Check behavior of laguerre series",
+              kyosu::real_types,
+              tts::between(-1.0, 1.0),
+              tts::between(-1.0, 1.0),
+              tts::between(-1.0, 1.0),
+              tts::between(-1.0, 1.0))
+<typename T>(T const& a0, T const& a1, T const& a2, T const& a3)
+{
+  auto pr = tts::prec<T>(1.0e-3, 1.0e-7);
+  auto c0 = kyosu::complex(a1, a2);
+  auto c2 = kyosu::complex(a3, a0);
+  auto c3 = kyosu::complex(T(0.5), a1);
+  kyosu::coefficients c{c0, a3, c2, c3};
+
+  auto z = kyosu::complex(a0, a1);
+  auto l1 = 1 - z;
+  auto l2 = ((z - 4) * z + 2) / 2;
+  auto l3 = (((-z + 9) * z - 18) * z + 6) / 6;
+  TTS_RELATIVE_EQUAL(kyosu::laguerre(z, c), c0 + a3 * l1 + c2 * l2 + c3 * l3, pr);
+
+  auto q = kyosu::quaternion(a0, a1, a2, a3);
+  auto q0 = kyosu::quaternion(a3, a2, a1, a0);
+  auto q1 = kyosu::quaternion(a1, a0, a3, a2);
+  TTS_RELATIVE_EQUAL(kyosu::laguerre(q, kyosu::coefficients{q0, q1, q0}),
+                     q0 + q1 * (1 - q) + q0 * (((q - 4) * q + 2) / 2), pr);
+};
+
+TTS_CASE_TPL("Check behavior of laguerre series over spans", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  kyosu::coefficients c{c_t(1, 2), T(-0.5), c_t(0.25, -1.5), c_t(2, 0.5), T(1), c_t(-1, 0.125)};
+
+  std::array<c_t, 29> zs;
+  std::array<c_t, 29> rs;
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = c_t(T(i) / 29 - T(0.5), T(0.25) - T(i) / 57);
+
+  kyosu::laguerre(std::span(zs), c, std::span(rs));
+  for (std::size_t i = 0; i < zs.size(); ++i) TTS_RELATIVE_EQUAL(rs[i], kyosu::laguerre(zs[i], c), tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check behavior of laguerre sequences", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  constexpr std::size_t np = 19;
+  constexpr std::size_t nd = 9;
+
+  std::array<c_t, np> zs;
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = c_t(T(i) / np - T(0.5), T(0.25) - T(i) / 37);
+
+  std::array<c_t, nd> ps;
+  kyosu::laguerre(zs[3], std::span(ps));
+  for (std::size_t k = 0; k < nd; ++k) TTS_RELATIVE_EQUAL(ps[k], kyosu::laguerre(T(k), zs[3]), tts::prec<T>(1.0e-3, 1.0e-7));
+
+  std::array<c_t, nd * np> m;
+  kyosu::laguerre(std::span(zs), std::span(m));
+  for (std::size_t j = 0; j < np; ++j)
+  {
+    kyosu::laguerre(zs[j], std::span(ps));
+    for (std::size_t k = 0; k < nd; ++k) TTS_RELATIVE_EQUAL(m[k * np + j], ps[k], tts::prec<T>());
+  }
+};
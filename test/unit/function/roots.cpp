@@ -0,0 +1,119 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <vector>
+
+namespace
+{
+  // distance of z to the nearest of the roots rs
+  template<typename Z, typename R> auto nearest(Z const& z, R const& rs)
+  {
+    auto d = kyosu::abs(z - rs[0]);
+    for (auto const& r : rs) d = eve::min(d, kyosu::abs(z - r));
+    return d;
+  }
+}
+
+TTS_CASE_TPL("Check kyosu::roots on scalar polynomials", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  // (z - 1)(z + 2)(z - i)(z + i) = z^4 + z^3 - z^2 + z - 2
+  auto [zs, ok] = kyosu::roots(kyosu::coefficients{T(1), T(1), T(-1), T(1), T(-2)});
+  std::array<c_t, 4> expected{c_t(1), c_t(-2), c_t(0, 1), c_t(0, -1)};
+  TTS_EXPECT(ok);
+  for (auto const& e : expected) TTS_LESS_EQUAL(nearest(e, zs), 128 * eve::eps(eve::as<T>()));
+
+  auto [z1, ok1] = kyosu::roots(kyosu::coefficients{c_t(2, 1), c_t(-1, 3)});
+  TTS_EXPECT(ok1);
+  TTS_RELATIVE_EQUAL(z1[0], c_t(-1, 3) / c_t(-2, -1), tts::prec<T>());
+
+  // z^12 - 1
+  auto [u, oku] = kyosu::roots(kyosu::coefficients{c_t(1), c_t(0), c_t(0), c_t(0), c_t(0), c_t(0), c_t(0), c_t(0),
+                                                    c_t(0), c_t(0), c_t(0), c_t(0), c_t(-1)});
+  TTS_EXPECT(oku);
+  for (int k = 0; k < 12; ++k)
+  {
+    auto e = kyosu::exp_i(T(2 * k) * eve::pi(eve::as<T>()) / 12);
+    TTS_LESS_EQUAL(nearest(e, u), 64 * eve::eps(eve::as<T>()));
+  }
+};
+
+TTS_CASE_WITH("Check kyosu::roots with one polynomial per lane",
+              kyosu::real_types,
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10),
+              tts::randoms(-10, 10))
+(auto r0, auto i0, auto r1, auto i1, auto r2, auto i2)
+{
+  using T = decltype(r0);
+  using e_t = eve::element_type_t<T>;
+  auto x0 = kyosu::complex(r0, i0), x1 = kyosu::complex(r1, i1), x2 = kyosu::complex(r2, i2);
+  // (z - x0)(z - x1)(z - x2)
+  auto c0 = -(x0 + x1 + x2), c1 = x0 * x1 + x1 * x2 + x0 * x2, c2 = -(x0 * x1 * x2);
+  auto [zs, ok] = kyosu::roots(kyosu::coefficients{T(1), c0, c1, c2});
+  TTS_EXPECT(eve::all(ok));
+  for (auto const& z : zs)
+  {
+    // backward error of each root
+    auto v = kyosu::horner(z, T(1), c0, c1, c2);
+    auto b = eve::horner(kyosu::abs(z), T(1), kyosu::abs(c0), kyosu::abs(c1), kyosu::abs(c2));
+    TTS_EXPECT(eve::all(kyosu::abs(v) <= 128 * eve::eps(eve::as<e_t>()) * b));
+  }
+};
+
+TTS_CASE_TPL("Check kyosu::bulk::roots", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  std::size_t const n = 7, count = 37;
+  kyosu::soa_buffer<T, 2> coefs((n + 1) * count), zs(n * count);
+  for (std::size_t i = 0; i <= n; ++i)
+    for (std::size_t p = 0; p < count; ++p)
+      coefs.set(i * count + p, c_t(eve::sin(T(i * count + p)), eve::cos(T(3 * i + p))));
+
+  TTS_EQUAL(kyosu::bulk::roots(n, coefs, zs, 3), std::size_t(0));
+  for (std::size_t p = 0; p < count; ++p)
+  {
+    // backward error of each root
+    std::vector<c_t> a(n + 1);
+    T s = 0;
+    for (std::size_t i = 0; i <= n; ++i) a[i] = coefs[i * count + p];
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      auto z = zs[k * count + p];
+      c_t v = a[0];
+      T b = kyosu::abs(a[0]);
+      for (std::size_t i = 1; i <= n; ++i)
+      {
+        v = v * z + a[i];
+        b = b * kyosu::abs(z) + kyosu::abs(a[i]);
+      }
+      s = eve::max(s, kyosu::abs(v) / b);
+    }
+    TTS_LESS_EQUAL(s, 128 * eve::eps(eve::as<T>())) << "polynomial " << p;
+  }
+
+  // the same polynomials one at a time
+  for (std::size_t p = 0; p < count; p += 9)
+  {
+    kyosu::soa_buffer<T, 2> one(n + 1), r(n);
+    for (std::size_t i = 0; i <= n; ++i) one.set(i, coefs[i * count + p]);
+    TTS_EQUAL(kyosu::bulk::roots(n, one, r), std::size_t(0));
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      std::vector<c_t> all(n);
+      for (std::size_t j = 0; j < n; ++j) all[j] = zs[j * count + p];
+      TTS_LESS_EQUAL(nearest(r[k], all), eve::sqrt(eve::eps(eve::as<T>())));
+    }
+  }
+};
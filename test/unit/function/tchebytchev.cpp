@@ -24,3 +24,78 @@ TTS_CASE_WITH("Check behavior of tchebytchev on wide", kyosu::real_types, tts::b
     }
   }
 };
+
+TTS_CASE_WITH("Check behavior of tchebytchev series",
+              kyosu::real_types,
+              tts::between(-1.0, 1.0),
+              tts::between(-1.0, 1.0),
+              tts::between(-1.0, 1.0),
+              tts::between(-1.0, 1.0))
+<typename T>(T const& a0, T const& a1, T const& a2, T const& a3)
+{
+  auto pr = tts::prec<T>(1.0e-3, 1.0e-7);
+  auto c0 = kyosu::complex(a1, a2);
+  auto c2 = kyosu::complex(a3, a0);
+  auto c3 = kyosu::complex(T(0.5), a1);
+  kyosu::coefficients c{c0, a3, c2, c3};
+
+  auto z = kyosu::complex(a0, a1);
+  auto t2 = 2 * z * z - 1;
+  auto t3 = (4 * z * z - 3) * z;
+  TTS_RELATIVE_EQUAL(kyosu::tchebytchev(z, c), c0 + a3 * z + c2 * t2 + c3 * t3, pr);
+
+  auto u2 = 4 * z * z - 1;
+  auto u3 = (8 * z * z - 4) * z;
+  TTS_RELATIVE_EQUAL(kyosu::tchebytchev[eve::kind_2](z, c), c0 + a3 * 2 * z + c2 * u2 + c3 * u3, pr);
+
+  TTS_RELATIVE_EQUAL(kyosu::tchebytchev(a0, kyosu::coefficients{a1, a2, a3}),
+                     a1 + a2 * a0 + a3 * (2 * a0 * a0 - 1), pr);
+
+  auto q = kyosu::quaternion(a0, a1, a2, a3);
+  auto q0 = kyosu::quaternion(a3, a2, a1, a0);
+  auto q1 = kyosu::quaternion(a1, a0, a3, a2);
+  TTS_RELATIVE_EQUAL(kyosu::tchebytchev(q, kyosu::coefficients{q0, q1, q0}),
+                     q0 + q1 * q + q0 * (2 * q * q - 1), pr);
+};
+
+TTS_CASE_TPL("Check behavior of tchebytchev series over spans", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  kyosu::coefficients c{c_t(1, 2), T(-0.5), c_t(0.25, -1.5), c_t(2, 0.5), T(1), c_t(-1, 0.125)};
+
+  std::array<c_t, 29> zs;
+  std::array<c_t, 29> rs;
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = c_t(T(i) / 29 - T(0.5), T(0.25) - T(i) / 57);
+
+  kyosu::tchebytchev(std::span(zs), c, std::span(rs));
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    TTS_RELATIVE_EQUAL(rs[i], kyosu::tchebytchev(zs[i], c), tts::prec<T>());
+
+  kyosu::tchebytchev[eve::kind_2](std::span(zs), c, std::span(rs));
+  for (std::size_t i = 0; i < zs.size(); ++i)
+    TTS_RELATIVE_EQUAL(rs[i], kyosu::tchebytchev[eve::kind_2](zs[i], c), tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check behavior of tchebytchev sequences", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  constexpr std::size_t np = 19;
+  constexpr std::size_t nd = 9;
+
+  std::array<c_t, np> zs;
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = c_t(T(i) / np - T(0.5), T(0.25) - T(i) / 37);
+
+  std::array<c_t, nd> ps;
+  kyosu::tchebytchev(zs[3], std::span(ps));
+  for (std::size_t k = 0; k < nd; ++k) TTS_RELATIVE_EQUAL(ps[k], kyosu::tchebytchev(T(k), zs[3]), tts::prec<T>(1.0e-3, 1.0e-7));
+
+  std::array<c_t, nd * np> m;
+  kyosu::tchebytchev(std::span(zs), std::span(m));
+  for (std::size_t j = 0; j < np; ++j)
+  {
+    kyosu::tchebytchev(zs[j], std::span(ps));
+    for (std::size_t k = 0; k < nd; ++k) TTS_RELATIVE_EQUAL(m[k * np + j], ps[k], tts::prec<T>());
+  }
+};
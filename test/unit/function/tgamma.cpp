@@ -7,6 +7,8 @@
 //======================================================================================================================
 #include <kyosu/kyosu.hpp>
 #include <test.hpp>
+#include <array>
+#include <vector>
 
 TTS_CASE_WITH("Check kyosu::tgamma over quaternion",
               kyosu::simd_real_types,
@@ -33,3 +35,67 @@ TTS_CASE_WITH("Check kyosu::tgamma over quaternion",
   TTS_RELATIVE_EQUAL(cpl(c), kyosu::pi(eve::as(c)), tts::prec<T>());
   TTS_RELATIVE_EQUAL(cpl(q), kyosu::pi(eve::as(q)), tts::prec<T>());
 };
+
+TTS_CASE_WITH("Check kyosu::tgamma on vertical lines", kyosu::real_types, tts::randoms(0.1, 12))
+<typename T>(T y)
+{
+  using ce_t = kyosu::complex_t<T>;
+  auto pi = eve::pi(eve::as(y));
+  auto h = eve::half(eve::as(y));
+
+  // |Γ(1/2+iy)|² = π/cosh(πy), |Γ(iy)|² = π/(y sinh(πy)), across the Lanczos and Stirling regimes
+  TTS_RELATIVE_EQUAL(kyosu::sqr_abs(kyosu::tgamma(ce_t(h, y))), pi / eve::cosh(pi * y), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::sqr_abs(kyosu::tgamma(ce_t(T(0), y))), pi / (y * eve::sinh(pi * y)), tts::prec<T>());
+  TTS_RELATIVE_EQUAL(kyosu::sqr_abs(kyosu::tgamma(ce_t(-h, y))), pi / (eve::cosh(pi * y) * (h * h + y * y)),
+                     tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check kyosu::tgamma at complex points", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  using w_t = kyosu::complex_t<eve::wide<T>>;
+
+  // Lanczos, reflected and Stirling regimes
+  std::array<c_t, 8> const zs{c_t(1, 1),      c_t(0.5, 1),   c_t(0, 1),   c_t(2, 3),
+                              c_t(-1.5, 0.5), c_t(0.25, 15), c_t(12, -4), c_t(-3.5, 2)};
+  std::array<c_t, 8> const gs{c_t(0.49801566811834835, -0.15494982830180837),
+                              c_t(0.30069461726066027, -0.4249678794331298),
+                              c_t(-0.15494982830180876, -0.49801566811834824),
+                              c_t(-0.08239527266561093, 0.09177428743525821),
+                              c_t(0.9379166627878602, 0.34920566814779613),
+                              c_t(7.417455412674897e-11, 7.143251783121066e-12),
+                              c_t(-18400511.99836636, 8297161.140289769),
+                              c_t(-0.001561837432876723, 0.0004611942720843653)};
+  for (std::size_t i = 0; i < zs.size(); ++i) TTS_RELATIVE_EQUAL(kyosu::tgamma(zs[i]), gs[i], tts::prec<T>());
+
+  // lanes of different regimes in one value
+  w_t w([&](auto i, auto) { return zs[i % zs.size()]; });
+  auto r = kyosu::tgamma(w);
+  for (std::size_t i = 0; i < std::size_t(w_t::size()); ++i)
+    TTS_RELATIVE_EQUAL(c_t(r.get(i)), gs[i % gs.size()], tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check kyosu::bulk::tgamma", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  std::size_t const n = 1003;
+  std::vector<c_t> in(n), out(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    // runs of direct, reflected and mixed chunks
+    auto s = (i / 64) % 3 == 0 ? T(1) : ((i / 64) % 3 == 1 ? T(-1) : eve::sign(eve::sin(T(i))));
+    in[i] = c_t(s * (T(0.05) + T(i % 17)), eve::cos(T(i)) * T(i % 13));
+  }
+  in[5] = c_t(T(-3), T(0));
+  in[7] = c_t(T(0), T(0));
+
+  kyosu::bulk::tgamma(in, out, 3);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    auto ref = kyosu::tgamma(in[i]);
+    if (kyosu::is_nan(ref) || kyosu::is_infinite(ref)) TTS_EQUAL(kyosu::is_nan(out[i]), kyosu::is_nan(ref)) << i;
+    else TTS_RELATIVE_EQUAL(out[i], ref, tts::prec<T>()) << i;
+  }
+};
@@ -0,0 +1,74 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <vector>
+
+namespace
+{
+  // the method m of the plan must agree with f on scalars, on SIMD values and on spans
+  template<typename T, typename M, typename F> void check_plan(M m, F f, std::vector<kyosu::complex_t<T>> zs)
+  {
+    using r_t = eve::wide<T>;
+    for (auto z : zs) TTS_RELATIVE_EQUAL(m(z), f(z), tts::prec<T>()) << z << '\n';
+
+    auto w = kyosu::complex(r_t([&](auto i, auto) { return kyosu::real(zs[i % zs.size()]); }),
+                            r_t([&](auto i, auto) { return kyosu::imag(zs[i % zs.size()]); }));
+    auto mw = m(w);
+    for (std::size_t i = 0; i < r_t::size(); ++i)
+      TTS_RELATIVE_EQUAL(kyosu::complex(kyosu::real(mw).get(i), kyosu::imag(mw).get(i)), f(zs[i % zs.size()]),
+                         tts::prec<T>())
+        << i << '\n';
+  }
+}
+
+TTS_CASE_TPL("Check kyosu::bessel_plan against the bessel functions", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  using kyosu::kind_2;
+  // small and large arguments, on both sides of the imaginary axis
+  std::vector<c_t> zs{c_t(0.5, 0.25), c_t(1.5, -2), c_t(-3, 1), c_t(6, 0), c_t(-2.5, -1.5), c_t(40, 3), c_t(-35, 5)};
+
+  for (T v : {T(2.5), T(-1.3), T(3), T(0.75), T(-2)})
+  {
+    kyosu::bessel_plan<T> p(v);
+    TTS_EQUAL(p.order(), v);
+    check_plan<T>([&](auto z) { return p.j(z); }, [v](auto z) { return kyosu::bessel_j(v, z); }, zs);
+    check_plan<T>([&](auto z) { return p.y(z); }, [v](auto z) { return kyosu::bessel_y(v, z); }, zs);
+    check_plan<T>([&](auto z) { return p.h1(z); }, [v](auto z) { return kyosu::bessel_h(v, z); }, zs);
+    check_plan<T>([&](auto z) { return p.h2(z); }, [v](auto z) { return kyosu::bessel_h[kind_2](v, z); }, zs);
+  }
+
+  // I and K grow or decay exponentially: moderate arguments, integral orders included
+  std::vector<c_t> ws{c_t(0.5, 0.25), c_t(1.5, -2), c_t(-3, 1), c_t(6, 0), c_t(-2.5, -1.5), c_t(0, 4)};
+  for (T v : {T(2.5), T(-1.3), T(0.75), T(2), T(-3)})
+  {
+    kyosu::bessel_plan<T> p(v);
+    check_plan<T>([&](auto z) { return p.i(z); }, [v](auto z) { return kyosu::bessel_i(v, z); }, ws);
+    check_plan<T>([&](auto z) { return p.k(z); }, [v](auto z) { return kyosu::bessel_k(v, z); }, ws);
+  }
+};
+
+TTS_CASE_TPL("Check kyosu::bessel_plan over spans", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  kyosu::bessel_plan<T> p(T(1.5));
+
+  std::vector<T> xs(1000);
+  for (std::size_t i = 0; i < xs.size(); ++i) xs[i] = T(0.05) * T(i + 1);
+  std::vector<c_t> js(xs.size()), ks(xs.size());
+  p.j(std::span(xs), std::span(js));
+  p.k(std::span(xs), std::span(ks), 4);
+  for (std::size_t i = 0; i < xs.size(); ++i)
+  {
+    TTS_RELATIVE_EQUAL(js[i], kyosu::bessel_j(T(1.5), c_t(xs[i])), tts::prec<T>()) << xs[i] << '\n';
+    TTS_RELATIVE_EQUAL(ks[i], kyosu::bessel_k(T(1.5), c_t(xs[i])), tts::prec<T>()) << xs[i] << '\n';
+  }
+};
@@ -0,0 +1,150 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <sstream>
+#include <string>
+#include <test.hpp>
+#include <vector>
+
+#if defined(__cpp_lib_to_chars)
+namespace
+{
+  template<typename Z> std::string format(Z const& z)
+  {
+    char buffer[1024];
+    auto [p, ec] = kyosu::to_chars(buffer, buffer + sizeof(buffer), z);
+    return ec == std::errc{} ? std::string(buffer, p) : std::string("error");
+  }
+
+  template<typename Z> Z parse(std::string const& s, std::errc expected = std::errc{})
+  {
+    Z z(-42);
+    auto [p, ec] = kyosu::from_chars(s.data(), s.data() + s.size(), z);
+    TTS_EXPECT(ec == expected) << s << '\n';
+    if (ec != std::errc{}) TTS_EXPECT(p == s.data()) << s << '\n';
+    return z;
+  }
+}
+
+TTS_CASE_TPL("Check kyosu::to_chars and kyosu::from_chars", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  using q_t = kyosu::quaternion_t<T>;
+  using o_t = kyosu::octonion_t<T>;
+
+  TTS_EQUAL(format(c_t(1.5, -2.25)), std::string("1.5 - 2.25i"));
+  TTS_EQUAL(format(q_t(1, 2, -3, 0.5)), std::string("1 + 2i - 3j + 0.5k"));
+  TTS_EQUAL(format(o_t(-1, 0, 0, 0, 0, 0, 0, 2)), std::string("-1 + 0i + 0j + 0k + 0l + 0li + 0lj + 2lk"));
+
+  TTS_EQUAL(parse<c_t>("1.5 - 2.25i"), c_t(1.5, -2.25));
+  TTS_EQUAL(parse<c_t>("3i"), c_t(0, 3));
+  TTS_EQUAL(parse<c_t>("+1-2i"), c_t(1, -2));
+  TTS_EQUAL(parse<q_t>("  -1+2i-3j"), q_t(-1, 2, -3, 0));
+  TTS_EQUAL(parse<q_t>("2j + 1 - -4k"), q_t(1, 0, 2, 4));
+  TTS_EQUAL(parse<o_t>("1 - 2li + 3lk"), o_t(1, 0, 0, 0, 0, -2, 0, 3));
+  TTS_EXPECT(kyosu::is_nan(parse<c_t>("nan + 1i")));
+  TTS_EQUAL(parse<c_t>("inf - infi"), c_t(eve::inf(eve::as<T>()), eve::minf(eve::as<T>())));
+
+  // what follows a value is left in place
+  std::string s = "1 + 2i, 3";
+  c_t z;
+  auto [p, ec] = kyosu::from_chars(s.data(), s.data() + s.size(), z);
+  TTS_EXPECT(ec == std::errc{});
+  TTS_EQUAL(p, s.data() + 6);
+
+  // malformed values
+  parse<c_t>("abc", std::errc::invalid_argument);
+  parse<c_t>("1 + 2j", std::errc::invalid_argument);
+  parse<c_t>("1 + 2i + 3i", std::errc::invalid_argument);
+  parse<c_t>("1 + ", std::errc::invalid_argument);
+
+  // too small a buffer
+  char small[4];
+  TTS_EXPECT(kyosu::to_chars(small, small + 4, c_t(1, 2)).ec == std::errc::value_too_large);
+};
+
+TTS_CASE_TPL("Check kyosu::from_chars on the output of operator<< and kyosu::to_chars", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using q_t = kyosu::quaternion_t<T>;
+  using s_t = kyosu::cayley_dickson<T, 16>;
+
+  q_t q(0.5, -1.25, 3, -0.125);
+  std::ostringstream os;
+  os << q;
+  TTS_EQUAL(parse<q_t>(os.str()), q);
+
+  // shortest round trips
+  for (int k = 0; k < 100; ++k)
+  {
+    q_t r(tts::random_value<T>(-1e6, 1e6), tts::random_value<T>(-1, 1), tts::random_value<T>(-1e-6, 1e-6),
+          tts::random_value<T>(-10, 10));
+    TTS_EQUAL(parse<q_t>(format(r)), r);
+  }
+
+  s_t h(1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11, -12, 13, -14, 15, -16);
+  TTS_EQUAL(format(h).substr(0, 13), std::string("1z0 - 2z1 + 3"));
+  TTS_EQUAL(parse<s_t>(format(h)), h);
+  std::ostringstream oh;
+  oh << h;
+  TTS_EQUAL(parse<s_t>(oh.str()), h);
+};
+
+TTS_CASE_TPL("Check kyosu::to_chars and kyosu::from_chars over spans", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  std::vector<c_t> zs(57);
+  for (std::size_t k = 0; k < zs.size(); ++k) zs[k] = c_t(T(k) / 7, -T(k * k) / 3);
+
+  std::vector<char> buffer(zs.size() * 64);
+  auto w = kyosu::to_chars(buffer.data(), buffer.data() + buffer.size(), std::span(zs), ',');
+  TTS_EXPECT(w.ec == std::errc{});
+  TTS_EQUAL(w.count, zs.size());
+
+  std::vector<c_t> rs(zs.size() + 3);
+  auto r = kyosu::from_chars(buffer.data(), w.ptr, std::span(rs), ',');
+  TTS_EXPECT(r.ec == std::errc{});
+  TTS_EQUAL(r.count, zs.size());
+  TTS_EQUAL(r.ptr, static_cast<char const*>(w.ptr));
+  for (std::size_t k = 0; k < zs.size(); ++k) TTS_EQUAL(rs[k], zs[k]) << k << '\n';
+
+  // values over several lines, a malformed one
+  std::string text = "1 + 2i\n  3 - 4i\r\n-5i\n6 + 7q\n";
+  auto t = kyosu::from_chars(text.data(), text.data() + text.size(), std::span(rs));
+  TTS_EXPECT(t.ec == std::errc::invalid_argument);
+  TTS_EQUAL(t.count, std::size_t(3));
+  TTS_EQUAL(rs[2], c_t(0, -5));
+
+  // blank separated values starting with a sign
+  std::string signs = "1 -2 +3i -4i 5 - 6i";
+  auto u = kyosu::from_chars(signs.data(), signs.data() + signs.size(), std::span(rs));
+  TTS_EXPECT(u.ec == std::errc{});
+  TTS_EQUAL(u.count, std::size_t(4));
+  TTS_EQUAL(rs[0], c_t(1, 0));
+  TTS_EQUAL(rs[1], c_t(-2, 3));
+  TTS_EQUAL(rs[2], c_t(0, -4));
+  TTS_EQUAL(rs[3], c_t(5, -6));
+  std::string spaced = "1 - 2";
+  TTS_EXPECT(kyosu::from_chars(spaced.data(), spaced.data() + spaced.size(), std::span(rs)).ec ==
+             std::errc::invalid_argument);
+
+  // output stopped by the end of the buffer
+  auto s = kyosu::to_chars(buffer.data(), buffer.data() + 40, std::span(zs), '\n');
+  TTS_EXPECT(s.ec == std::errc::value_too_large);
+  TTS_EXPECT(s.count < zs.size());
+  TTS_EQUAL(std::count(buffer.data(), s.ptr, '\n'), std::ptrdiff_t(s.count));
+};
+#else
+TTS_CASE("Check kyosu::to_chars and kyosu::from_chars")
+{
+  // the standard library has no floating-point std::to_chars and std::from_chars
+  TTS_EQUAL(0, 0);
+};
+#endif
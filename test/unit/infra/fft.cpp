@@ -0,0 +1,92 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+  template<typename T> auto naive_dft(kyosu::soa_view<T const, 2> x, std::size_t n, int sign)
+  {
+    using c_t = kyosu::complex_t<double>;
+    std::vector<c_t> y(n);
+    for (std::size_t k = 0; k < n; ++k)
+      for (std::size_t j = 0; j < n; ++j)
+        y[k] += c_t(kyosu::real(x[j]), kyosu::imag(x[j])) * kyosu::exp_i(sign * 2 * std::numbers::pi * double((j * k) % n) / double(n));
+    return y;
+  }
+
+  template<typename T> auto max_error(kyosu::soa_view<T const, 2> x, std::vector<kyosu::complex_t<double>> const& y)
+  {
+    double e = 0, m = 0;
+    for (std::size_t k = 0; k < y.size(); ++k)
+    {
+      e = std::max(e, double(kyosu::abs(kyosu::complex_t<double>(kyosu::real(x[k]), kyosu::imag(x[k])) - y[k])));
+      m = std::max(m, double(kyosu::abs(y[k])));
+    }
+    return e / std::max(m, 1.0);
+  }
+}
+
+TTS_CASE_TPL("Check fft_plan against a naive DFT", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  double tol = sizeof(T) == 4 ? 1.0e-5 : 1.0e-13;
+  for (std::size_t n : {1, 2, 3, 4, 5, 8, 12, 16, 30, 32, 49, 64, 105, 128, 256, 384, 1000})
+  {
+    kyosu::soa_buffer<T, 2> x(n), y(n), z(n);
+    for (std::size_t i = 0; i < n; ++i) x.set(i, kyosu::complex(eve::sin(T(i * i % 17)), eve::cos(T(3 * i))));
+    kyosu::fft_plan<T> plan(n);
+
+    plan.forward(x.view(), y.view());
+    TTS_LESS_EQUAL(max_error<T>(y.view(), naive_dft<T>(x.view(), n, -1)), tol) << "n = " << n;
+
+    plan.inverse(y.view(), z.view());
+    for (std::size_t i = 0; i < n; ++i)
+      TTS_RELATIVE_EQUAL(z[i], x[i], tts::prec<T>()) << "n = " << n << ", i = " << i;
+
+    // in place
+    plan.forward(x.view());
+    for (std::size_t i = 0; i < n; ++i) TTS_EQUAL(x[i], y[i]);
+    plan.inverse(x.view());
+    for (std::size_t i = 0; i < n; ++i) TTS_EQUAL(x[i], z[i]);
+  }
+};
+
+TTS_CASE_TPL("Check batched and real fft", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  double tol = sizeof(T) == 4 ? 1.0e-5 : 1.0e-13;
+  std::size_t const n = 48, batch = 5;
+  kyosu::soa_buffer<T, 2> x(n * batch), y(n * batch), one(n);
+  for (std::size_t i = 0; i < n * batch; ++i) x.set(i, kyosu::complex(T(1) / T(i + 1), eve::sin(T(i))));
+
+  kyosu::fft_plan<T> plan(n);
+  plan.forward(x.view(), y.view(), batch);
+  for (std::size_t b = 0; b < batch; ++b)
+  {
+    plan.forward(x.view().subview(b * n, n), one.view());
+    for (std::size_t i = 0; i < n; ++i) TTS_EQUAL(y[b * n + i], one[i]);
+  }
+
+  std::vector<T> r(n * batch), s(n * batch);
+  for (std::size_t i = 0; i < n * batch; ++i) r[i] = eve::cos(T(7 * i)) + T(i % 5);
+  kyosu::real_fft_plan<T> rplan(n);
+  kyosu::soa_buffer<T, 2> spectra(rplan.spectrum_size() * batch), c(n);
+  rplan.forward(r, spectra.view(), batch);
+  for (std::size_t b = 0; b < batch; ++b)
+  {
+    for (std::size_t i = 0; i < n; ++i) c.set(i, kyosu::complex(r[b * n + i]));
+    auto ref = naive_dft<T>(c.view(), n, -1);
+    ref.resize(rplan.spectrum_size());
+    TTS_LESS_EQUAL(max_error<T>(spectra.view().subview(b * rplan.spectrum_size(), rplan.spectrum_size()), ref), tol);
+  }
+  rplan.inverse(spectra.view(), s, batch);
+  for (std::size_t i = 0; i < n * batch; ++i) TTS_RELATIVE_EQUAL(s[i], r[i], tts::prec<T>());
+};
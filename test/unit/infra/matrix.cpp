@@ -0,0 +1,113 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+
+namespace
+{
+  template<typename Z, std::size_t N> auto max_distance(kyosu::matrix<Z, N> const& a, kyosu::matrix<Z, N> const& b)
+  {
+    auto d = kyosu::abs(a(0, 0) - b(0, 0));
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t j = 0; j < N; ++j) d = eve::max(d, kyosu::abs(a(i, j) - b(i, j)));
+    return d;
+  }
+
+  template<typename Z, std::size_t N> auto max_distance(std::array<Z, N> const& a, std::array<Z, N> const& b)
+  {
+    auto d = kyosu::abs(a[0] - b[0]);
+    for (std::size_t i = 0; i < N; ++i) d = eve::max(d, kyosu::abs(a[i] - b[i]));
+    return d;
+  }
+
+  // well conditioned test matrix: diagonally dominant, element (i, j) of lane l from f(l, i, j)
+  template<typename Z, std::size_t N, typename F> auto make(F f)
+  {
+    kyosu::matrix<Z, N> a;
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t j = 0; j < N; ++j) a(i, j) = f(i, j) + (i == j ? Z(2 * N) : Z(0));
+    return a;
+  }
+
+  template<typename Z, std::size_t N> void check_solvers(kyosu::matrix<Z, N> const& a, double tol)
+  {
+    using r_t = kyosu::as_real_type_t<Z>;
+    auto id = kyosu::matrix<Z, N>::identity();
+    auto inv = kyosu::inverse(a);
+    TTS_EXPECT(eve::all(max_distance(a * inv, id) <= r_t(tol)));
+    TTS_EXPECT(eve::all(max_distance(inv * a, id) <= r_t(tol)));
+
+    std::array<Z, N> x;
+    for (std::size_t i = 0; i < N; ++i) x[i] = a(i, N - 1 - i) - Z(i);
+    auto b = a * x;
+    TTS_EXPECT(eve::all(max_distance(kyosu::lu_solve(a, b), x) <= r_t(tol)));
+    TTS_EXPECT(eve::all(max_distance(kyosu::qr_solve(a, b), x) <= r_t(tol)));
+    TTS_EXPECT(eve::all(max_distance(kyosu::qr_solve(a, id), inv) <= r_t(tol)));
+  }
+}
+
+TTS_CASE_TPL("Check kyosu::matrix solvers on complex and quaternions", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  double tol = sizeof(T) == 4 ? 1e-5 : 1e-13;
+  using c_t = kyosu::complex_t<T>;
+  using q_t = kyosu::quaternion_t<T>;
+  auto fc = [](std::size_t i, std::size_t j) { return c_t(eve::sin(T(i + 2 * j)), eve::cos(T(3 * i + j))); };
+  auto fq = [](std::size_t i, std::size_t j) {
+    return q_t(eve::sin(T(i + 2 * j)), eve::cos(T(3 * i + j)), T(i) - T(j), T(1) / T(i + j + 1));
+  };
+  check_solvers(make<c_t, 2>(fc), tol);
+  check_solvers(make<c_t, 4>(fc), tol);
+  check_solvers(make<c_t, 8>(fc), tol);
+  check_solvers(make<q_t, 3>(fq), tol);
+  check_solvers(make<q_t, 5>(fq), tol);
+
+  // pivoting is needed
+  kyosu::matrix<c_t, 3> p{{{{c_t(0), c_t(1), c_t(2)}, {c_t(3, 1), c_t(0), c_t(1)}, {c_t(1), c_t(4), c_t(0, -2)}}}};
+  check_solvers(p, tol);
+
+  // determinants
+  auto a = make<c_t, 2>(fc);
+  TTS_RELATIVE_EQUAL(kyosu::det(a), a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0), tts::prec<T>());
+  auto d3 = p(0, 0) * (p(1, 1) * p(2, 2) - p(1, 2) * p(2, 1)) - p(0, 1) * (p(1, 0) * p(2, 2) - p(1, 2) * p(2, 0)) +
+            p(0, 2) * (p(1, 0) * p(2, 1) - p(1, 1) * p(2, 0));
+  TTS_RELATIVE_EQUAL(kyosu::det(p), d3, tts::prec<T>());
+  auto b = make<c_t, 4>(fc);
+  auto c = make<c_t, 4>([](std::size_t i, std::size_t j) { return c_t(T(i * j), T(1) / T(i + j + 1)); });
+  TTS_RELATIVE_EQUAL(kyosu::det(b * c), kyosu::det(b) * kyosu::det(c), tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check kyosu::matrix with one matrix per lane", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  double tol = sizeof(T) == 4 ? 1e-5 : 1e-13;
+  using r_t = eve::wide<T>;
+  using w_t = kyosu::complex_t<r_t>;
+  constexpr std::size_t N = 4;
+  auto elem = [](std::size_t l, std::size_t i, std::size_t j) {
+    // the large elements are on the diagonal of lane 0 only, so that the other lanes need pivoting
+    T big = j == (i + l) % N ? T(2 * N) : T(0);
+    return kyosu::complex_t<T>(eve::sin(T(l + i + 2 * j)) + big, eve::cos(T(3 * i + j + l)));
+  };
+  kyosu::matrix<w_t, N> a;
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = 0; j < N; ++j)
+      a(i, j) = kyosu::complex(r_t([&](auto l, auto) { return kyosu::real(elem(l, i, j)); }),
+                               r_t([&](auto l, auto) { return kyosu::imag(elem(l, i, j)); }));
+  check_solvers(a, tol);
+
+  auto d = kyosu::det(a);
+  for (std::size_t l = 0; l < r_t::size(); ++l)
+  {
+    kyosu::matrix<kyosu::complex_t<T>, N> s;
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t j = 0; j < N; ++j) s(i, j) = elem(l, i, j);
+    auto dl = kyosu::complex_t<T>(kyosu::real(d).get(l), kyosu::imag(d).get(l));
+    TTS_RELATIVE_EQUAL(dl, kyosu::det(s), tts::prec<T>());
+  }
+};
@@ -0,0 +1,131 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <span>
+#include <vector>
+
+TTS_CASE_TPL("Check kyosu::bulk::pipeline on elementwise stages", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  kyosu::bulk::pipeline p{kyosu::sqr, kyosu::minus, kyosu::exp};
+
+  // several tasks of chunks, and a scalar tail
+  std::size_t const n = 40000 + 3;
+  std::vector<c_t> zs(n), rs(n), ts(n);
+  for (std::size_t i = 0; i < n; ++i) zs[i] = c_t(T(i % 97) / 32 - 1, T(1) - T(i % 61) / 16);
+
+  p(zs, rs);
+  p(std::span<c_t const>(zs), std::span(ts), 4);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    auto e = kyosu::exp(-kyosu::sqr(zs[i]));
+    TTS_EQUAL(p(zs[i]), e);
+    TTS_RELATIVE_EQUAL(rs[i], e, tts::prec<T>());
+    TTS_EQUAL(ts[i], rs[i]);
+  }
+
+  // the output is shorter than the input
+  std::vector<c_t> us(n / 2);
+  p(zs, us, 2);
+  TTS_RELATIVE_EQUAL(us.back(), rs[n / 2 - 1], tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check kyosu::bulk::pipeline on zipped inputs", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  auto f = [](auto z, auto w) { return kumi::tuple{z * w, z + w}; };
+  auto g = [](auto a, auto b) { return kyosu::exp(a) - b; };
+  kyosu::bulk::pipeline p{f, g};
+
+  std::size_t const n = 3 * eve::wide<c_t>::size() + 1;
+  std::vector<c_t> zs(n), rs(n);
+  std::vector<T> ws(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    zs[i] = c_t(T(0.125) * i - 2, T(1) - T(0.0625) * i);
+    ws[i] = T(0.25) * i;
+  }
+
+  p(kyosu::bulk::zip(zs, ws), rs, 2);
+  for (std::size_t i = 0; i < n; ++i) TTS_RELATIVE_EQUAL(rs[i], g(zs[i] * ws[i], zs[i] + ws[i]), tts::prec<T>());
+};
+
+TTS_CASE_TPL("Check kyosu::bulk::pipeline on ranged stages", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  auto half = [](auto z) { return z / 2; };
+  kyosu::bulk::pipeline first{kyosu::bulk::ranged(kyosu::bulk::tgamma), kyosu::rec};
+  auto gamma = kyosu::bulk::ranged(kyosu::bulk::tgamma);
+  kyosu::bulk::pipeline middle{half, gamma, gamma};
+
+  std::size_t const n = 5000 + 3;
+  std::vector<c_t> zs(n), rs(n), ss(n);
+  for (std::size_t i = 0; i < n; ++i) zs[i] = c_t(T(i % 37) / 8 + T(0.5), T(i % 23) / 4 - 2);
+
+  first(zs, rs, 3);
+  middle(zs, ss, 2);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    TTS_RELATIVE_EQUAL(rs[i], kyosu::rec(kyosu::tgamma(zs[i])), tts::prec<T>());
+    TTS_RELATIVE_EQUAL(ss[i], kyosu::tgamma(kyosu::tgamma(zs[i] / 2)), tts::prec<T>());
+  }
+
+  // on values the ranged stages are applied to a span of the lanes
+  using w_t = kyosu::complex_t<eve::wide<T>>;
+  w_t w([&](auto i, auto) { return zs[i]; });
+  auto rw = first(w);
+  for (std::size_t i = 0; i < w_t::size(); ++i)
+  {
+    TTS_RELATIVE_EQUAL(first(zs[i]), rs[i], tts::prec<T>());
+    TTS_RELATIVE_EQUAL(c_t(rw.get(i)), rs[i], tts::prec<T>());
+    TTS_RELATIVE_EQUAL(middle(zs[i]), ss[i], tts::prec<T>());
+  }
+};
+
+TTS_CASE_TPL("Check kyosu::bulk::pipeline on ranged stages around a widening stage", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  auto gamma = kyosu::bulk::ranged(kyosu::bulk::tgamma);
+  auto widen = [](auto x) { return kyosu::complex_t<decltype(x)>(x, x / 4); };
+  kyosu::bulk::pipeline p{gamma, widen, gamma};
+
+  // the complex values written between the ranged stages are twice as large as the reals they are computed from
+  std::size_t const n = 5000 + 3;
+  std::vector<T> xs(n);
+  std::vector<c_t> rs(n);
+  for (std::size_t i = 0; i < n; ++i) xs[i] = T(i % 41) / 16 + T(0.75);
+
+  p(xs, rs, 2);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    auto g = kyosu::tgamma(xs[i]);
+    auto e = kyosu::tgamma(c_t(g, g / 4));
+    TTS_RELATIVE_EQUAL(rs[i], e, tts::prec<T>());
+    TTS_RELATIVE_EQUAL(p(xs[i]), e, tts::prec<T>());
+  }
+};
+
+TTS_CASE("Check kyosu::bulk::pipeline on 16 bits soa buffers")
+{
+  using c_t = kyosu::complex_t<float>;
+  kyosu::bulk::pipeline p{kyosu::sqr, kyosu::exp};
+
+  std::size_t const n = 3 * eve::wide<c_t>::size() + 1;
+  std::vector<c_t> zs(n), rs(n);
+  for (std::size_t i = 0; i < n; ++i) zs[i] = c_t(0.125f * i - 1.0f, 0.5f - 0.0625f * i);
+
+  kyosu::soa_buffer<kyosu::float16, 2> in(n);
+  kyosu::bulk::copy(zs, in);
+  p(in, rs);
+  for (std::size_t i = 0; i < n; ++i) TTS_RELATIVE_EQUAL(rs[i], kyosu::exp(kyosu::sqr(zs[i])), tts::prec<float>());
+};
@@ -0,0 +1,100 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <vector>
+
+namespace
+{
+  // the prepared evaluator e must agree with f on scalars, on SIMD values and on spans
+  template<typename T, typename E, typename F> void check_prepared(E const& e, F f, std::vector<kyosu::complex_t<T>> zs)
+  {
+    using c_t = kyosu::complex_t<T>;
+    using r_t = eve::wide<T>;
+    for (auto z : zs) TTS_RELATIVE_EQUAL(e(z), f(z), tts::prec<T>()) << z << '\n';
+    TTS_RELATIVE_EQUAL(e(kyosu::real(zs[0])), f(kyosu::real(zs[0])), tts::prec<T>());
+
+    auto w = kyosu::complex(r_t([&](auto i, auto) { return kyosu::real(zs[i % zs.size()]); }),
+                            r_t([&](auto i, auto) { return kyosu::imag(zs[i % zs.size()]); }));
+    auto ew = e(w);
+    for (std::size_t i = 0; i < r_t::size(); ++i)
+      TTS_RELATIVE_EQUAL(kyosu::complex(kyosu::real(ew).get(i), kyosu::imag(ew).get(i)), f(zs[i % zs.size()]),
+                         tts::prec<T>())
+        << i << '\n';
+
+    std::vector<c_t> rs(zs.size());
+    e(std::span(zs), std::span(rs));
+    for (std::size_t i = 0; i < zs.size(); ++i) TTS_RELATIVE_EQUAL(rs[i], f(zs[i]), tts::prec<T>()) << zs[i] << '\n';
+  }
+}
+
+TTS_CASE_TPL("Check kyosu::prepare for 2F1", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  std::vector<c_t> zs{c_t(0.25, 0.1), c_t(-0.8, 0.3), c_t(0.9, -0.45), c_t(1.5, 0.5), c_t(-3, -2), c_t(0.5, 0.9),
+                      c_t(2.5, 0), c_t(-0.3, -0.6), c_t(8, 1), c_t(0.6, 0.6), c_t(-1.2, 0)};
+
+  auto a = kumi::tuple{T(0.5), T(1.25)};
+  auto c = kumi::tuple{T(2.5)};
+  check_prepared<T>(kyosu::prepare(kyosu::hypergeometric, a, c),
+                    [&](auto z) { return kyosu::hypergeometric(z, a, c); }, zs);
+
+  auto ca = kumi::tuple{c_t(0.5, 1), T(-1.5)};
+  auto cc = kumi::tuple{c_t(1.75, -0.5)};
+  check_prepared<T>(kyosu::prepare(kyosu::hypergeometric, ca, cc),
+                    [&](auto z) { return kyosu::hypergeometric(z, ca, cc); }, zs);
+
+  auto na = kumi::tuple{T(-3), T(1.5)};
+  auto nc = kumi::tuple{T(-1.5)};
+  check_prepared<T>(kyosu::prepare(kyosu::hypergeometric[kyosu::regularized], na, nc),
+                    [&](auto z) { return kyosu::hypergeometric[kyosu::regularized](z, na, nc); }, zs);
+};
+
+TTS_CASE_TPL("Check kyosu::prepare for 1F1", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  std::vector<c_t> zs{c_t(0.25, 0.1), c_t(-3, 0.3), c_t(5, -2), c_t(1.5, 0.5), c_t(-4, -2), c_t(0, 7), c_t(12, 0)};
+
+  check_prepared<T>(kyosu::prepare(kyosu::kummer, T(1.5), T(2.25)),
+                    [](auto z) { return kyosu::kummer(z, T(1.5), T(2.25)); }, zs);
+  check_prepared<T>(kyosu::prepare(kyosu::kummer, T(-4), c_t(2.5, 1)),
+                    [](auto z) { return kyosu::kummer(z, T(-4), c_t(2.5, 1)); }, zs);
+  check_prepared<T>(kyosu::prepare(kyosu::hypergeometric[kyosu::regularized], kumi::tuple{c_t(0.5, -1)},
+                                   kumi::tuple{T(3.5)}),
+                    [](auto z) {
+                      return kyosu::hypergeometric[kyosu::regularized](z, kumi::tuple{c_t(0.5, -1)},
+                                                                       kumi::tuple{T(3.5)});
+                    },
+                    zs);
+
+  // b = 0 is moved as the other poles by kyosu::kummer[kyosu::regularized]
+  auto m0 = kyosu::prepare(kyosu::kummer[kyosu::regularized], T(1.5), T(0));
+  for (auto z : zs)
+  {
+    auto e = m0(z);
+    auto f = kyosu::kummer[kyosu::regularized](z, T(1.5), T(0));
+    TTS_EQUAL(kyosu::is_finite(e), kyosu::is_finite(f)) << z << '\n';
+    if (kyosu::is_finite(f)) TTS_RELATIVE_EQUAL(e, f, tts::prec<T>()) << z << '\n';
+  }
+};
+
+TTS_CASE_TPL("Check kyosu::prepare for tricomi", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  std::vector<c_t> zs{c_t(0.25, 0.1), c_t(3, 0.3), c_t(5, -2), c_t(1.5, 0.5), c_t(60, -2), c_t(0.5, 7), c_t(2, 0)};
+
+  check_prepared<T>(kyosu::prepare(kyosu::tricomi, T(1.5), T(2.25)),
+                    [](auto z) { return kyosu::tricomi(z, T(1.5), T(2.25)); }, zs);
+  check_prepared<T>(kyosu::prepare(kyosu::tricomi, T(0.5), T(3)),
+                    [](auto z) { return kyosu::tricomi(z, T(0.5), T(3)); }, zs);
+  check_prepared<T>(kyosu::prepare(kyosu::tricomi, c_t(1, 0.5), T(1.25)),
+                    [](auto z) { return kyosu::tricomi(z, c_t(1, 0.5), T(1.25)); }, zs);
+};
@@ -0,0 +1,108 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+  using q_t = kyosu::quaternion_t<double>;
+
+  template<typename Q> q_t widen(Q const& q)
+  {
+    return q_t(kumi::get<0>(q), kumi::get<1>(q), kumi::get<2>(q), kumi::get<3>(q));
+  }
+
+  // exp(-mu t) for a pure mu
+  q_t kernel(q_t mu, double t)
+  {
+    return std::cos(t) - mu * (std::sin(t) / kyosu::abs(mu));
+  }
+
+  // O(n^2) quaternion DFT of a rows x cols image
+  template<typename T>
+  std::vector<q_t> naive_qft(kyosu::qft_side side, kyosu::soa_view<T const, 4> x, std::size_t rows, std::size_t cols,
+                             q_t mu1, q_t mu2)
+  {
+    std::vector<q_t> y(rows * cols);
+    double const tau = 2 * std::numbers::pi;
+    for (std::size_t u = 0; u < rows; ++u)
+      for (std::size_t v = 0; v < cols; ++v)
+        for (std::size_t m = 0; m < rows; ++m)
+          for (std::size_t n = 0; n < cols; ++n)
+          {
+            auto f = widen(x[m * cols + n]);
+            double a = tau * double(u * m % rows) / double(rows), b = tau * double(v * n % cols) / double(cols);
+            auto& s = y[u * cols + v];
+            if (side == kyosu::qft_side::left) s += kernel(mu1, a + b) * f;
+            else if (side == kyosu::qft_side::right) s += f * kernel(mu2, a + b);
+            else s += kernel(mu1, a) * f * kernel(mu2, b);
+          }
+    return y;
+  }
+
+  template<typename T>
+  void check(kyosu::qft_side side, std::size_t rows, std::size_t cols, q_t mu1, q_t mu2, std::size_t batch = 1)
+  {
+    double tol = sizeof(T) == 4 ? 1.0e-5 : 1.0e-13;
+    std::size_t const area = rows * cols;
+    kyosu::soa_buffer<T, 4> x(area * batch), y(area * batch), z(area * batch);
+    for (std::size_t i = 0; i < area * batch; ++i)
+      x.set(i, kyosu::quaternion_t<T>(eve::sin(T(i)), eve::cos(T(3 * i)), T(1) / T(i + 1), T(i % 7) / T(7)));
+
+    auto narrow = [](q_t q) {
+      return kyosu::quaternion_t<T>(0, T(kyosu::ipart(q)), T(kyosu::jpart(q)), T(kyosu::kpart(q)));
+    };
+    kyosu::qft_plan<T> plan(side, rows, cols, narrow(mu1), narrow(mu2));
+    plan.forward(x.view(), y.view(), batch);
+    for (std::size_t b = 0; b < batch; ++b)
+    {
+      auto ref = naive_qft<T>(side, x.view().subview(b * area, area), rows, cols, mu1, mu2);
+      double e = 0, mx = 1;
+      for (std::size_t i = 0; i < area; ++i)
+      {
+        e = std::max(e, kyosu::abs(widen(y[b * area + i]) - ref[i]));
+        mx = std::max(mx, kyosu::abs(ref[i]));
+      }
+      TTS_LESS_EQUAL(e / mx, tol);
+    }
+
+    plan.inverse(y.view(), z.view(), batch);
+    for (std::size_t i = 0; i < area * batch; ++i) TTS_RELATIVE_EQUAL(z[i], x[i], tts::prec<T>());
+
+    plan.forward(x.view(), batch);
+    for (std::size_t i = 0; i < area * batch; ++i) TTS_EQUAL(x[i], y[i]);
+  }
+}
+
+TTS_CASE_TPL("Check one dimensional qft_plan against a naive quaternion DFT", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using kyosu::qft_side;
+  for (q_t mu : {q_t(0, 1, 0, 0), q_t(0, 0, 1, 0), q_t(0, 0, 0, 1), q_t(0, 1, 1, 1), q_t(0, 1, 2, -2)})
+    for (std::size_t n : {1, 2, 6, 16, 45})
+    {
+      check<T>(qft_side::left, 1, n, mu, mu);
+      check<T>(qft_side::right, 1, n, mu, mu, 3);
+    }
+};
+
+TTS_CASE_TPL("Check two dimensional qft_plan against a naive quaternion DFT", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using kyosu::qft_side;
+  q_t i(0, 1, 0, 0), j(0, 0, 1, 0), l(0, 1, 1, 1), p(0, 0, 1, -1);
+  for (auto side : {qft_side::left, qft_side::right, qft_side::two_sided})
+  {
+    check<T>(side, 4, 6, i, j);
+    check<T>(side, 8, 8, i, j, 2);
+    check<T>(side, 3, 5, l, p);
+    check<T>(side, 9, 16, j, l);
+  }
+};
@@ -0,0 +1,96 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+TTS_CASE_TPL("Check bulk reductions", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  std::size_t const n = 3 * 4096 + 37;
+  std::vector<c_t> xs(n), ys(n);
+  std::vector<T> rs(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    xs[i] = c_t(eve::sin(T(i)), eve::cos(T(3 * i)));
+    ys[i] = c_t(T(1) / T(i + 1), eve::sin(T(2 * i)));
+    rs[i] = eve::cos(T(5 * i));
+  }
+
+  c_t s(0), d(0);
+  T q(0), l1(0), m(0), mf(0);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    s += xs[i];
+    d += xs[i] * kyosu::conj(ys[i]);
+    q += kyosu::sqr_abs(xs[i]);
+    l1 += kyosu::abs(xs[i]);
+    m = eve::max(m, kyosu::abs(xs[i]));
+    mf = eve::max(mf, eve::maxabs(kyosu::real(xs[i]), kyosu::imag(xs[i])));
+  }
+
+  auto pr = tts::prec<T>(1.0e-3, 1.0e-10);
+  TTS_RELATIVE_EQUAL(kyosu::bulk::sum(xs), s, pr);
+  TTS_RELATIVE_EQUAL(kyosu::bulk::sum(xs, 3), s, pr);
+  TTS_RELATIVE_EQUAL(kyosu::bulk::dot(xs, ys), d, pr);
+  TTS_RELATIVE_EQUAL(kyosu::bulk::dot(xs, rs), kyosu::conj(kyosu::bulk::dot(rs, xs)), pr);
+  TTS_RELATIVE_EQUAL(kyosu::bulk::sum_sqr_abs(xs), q, pr);
+  TTS_RELATIVE_EQUAL(kyosu::bulk::lpnorm(T(2), xs), eve::sqrt(q), pr);
+  TTS_RELATIVE_EQUAL(kyosu::bulk::lpnorm(T(1), xs), l1, pr);
+  TTS_ULP_EQUAL(kyosu::bulk::lpnorm(eve::inf(eve::as<T>()), xs), m, 0.5);
+  TTS_ULP_EQUAL(kyosu::bulk::linfnorm(xs), m, 0.5);
+  TTS_ULP_EQUAL(kyosu::bulk::maxabs(xs, 2), m, 0.5);
+  TTS_EQUAL(kyosu::bulk::maxabs[kyosu::flat](xs), mf);
+  TTS_EQUAL(kyosu::bulk::sum(std::span(xs).first(0)), c_t(0));
+};
+
+TTS_CASE_TPL("Check bulk reductions reproducibility", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using q_t = kyosu::quaternion_t<T>;
+  std::size_t const n = 5 * 4096 + 3;
+  std::vector<q_t> xs(n);
+  for (std::size_t i = 0; i < n; ++i)
+    xs[i] = q_t(eve::sin(T(i)) * T(1 << (i % 20)), eve::cos(T(i)), -eve::sin(T(7 * i)), T(1) / T(i + 1));
+
+  auto s1 = kyosu::bulk::sum[kyosu::reproducible](xs);
+  auto d1 = kyosu::bulk::dot[kyosu::reproducible](xs, xs);
+  auto n1 = kyosu::bulk::lpnorm[kyosu::reproducible](T(3), xs);
+  for (std::size_t t : {2, 3, 5, 8})
+  {
+    TTS_EQUAL(kyosu::bulk::sum[kyosu::reproducible](xs, t), s1);
+    TTS_EQUAL(kyosu::bulk::dot[kyosu::reproducible](xs, xs, t), d1);
+    TTS_EQUAL(kyosu::bulk::lpnorm[kyosu::reproducible](T(3), xs, t), n1);
+  }
+
+  // the same range seen as planes: same virtual lanes, same bits
+  kyosu::soa_buffer<T, 4> planes(n);
+  kyosu::bulk::copy(xs, planes);
+  TTS_EQUAL(kyosu::bulk::sum[kyosu::reproducible](planes, 4), s1);
+  TTS_RELATIVE_EQUAL(kyosu::bulk::sum(planes), s1, tts::prec<T>(1.0e-3, 1.0e-10));
+
+  // the same order of additions written with scalars: 16 lanes by block of 4096 elements, pairwise trees
+  auto tree = [](auto self, q_t const* a, std::size_t m) -> q_t {
+    if (m == 1) return a[0];
+    return self(self, a, m / 2) + self(self, a + m / 2, m - m / 2);
+  };
+  std::vector<q_t> blocks;
+  for (std::size_t b = 0; b < n; b += 4096)
+  {
+    std::array<q_t, 16> lanes;
+    lanes.fill(q_t(0));
+    for (std::size_t i = b; i < std::min(n, b + 4096); ++i) lanes[(i - b) % 16] += xs[i];
+    for (std::size_t h = 8; h > 0; h /= 2)
+      for (std::size_t l = 0; l < h; ++l) lanes[l] += lanes[l + h];
+    blocks.push_back(lanes[0]);
+  }
+  TTS_EQUAL(tree(tree, blocks.data(), blocks.size()), s1);
+};
@@ -0,0 +1,103 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <test.hpp>
+#include <cmath>
+#include <vector>
+
+TTS_CASE("Check float16 and bfloat16 conversions")
+{
+  using kyosu::bfloat16;
+  using kyosu::float16;
+  auto h = [](float f) { return int(static_cast<std::uint16_t>(kyosu::from_float<float16>(f))); };
+  auto b = [](float f) { return int(static_cast<std::uint16_t>(kyosu::from_float<bfloat16>(f))); };
+
+  TTS_EQUAL(h(1.0f), 0x3c00);
+  TTS_EQUAL(h(-2.0f), 0xc000);
+  TTS_EQUAL(h(65504.0f), 0x7bff);
+  TTS_EQUAL(h(65520.0f), 0x7c00);
+  TTS_EQUAL(h(eve::inf(eve::as<float>())), 0x7c00);
+  TTS_EQUAL(h(std::ldexp(1.0f, -24)), 0x0001);
+  TTS_EQUAL(h(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+  TTS_EQUAL(h(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3c02);
+  TTS_EQUAL(b(1.0f), 0x3f80);
+  TTS_EQUAL(b(1.0f + std::ldexp(1.0f, -8)), 0x3f80);
+  TTS_EQUAL(b(1.0f + 3 * std::ldexp(1.0f, -8)), 0x3f82);
+
+  TTS_EQUAL(kyosu::to_float(float16(0x3555)), 0.333251953125f);
+  TTS_EQUAL(kyosu::to_float(float16(0x8001)), -std::ldexp(1.0f, -24));
+  TTS_EQUAL(kyosu::to_float(float16(0x7c00)), eve::inf(eve::as<float>()));
+  TTS_EXPECT(eve::is_nan(kyosu::to_float(float16(0x7e00))));
+  TTS_EXPECT(eve::is_nan(kyosu::to_float(kyosu::from_float<bfloat16>(eve::nan(eve::as<float>())))));
+  TTS_EQUAL(kyosu::to_float(bfloat16(0xc040)), -3.0f);
+
+  // every binary16 value but the NaNs round trips through float
+  int failures = 0;
+  for (int u = 0; u < 0x10000; ++u)
+  {
+    if ((u & 0x7c00) == 0x7c00 && (u & 0x3ff)) continue;
+    failures += h(kyosu::to_float(float16(u))) != u;
+  }
+  TTS_EQUAL(failures, 0);
+};
+
+TTS_CASE_TPL("Check bulk transform on 16 bits soa buffers", tts::types<kyosu::float16, kyosu::bfloat16>)
+<typename S>(tts::type<S>)
+{
+  using c_t = kyosu::complex_t<float>;
+  std::size_t const n = 3 * eve::wide<c_t>::size() + 1;
+  std::vector<c_t> zs(n), rs(n), ss(n);
+  for (std::size_t i = 0; i < n; ++i) zs[i] = c_t(0.125f * i - 2.0f, 1.0f - 0.0625f * i);
+
+  kyosu::soa_buffer<S, 2> in(n), out(n);
+  kyosu::bulk::copy(zs, in);
+  kyosu::bulk::transform(in, out, [](auto z) { return kyosu::exp(z); });
+  kyosu::bulk::copy(out, rs);
+  kyosu::bulk::transform(in.view(), std::span(ss), [](auto z) { return kyosu::exp(z); });
+
+  // the inputs are exactly representable: only the narrowing of the results rounds
+  auto tol = std::same_as<S, kyosu::float16> ? 0x1p-10f : 0x1p-7f;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    TTS_EQUAL(in[i], zs[i]);
+    auto e = kyosu::exp(zs[i]);
+    TTS_EXPECT(kyosu::abs(rs[i] - e) <= tol * kyosu::abs(e));
+    TTS_RELATIVE_EQUAL(ss[i], e, tts::prec<float>());
+  }
+
+  kyosu::soa_buffer<S, 2> part(n);
+  kyosu::bulk::copy(in.view().subview(1, n - 1), part.view().subview(0, n - 1));
+  TTS_EQUAL(part[0], zs[1]);
+  TTS_EQUAL(part[n - 2], zs[n - 1]);
+};
+
+TTS_CASE_TPL("Check copies of soa buffers", tts::types<float, double, kyosu::float16>)
+<typename S>(tts::type<S>)
+{
+  using c_t = typename kyosu::soa_buffer<S, 2>::value_type;
+  std::size_t const n = 37;
+  kyosu::soa_buffer<S, 2> a(n);
+  for (std::size_t i = 0; i < n; ++i) a.set(i, c_t(0.5f * i, -0.25f * i));
+
+  // the copies are allocated elsewhere: their planes may start at another shift of their storage
+  std::vector<kyosu::soa_buffer<S, 2>> copies;
+  for (int k = 0; k < 8; ++k) copies.push_back(a);
+  kyosu::soa_buffer<S, 2> b(1);
+  b = copies.back();
+
+  for (auto const& c : copies)
+  {
+    TTS_EQUAL(c.size(), n);
+    for (std::size_t i = 0; i < n; ++i) TTS_EQUAL(c[i], a[i]);
+  }
+  for (std::size_t i = 0; i < n; ++i) TTS_EQUAL(b[i], a[i]);
+
+  kyosu::soa_buffer<S, 2> m(std::move(b));
+  TTS_EQUAL(b.size(), std::size_t(0));
+  TTS_EQUAL(m[n - 1], a[n - 1]);
+};
@@ -0,0 +1,117 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <kyosu/soa_file.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <test.hpp>
+#include <vector>
+
+namespace
+{
+  std::string temporary(std::string const& name)
+  {
+    return (std::filesystem::temp_directory_path() / ("kyosu_test_" + name)).string();
+  }
+}
+
+TTS_CASE_TPL("Check kyosu::soa_writer and kyosu::mapped_soa", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using q_t = kyosu::quaternion_t<T>;
+  auto path = temporary("quaternions_" + std::to_string(sizeof(T)) + ".soa");
+  std::size_t const n = 3 * eve::wide<q_t>::size() + 5;
+  std::vector<q_t> zs(n);
+  for (std::size_t i = 0; i < n; ++i) zs[i] = q_t(T(i), -T(i) / 2, T(1) / T(i + 1), T(i % 3));
+
+  // values in several calls and small chunks, a view, one value
+  {
+    kyosu::soa_writer<T, 4> w(path.c_str(), n + 3, 256, 7);
+    w.write(std::span(zs).first(5)).write(std::span(zs).subspan(5));
+    kyosu::soa_buffer<T, 4> b(2);
+    b.set(0, q_t(1, 2, 3, 4));
+    b.set(1, q_t(5, 6, 7, 8));
+    w.write(b.view());
+    w.push(q_t(-1, -2, -3, -4));
+    TTS_EQUAL(w.size(), n + 3);
+    TTS_EXPECT(bool(w));
+    w.push(q_t(0));
+    TTS_EXPECT(!w);
+    TTS_EXPECT(!w.close());
+  }
+
+  // a writer assigned to writes its pending values first
+  auto other = temporary("assigned_" + std::to_string(sizeof(T)) + ".soa");
+  auto unused = temporary("unused_" + std::to_string(sizeof(T)) + ".soa");
+  {
+    kyosu::soa_writer<T, 4> w(other.c_str(), 2, 256, 7);
+    w.push(zs[1]).push(zs[2]);
+    w = kyosu::soa_writer<T, 4>(unused.c_str(), 1);
+  }
+  auto a = kyosu::mapped_soa<T const, 4>::open(other.c_str());
+  TTS_EXPECT(a.has_value());
+  TTS_EQUAL((*a)[1], zs[2]);
+  a.reset();
+  std::filesystem::remove(other);
+  std::filesystem::remove(unused);
+
+  auto m = kyosu::mapped_soa<T const, 4>::open(path.c_str());
+  TTS_EXPECT(m.has_value());
+  TTS_EQUAL(m->size(), n + 3);
+  TTS_EQUAL(m->alignment(), std::size_t(256));
+  for (std::size_t i = 0; i < n; ++i) TTS_EQUAL((*m)[i], zs[i]) << i << '\n';
+  TTS_EQUAL((*m)[n], q_t(1, 2, 3, 4));
+  TTS_EQUAL((*m)[n + 2], q_t(-1, -2, -3, -4));
+  auto v = m->view();
+  for (unsigned int k = 0; k < 4; ++k)
+    TTS_EQUAL(reinterpret_cast<std::uintptr_t>(v.planes[k]) % 256, std::uintptr_t(0));
+
+  // in place processing of a file, moves
+  auto out = temporary("exp_" + std::to_string(sizeof(T)) + ".soa");
+  {
+    auto r = kyosu::mapped_soa<T, 4>::create(out.c_str(), m->size());
+    TTS_EXPECT(r.has_value());
+    kyosu::bulk::transform(*m, *r, [](auto z) { return kyosu::exp(z); });
+    auto s = std::move(*r);
+    TTS_RELATIVE_EQUAL(s[3], kyosu::exp(zs[3]), tts::prec<T>());
+  }
+  auto e = kyosu::mapped_soa<T const, 4>::open(out.c_str());
+  TTS_EXPECT(e.has_value());
+  for (std::size_t i = 0; i < n; ++i) TTS_RELATIVE_EQUAL((*e)[i], kyosu::exp(zs[i]), tts::prec<T>()) << i << '\n';
+
+  // other types, other dimensions, truncated and missing files
+  using o_t = std::conditional_t<std::same_as<T, float>, double, float>;
+  TTS_EXPECT(!(kyosu::mapped_soa<o_t const, 4>::open(path.c_str())));
+  TTS_EXPECT(!(kyosu::mapped_soa<T const, 2>::open(path.c_str())));
+  m.reset();
+  std::filesystem::resize_file(path, 100);
+  TTS_EXPECT(!(kyosu::mapped_soa<T const, 4>::open(path.c_str())));
+  std::filesystem::remove(path);
+  TTS_EXPECT(!(kyosu::mapped_soa<T const, 4>::open(path.c_str())));
+  e.reset();
+  std::filesystem::remove(out);
+};
+
+TTS_CASE("Check kyosu::soa_writer with 16 bits storage")
+{
+  using c_t = kyosu::complex_t<float>;
+  auto path = temporary("float16.soa");
+  std::vector<c_t> zs(37);
+  for (std::size_t i = 0; i < zs.size(); ++i) zs[i] = c_t(0.25f * i, -0.5f * i);
+  {
+    kyosu::soa_writer<kyosu::float16, 2> w(path.c_str(), zs.size());
+    w.write(std::span(zs));
+    TTS_EXPECT(w.close());
+  }
+  auto m = kyosu::mapped_soa<kyosu::float16 const, 2>::open(path.c_str());
+  TTS_EXPECT(m.has_value());
+  for (std::size_t i = 0; i < zs.size(); ++i) TTS_EQUAL((*m)[i], zs[i]) << i << '\n';
+  m.reset();
+  std::filesystem::remove(path);
+};
@@ -0,0 +1,92 @@
+//======================================================================================================================
+/*
+  Kyosu - Complex Without Complexes
+  Copyright : KYOSU Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//======================================================================================================================
+#include <kyosu/kyosu.hpp>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <test.hpp>
+#include <vector>
+
+namespace
+{
+  template<typename T> T table_error(kyosu::complex_t<T> p, kyosu::complex_t<T> f)
+  {
+    return kyosu::abs(p - f) / (1 + kyosu::abs(f));
+  }
+}
+
+TTS_CASE_TPL("Check kyosu::tabulate against the tabulated function", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  using r_t = eve::wide<T>;
+  auto tol = 1000 * eve::eps(eve::as<T>());
+  auto t = kyosu::tabulate(kyosu::exp, c_t(-2, -2), c_t(2, 2), tol);
+  TTS_EXPECT(t.accurate());
+  TTS_EXPECT(t.error() <= tol);
+  TTS_EQUAL(t.degree(), std::size_t(8));
+  TTS_EQUAL(t.lower(), c_t(-2, -2));
+  TTS_EQUAL(t.upper(), c_t(2, 2));
+
+  // points between the sample points of the verification, and the corners
+  std::vector<c_t> zs{c_t(0.1, 0.3), c_t(-1.77, 1.23), c_t(1.99, -0.01), c_t(-2, -2), c_t(2, 2), c_t(0.5, -1.9)};
+  for (auto z : zs) TTS_EXPECT(table_error(t(z), kyosu::exp(z)) <= 10 * tol) << z << '\n';
+
+  auto w = kyosu::complex(r_t([&](auto i, auto) { return kyosu::real(zs[i % zs.size()]); }),
+                          r_t([&](auto i, auto) { return kyosu::imag(zs[i % zs.size()]); }));
+  auto tw = t(w);
+  for (std::size_t i = 0; i < r_t::size(); ++i)
+    TTS_RELATIVE_EQUAL(kyosu::complex(kyosu::real(tw).get(i), kyosu::imag(tw).get(i)), t(zs[i % zs.size()]),
+                       tts::prec<T>())
+      << i << '\n';
+
+  // real arguments and spans
+  std::vector<T> xs{T(-1.5), T(0), T(0.7), T(1.9), T(-0.3), T(1.1), T(-1.95), T(0.05), T(1.3)};
+  std::vector<c_t> rs(xs.size());
+  t(std::span(xs), std::span(rs));
+  for (std::size_t i = 0; i < xs.size(); ++i) TTS_RELATIVE_EQUAL(rs[i], t(xs[i]), tts::prec<T>()) << i << '\n';
+
+  // outside of the rectangle
+  TTS_EXPECT(kyosu::is_nan(t(c_t(2.5, 0))));
+  TTS_EXPECT(kyosu::is_nan(t(c_t(0, -2.01))));
+  TTS_EXPECT(kyosu::is_nan(kyosu::tabulated_function<T>()(c_t(0, 0))));
+};
+
+TTS_CASE_TPL("Check kyosu::tabulated_function save and load", kyosu::scalar_real_types)
+<typename T>(tts::type<T>)
+{
+  using c_t = kyosu::complex_t<T>;
+  auto t = kyosu::tabulate(kyosu::faddeeva, c_t(-3, -1), c_t(3, 2), T(1.0e-4), 6);
+
+  std::stringstream ss;
+  t.save(ss);
+  auto u = kyosu::tabulated_function<T>::load(ss);
+  TTS_EXPECT(u.has_value());
+  TTS_EQUAL(u->patches(), t.patches());
+  TTS_EQUAL(u->degree(), t.degree());
+  TTS_EQUAL(u->error(), t.error());
+  for (auto z : {c_t(0.3, 0.2), c_t(-2.9, 1.9), c_t(1, -0.5)}) TTS_EQUAL((*u)(z), t(z)) << z << '\n';
+
+  // truncated stream, other floating type, not a table
+  auto s = ss.str();
+  std::stringstream truncated(s.substr(0, s.size() / 2));
+  TTS_EXPECT(!kyosu::tabulated_function<T>::load(truncated).has_value());
+  using o_t = std::conditional_t<std::same_as<T, float>, double, float>;
+  std::stringstream other(s);
+  TTS_EXPECT(!kyosu::tabulated_function<o_t>::load(other).has_value());
+  std::stringstream garbage("this is not a kyosu table");
+  TTS_EXPECT(!kyosu::tabulated_function<T>::load(garbage).has_value());
+
+  // a corrupt header announcing 2^24 x 2^24 patches is rejected before any allocation
+  auto huge = s;
+  std::uint64_t const side = std::uint64_t(1) << 24;
+  std::memcpy(huge.data() + 24, &side, sizeof(side));
+  std::memcpy(huge.data() + 32, &side, sizeof(side));
+  std::stringstream corrupt(huge);
+  TTS_EXPECT(!kyosu::tabulated_function<T>::load(corrupt).has_value());
+};
@@ -9,13 +9,13 @@
 #include <iostream>
 #include <utility>
 
-// These routines are not used
-// They were used to generate the p and q coefficients of
+// These routines print the p and q coefficients of
 // Stokes Semiconvergent Series from A. Gray, G. B. Mathews 'A
 //  treatise on Bessel functions and their applications to
 //  physics, 1895.
-// They can be used anew if we implement bessel for more
-// accurate type in the future
+// The tables used by the large argument regime of the cylindrical
+// bessel functions are generated at compile time by
+// kyosu/details/bessel/stokes_gen.hpp: this tool is kept to check them.
 
 template<size_t Degree, typename T> auto stokes_gen(size_t nu) noexcept
 {